@@ -0,0 +1,46 @@
+#include "Benchmark.h"
+#include <cmath>
+#include <numbers>
+
+namespace Prism::Benchmarks
+{
+	SphereMesh MakeSphere(const u32 rings, const u32 segments, const f32 radius)
+	{
+		SphereMesh mesh;
+		const u32 vertexCount = (rings + 1) * (segments + 1);
+		mesh.Positions.reserve(size_t{ vertexCount } * 3);
+		mesh.Normals.reserve(size_t{ vertexCount } * 3);
+		mesh.TexCoords.reserve(size_t{ vertexCount } * 3);
+
+		for (u32 ring = 0; ring <= rings; ring++)
+		{
+			const f32 v     = static_cast<f32>(ring) / static_cast<f32>(rings);
+			const f32 theta = v * std::numbers::pi_v<f32>;
+			for (u32 segment = 0; segment <= segments; segment++)
+			{
+				const f32 u   = static_cast<f32>(segment) / static_cast<f32>(segments);
+				const f32 phi = u * 2.0f * std::numbers::pi_v<f32>;
+				const f32 x   = std::sin(theta) * std::cos(phi);
+				const f32 y   = std::cos(theta);
+				const f32 z   = std::sin(theta) * std::sin(phi);
+
+				mesh.Positions.insert(mesh.Positions.end(), { x * radius, y * radius, z * radius });
+				mesh.Normals.insert(mesh.Normals.end(), { x, y, z });
+				mesh.TexCoords.insert(mesh.TexCoords.end(), { u, v, 0.0f });
+			}
+		}
+
+		mesh.Indices.reserve(size_t{ rings } * segments * 6);
+		for (u32 ring = 0; ring < rings; ring++)
+		{
+			for (u32 segment = 0; segment < segments; segment++)
+			{
+				const u32 a = ring * (segments + 1) + segment;
+				const u32 b = a + segments + 1;
+				mesh.Indices.insert(mesh.Indices.end(), { a, b, a + 1, a + 1, b, b + 1 });
+			}
+		}
+
+		return mesh;
+	}
+}
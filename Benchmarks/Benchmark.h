@@ -0,0 +1,58 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace Prism::Benchmarks
+{
+	using Clock = std::chrono::steady_clock;
+
+	// Runs fn once to warm caches and the worker pool, then returns the fastest of 'runs' timed calls in seconds
+	// The fastest run is the least disturbed by other processes, which keeps results comparable between machines
+	template <typename Function>
+	NODISCARD f64 MeasureBest(const u32 runs, Function&& fn)
+	{
+		fn();
+
+		f64 best = std::numeric_limits<f64>::max();
+		for (u32 run = 0; run < runs; run++)
+		{
+			const Clock::time_point start = Clock::now();
+			fn();
+			best = std::min(best, std::chrono::duration<f64>(Clock::now() - start).count());
+		}
+		return best;
+	}
+
+	// Deterministic UV sphere with float3 streams laid out like aiVector3D arrays (texture coordinates keep z = 0)
+	// Triangles are emitted ring by ring, so consecutive triangles are spatial neighbours like in an optimized mesh
+	struct SphereMesh
+	{
+		std::vector<f32> Positions;
+		std::vector<f32> Normals;
+		std::vector<f32> TexCoords;
+		std::vector<u32> Indices;
+
+		NODISCARD u32 GetVertexCount() const noexcept { return static_cast<u32>(Positions.size() / 3); }
+		NODISCARD u32 GetTriangleCount() const noexcept { return static_cast<u32>(Indices.size() / 3); }
+	};
+
+	NODISCARD SphereMesh MakeSphere(const u32 rings, const u32 segments, const f32 radius = 1.0f);
+
+	// Work items per second in millions, the unit every benchmark reports its rates in
+	NODISCARD inline f64 GetRate(const u64 items, const f64 seconds) noexcept
+	{
+		return seconds > 0.0 ? static_cast<f64>(items) / seconds / 1e6 : 0.0;
+	}
+
+	void RunConversionBenchmarks();
+	void RunVertexBenchmarks();
+	void RunOverdrawBenchmarks();
+	void RunMeshletBenchmarks();
+	void RunIOBenchmarks();
+	void RunTextureBenchmarks();
+}
@@ -0,0 +1,117 @@
+#include "Benchmark.h"
+#include "Graphics/Importers/MeshImporter.h"
+#include "Graphics/VertexFormats.h"
+#include "Utils/Log.h"
+#include <assimp/mesh.h>
+#include <cstring>
+#include <memory>
+
+namespace Prism::Benchmarks
+{
+	namespace
+	{
+		constexpr u32 MeshCount = 48;
+		constexpr u32 Runs      = 3;
+
+		std::unique_ptr<aiMesh> MakeAssimpMesh(const SphereMesh& sphere)
+		{
+			auto mesh = std::make_unique<aiMesh>();
+			mesh->mPrimitiveTypes     = aiPrimitiveType_TRIANGLE;
+			mesh->mNumVertices        = sphere.GetVertexCount();
+			mesh->mVertices           = new aiVector3D[mesh->mNumVertices];
+			mesh->mNormals            = new aiVector3D[mesh->mNumVertices];
+			mesh->mTextureCoords[0]   = new aiVector3D[mesh->mNumVertices];
+			mesh->mNumUVComponents[0] = 2;
+			std::memcpy(mesh->mVertices, sphere.Positions.data(), sphere.Positions.size() * sizeof(f32));
+			std::memcpy(mesh->mNormals, sphere.Normals.data(), sphere.Normals.size() * sizeof(f32));
+			std::memcpy(mesh->mTextureCoords[0], sphere.TexCoords.data(), sphere.TexCoords.size() * sizeof(f32));
+
+			mesh->mNumFaces = sphere.GetTriangleCount();
+			mesh->mFaces    = new aiFace[mesh->mNumFaces];
+			for (u32 i = 0; i < mesh->mNumFaces; i++)
+			{
+				aiFace& face     = mesh->mFaces[i];
+				face.mNumIndices = 3;
+				face.mIndices    = new unsigned int[3]{ sphere.Indices[i * 3], sphere.Indices[i * 3 + 1], sphere.Indices[i * 3 + 2] };
+			}
+			return mesh;
+		}
+
+		// Straight per vertex copy, the baseline InterleaveVertices has to beat
+		void InterleaveScalar(const SphereMesh& sphere, std::span<DirectX::VertexPositionNormalTangentColorTexture> out)
+		{
+			for (size_t i = 0; i < out.size(); i++)
+			{
+				DirectX::VertexPositionNormalTangentColorTexture& vertex = out[i];
+				vertex.position          = { sphere.Positions[i * 3], sphere.Positions[i * 3 + 1], sphere.Positions[i * 3 + 2] };
+				vertex.normal            = { sphere.Normals[i * 3], sphere.Normals[i * 3 + 1], sphere.Normals[i * 3 + 2] };
+				vertex.tangent           = { 0.0f, 0.0f, 0.0f, 0.0f };
+				vertex.color             = 0;
+				vertex.textureCoordinate = { sphere.TexCoords[i * 3], sphere.TexCoords[i * 3 + 1] };
+			}
+		}
+	}
+
+	void RunConversionBenchmarks()
+	{
+		// Meshes of a few ten thousand triangles, the size range where per mesh work dominates a scene import
+		const SphereMesh sphere = MakeSphere(96, 192);
+
+		std::vector<std::unique_ptr<aiMesh>> owners;
+		std::vector<const aiMesh*> meshes;
+		for (u32 i = 0; i < MeshCount; i++)
+		{
+			meshes.push_back(owners.emplace_back(MakeAssimpMesh(sphere)).get());
+		}
+
+		const u64 triangles = u64{ sphere.GetTriangleCount() } * MeshCount;
+
+		// Conversion alone, the optimization passes that run on every converted mesh by default are turned off
+		Gfx::MeshImporter::ImportSettings settings;
+		settings.OptimizeVertexCache = false;
+		settings.OptimizeOverdraw    = false;
+		settings.OptimizeVertexFetch = false;
+		settings.GenerateLods        = false;
+		settings.BuildMeshlets       = false;
+		settings.ParallelConversion  = false;
+		const f64 serial = MeasureBest(Runs, [&] { (void)Gfx::MeshImporter::ConvertMeshes(meshes, settings); });
+
+		settings.ParallelConversion = true;
+		const f64 parallel = MeasureBest(Runs, [&] { (void)Gfx::MeshImporter::ConvertMeshes(meshes, settings); });
+
+		Log::Info("ConvertMeshes, {} meshes of {} triangles", MeshCount, sphere.GetTriangleCount());
+		Log::Info("  serial   {:8.2f} ms  {:7.2f} MTri/s", serial * 1e3, GetRate(triangles, serial));
+		Log::Info("  parallel {:8.2f} ms  {:7.2f} MTri/s  {:.2f}x", parallel * 1e3, GetRate(triangles, parallel), serial / parallel);
+	}
+
+	void RunVertexBenchmarks()
+	{
+		const SphereMesh sphere  = MakeSphere(1024, 2048);
+		const u32 vertexCount    = sphere.GetVertexCount();
+		const u64 bytes          = u64{ vertexCount } * sizeof(DirectX::VertexPositionNormalTangentColorTexture);
+		std::vector<DirectX::VertexPositionNormalTangentColorTexture> vertices(vertexCount);
+
+		const Gfx::VertexStreams streams
+		{
+			.Positions   = sphere.Positions.data(),
+			.Normals     = sphere.Normals.data(),
+			.TexCoords   = sphere.TexCoords.data(),
+			.VertexCount = vertexCount
+		};
+
+		const f64 scalar   = MeasureBest(5, [&] { InterleaveScalar(sphere, vertices); });
+		const f64 simd     = MeasureBest(5, [&] { Gfx::InterleaveVertices(streams, vertices, false); });
+		const f64 parallel = MeasureBest(5, [&] { Gfx::InterleaveVertices(streams, vertices, true); });
+
+		const auto Report = [&](const std::string_view name, const f64 seconds)
+		{
+			Log::Info("  {:<9}{:8.2f} ms  {:7.1f} MVert/s  {:6.2f} GB/s written  {:.2f}x",
+				name, seconds * 1e3, GetRate(vertexCount, seconds), static_cast<f64>(bytes) / seconds / 1e9, scalar / seconds);
+		};
+
+		Log::Info("Interleave position, normal and texcoord streams, {} vertices", vertexCount);
+		Report("scalar", scalar);
+		Report("simd", simd);
+		Report("parallel", parallel);
+	}
+}
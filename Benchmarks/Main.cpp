@@ -0,0 +1,55 @@
+#include "Benchmark.h"
+#include "Utils/Log.h"
+#include <array>
+#include <exception>
+#include <string_view>
+
+// Import pipeline benchmarks without a window, only the io suite creates a device to run full imports
+// Runs every suite, or only the suites named on the command line (e.g. "benchmarks textures io")
+int main(int argc, char** argv)
+{
+	using namespace Prism;
+
+	struct Suite
+	{
+		std::string_view Name;
+		void (*Run)();
+	};
+
+	constexpr std::array<Suite, 6> Suites
+	{
+		Suite{ "conversion", &Benchmarks::RunConversionBenchmarks },
+		Suite{ "vertices",   &Benchmarks::RunVertexBenchmarks },
+		Suite{ "overdraw",   &Benchmarks::RunOverdrawBenchmarks },
+		Suite{ "meshlets",   &Benchmarks::RunMeshletBenchmarks },
+		Suite{ "io",         &Benchmarks::RunIOBenchmarks },
+		Suite{ "textures",   &Benchmarks::RunTextureBenchmarks },
+	};
+
+	try
+	{
+		Log::Init();
+
+		for (const Suite& suite : Suites)
+		{
+			bool selected = argc <= 1;
+			for (int i = 1; i < argc && !selected; i++)
+			{
+				selected = suite.Name == argv[i];
+			}
+
+			if (selected)
+			{
+				Log::Info("[{}]", suite.Name);
+				suite.Run();
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		Log::Error("Exception thrown: {}", e.what());
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,67 @@
+#include "Benchmark.h"
+#include "Graphics/Camera.h"
+#include "Graphics/Importers/MeshletBuilder.h"
+#include "Graphics/Meshlet.h"
+#include "Utils/Log.h"
+#include <cmath>
+#include <numbers>
+
+namespace Prism::Benchmarks
+{
+	namespace
+	{
+		constexpr u32 ViewCount = 16;
+	}
+
+	void RunMeshletBenchmarks()
+	{
+		const SphereMesh sphere = MakeSphere(1024, 2048);
+		const u32 triangles     = sphere.GetTriangleCount();
+		constexpr u32 Stride    = 3 * sizeof(f32);
+
+		const auto Build = [&](const bool parallel)
+		{
+			return Gfx::MeshletBuilder::Build(sphere.Indices, sphere.Positions.data(), sphere.GetVertexCount(), Stride,
+				Gfx::MeshletBuilder::DefaultMaxVertices, Gfx::MeshletBuilder::DefaultMaxTriangles, parallel);
+		};
+
+		const f64 serial   = MeasureBest(3, [&] { (void)Build(false); });
+		const f64 parallel = MeasureBest(3, [&] { (void)Build(true); });
+		const std::vector<Gfx::Meshlet> meshlets = Build(true);
+
+		Log::Info("MeshletBuilder::Build, {} triangles into {} meshlets", triangles, meshlets.size());
+		Log::Info("  serial   {:8.2f} ms  {:7.2f} MTri/s", serial * 1e3, GetRate(triangles, serial));
+		Log::Info("  parallel {:8.2f} ms  {:7.2f} MTri/s  {:.2f}x", parallel * 1e3, GetRate(triangles, parallel), serial / parallel);
+
+		// Views circle the sphere at a distance where it fills most of the frustum, so frustum and cone tests both reject
+		std::vector<Gfx::MeshletCullContext> contexts;
+		for (u32 view = 0; view < ViewCount; view++)
+		{
+			const f32 angle = static_cast<f32>(view) / ViewCount * 2.0f * std::numbers::pi_v<f32>;
+			const Gfx::Camera camera(Gfx::Camera::CameraDesc
+			{
+				.Position = Vector3(std::cos(angle) * 2.5f, 0.5f, std::sin(angle) * 2.5f),
+				.LookAt   = Vector3(0.0f, 0.0f, 0.0f)
+			});
+			contexts.push_back(Gfx::MeshletCullContext::Create(camera, Matrix::Identity));
+		}
+
+		u64 visible = 0;
+		const f64 cull = MeasureBest(5, [&]
+		{
+			visible = 0;
+			for (const Gfx::MeshletCullContext& context : contexts)
+			{
+				for (const Gfx::Meshlet& meshlet : meshlets)
+				{
+					visible += context.IsVisible(meshlet) ? 1 : 0;
+				}
+			}
+		});
+
+		const u64 tested = u64{ ViewCount } * meshlets.size();
+		Log::Info("MeshletCullContext::IsVisible, {} views", ViewCount);
+		Log::Info("  cull     {:8.2f} ms  {:7.1f} MMeshlet/s  {:.1f}% visible",
+			cull * 1e3, GetRate(tested, cull), tested ? 100.0 * static_cast<f64>(visible) / static_cast<f64>(tested) : 0.0);
+	}
+}
@@ -0,0 +1,90 @@
+#include "Benchmark.h"
+#include "Graphics/Importers/MeshOptimizer.h"
+#include "Utils/Log.h"
+#include <array>
+#include <format>
+
+namespace Prism::Benchmarks
+{
+	namespace
+	{
+		constexpr u32 ClusterSize = 3;  // Spheres per axis
+		constexpr f32 Spacing     = 1.5f;
+
+		// MakeSphere winds triangles clockwise seen from outside, the front face convention of the importer
+		constexpr f32 FrontFaceSign = -1.0f;
+
+		constexpr std::array<f32, 4> Thresholds{ 1.0f, 1.05f, 1.1f, 1.25f };
+
+		// Overlapping spheres on a grid, every axis view looks through several of them so the triangle order decides
+		// how much of each sphere is shaded before the one in front of it covers it
+		NODISCARD SphereMesh MakeSphereCluster(const u32 rings, const u32 segments)
+		{
+			const SphereMesh sphere = MakeSphere(rings, segments);
+			const f32 offset = (static_cast<f32>(ClusterSize) - 1.0f) * Spacing * 0.5f;
+
+			SphereMesh cluster;
+			for (u32 i = 0; i < ClusterSize * ClusterSize * ClusterSize; i++)
+			{
+				const u32 baseVertex = cluster.GetVertexCount();
+				const f32 center[3]
+				{
+					static_cast<f32>(i % ClusterSize) * Spacing - offset,
+					static_cast<f32>(i / ClusterSize % ClusterSize) * Spacing - offset,
+					static_cast<f32>(i / (ClusterSize * ClusterSize)) * Spacing - offset
+				};
+
+				for (size_t v = 0; v < sphere.Positions.size(); v++)
+				{
+					cluster.Positions.push_back(sphere.Positions[v] + center[v % 3]);
+				}
+				for (const u32 index : sphere.Indices)
+				{
+					cluster.Indices.push_back(baseVertex + index);
+				}
+			}
+			return cluster;
+		}
+	}
+
+	void RunOverdrawBenchmarks()
+	{
+		const SphereMesh mesh   = MakeSphereCluster(64, 128);
+		const u32 vertexCount   = mesh.GetVertexCount();
+		constexpr u32 Stride    = 3 * sizeof(f32);
+
+		std::vector<u32> indices;
+		const auto Report = [&](const std::string_view name, const f64 seconds)
+		{
+			const f32 acmr = Gfx::MeshOptimizer::ComputeACMR(indices, vertexCount);
+			const Gfx::MeshOptimizer::OverdrawStats overdraw =
+				Gfx::MeshOptimizer::EstimateOverdraw(indices, mesh.Positions.data(), vertexCount, Stride, FrontFaceSign);
+			Log::Info("  {:<17}ACMR {:5.3f}  overdraw {:5.3f}  {:8.2f} ms", name, acmr, overdraw.Overdraw, seconds * 1e3);
+		};
+
+		Log::Info("MeshOptimizer overdraw, {} spheres, {} triangles, 6 views of {}x{}",
+			ClusterSize * ClusterSize * ClusterSize, mesh.GetTriangleCount(), Gfx::MeshOptimizer::OverdrawGridSize, Gfx::MeshOptimizer::OverdrawGridSize);
+
+		indices = mesh.Indices;
+		Report("source", 0.0);
+
+		const f64 cache = MeasureBest(1, [&]
+		{
+			indices = mesh.Indices;
+			Gfx::MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+		});
+		Report("cache", cache);
+
+		// Both passes together, the way the importer runs them with OptimizeOverdraw set
+		for (const f32 threshold : Thresholds)
+		{
+			const f64 seconds = MeasureBest(1, [&]
+			{
+				indices = mesh.Indices;
+				Gfx::MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+				Gfx::MeshOptimizer::OptimizeOverdraw(indices, mesh.Positions.data(), vertexCount, Stride, FrontFaceSign, threshold);
+			});
+			Report(std::format("cache+overdraw {:.2f}", threshold), seconds);
+		}
+	}
+}
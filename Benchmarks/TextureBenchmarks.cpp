@@ -0,0 +1,184 @@
+#include "Benchmark.h"
+#include "Graphics/Utils/BlockCompressor.h"
+#include "Utils/Log.h"
+#include <array>
+#include <cmath>
+#include <numbers>
+
+namespace Prism::Benchmarks
+{
+	namespace
+	{
+		constexpr u32 ImageSize = 1024;
+
+		struct TestImage
+		{
+			std::string_view Name;
+			std::vector<byte> Rgba;
+			std::vector<Gfx::BlockFormat> Formats;
+		};
+
+		NODISCARD byte ToByte(const f32 value) noexcept
+		{
+			return static_cast<byte>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+		}
+
+		// Smooth lattice noise from a fixed hash, enough octaves to give photo like detail at every block size
+		NODISCARD f32 ValueNoise(const f32 x, const f32 y) noexcept
+		{
+			const auto Hash = [](const i32 ix, const i32 iy)
+			{
+				u32 h = static_cast<u32>(ix) * 0x8DA6B343u ^ static_cast<u32>(iy) * 0xD8163841u;
+				h = (h ^ (h >> 13)) * 0x85EBCA6Bu;
+				return static_cast<f32>((h ^ (h >> 16)) & 0xFFFF) / 65535.0f;
+			};
+
+			f32 sum = 0.0f;
+			f32 amplitude = 0.5f;
+			f32 frequency = 1.0f / 64.0f;
+			for (u32 octave = 0; octave < 5; octave++)
+			{
+				const f32 fx = x * frequency;
+				const f32 fy = y * frequency;
+				const i32 ix = static_cast<i32>(std::floor(fx));
+				const i32 iy = static_cast<i32>(std::floor(fy));
+				const f32 tx = fx - static_cast<f32>(ix);
+				const f32 ty = fy - static_cast<f32>(iy);
+				const f32 sx = tx * tx * (3.0f - 2.0f * tx);
+				const f32 sy = ty * ty * (3.0f - 2.0f * ty);
+
+				const f32 top    = std::lerp(Hash(ix, iy), Hash(ix + 1, iy), sx);
+				const f32 bottom = std::lerp(Hash(ix, iy + 1), Hash(ix + 1, iy + 1), sx);
+				sum += std::lerp(top, bottom, sy) * amplitude;
+
+				amplitude *= 0.5f;
+				frequency *= 2.0f;
+			}
+			return sum;
+		}
+
+		template <typename Texel>
+		NODISCARD std::vector<byte> MakeImage(Texel&& texel)
+		{
+			std::vector<byte> rgba(size_t{ ImageSize } * ImageSize * 4);
+			for (u32 y = 0; y < ImageSize; y++)
+			{
+				for (u32 x = 0; x < ImageSize; x++)
+				{
+					const std::array<f32, 4> color = texel(static_cast<f32>(x), static_cast<f32>(y));
+					byte* out = rgba.data() + (size_t{ y } * ImageSize + x) * 4;
+					for (u32 c = 0; c < 4; c++)
+					{
+						out[c] = ToByte(color[c]);
+					}
+				}
+			}
+			return rgba;
+		}
+
+		NODISCARD std::vector<TestImage> MakeTestImages()
+		{
+			using enum Gfx::BlockFormat;
+			constexpr f32 Size = static_cast<f32>(ImageSize);
+
+			std::vector<TestImage> images;
+			images.push_back(TestImage
+			{
+				.Name    = "gradient",
+				.Rgba    = MakeImage([](const f32 x, const f32 y) { return std::array{ x / Size, y / Size, 1.0f - x / Size, 1.0f }; }),
+				.Formats = { BC1, BC3, BC7 }
+			});
+			images.push_back(TestImage
+			{
+				.Name    = "noise",
+				.Rgba    = MakeImage([](const f32 x, const f32 y)
+				{
+					return std::array{ ValueNoise(x, y), ValueNoise(x + 1000.0f, y), ValueNoise(x, y + 1000.0f), 1.0f };
+				}),
+				.Formats = { BC1, BC3, BC7 }
+			});
+			images.push_back(TestImage
+			{
+				.Name    = "cutout",
+				.Rgba    = MakeImage([](const f32 x, const f32 y)
+				{
+					const f32 distance = std::hypot(x - Size * 0.5f, y - Size * 0.5f) / Size;
+					const f32 value    = ValueNoise(x, y);
+					return std::array{ value, value * 0.8f, 0.3f, std::clamp((0.4f - distance) * 20.0f, 0.0f, 1.0f) };
+				}),
+				.Formats = { BC3, BC7 }
+			});
+			images.push_back(TestImage
+			{
+				.Name    = "normal",
+				.Rgba    = MakeImage([](const f32 x, const f32 y)
+				{
+					// Tangent space normal of a height field of overlapping ripples
+					constexpr f32 Scale = 2.0f * std::numbers::pi_v<f32> / 96.0f;
+					const f32 dx = std::cos(x * Scale) * 0.6f + ValueNoise(x, y) - 0.5f;
+					const f32 dy = std::cos(y * Scale * 1.7f) * 0.6f + ValueNoise(y, x) - 0.5f;
+					const f32 length = std::sqrt(dx * dx + dy * dy + 1.0f);
+					return std::array{ dx / length * 0.5f + 0.5f, dy / length * 0.5f + 0.5f, 1.0f / length * 0.5f + 0.5f, 1.0f };
+				}),
+				.Formats = { BC5 }
+			});
+			return images;
+		}
+
+		NODISCARD std::string_view GetFormatName(const Gfx::BlockFormat format) noexcept
+		{
+			switch (format)
+			{
+			case Gfx::BlockFormat::BC1: return "BC1";
+			case Gfx::BlockFormat::BC3: return "BC3";
+			case Gfx::BlockFormat::BC5: return "BC5";
+			case Gfx::BlockFormat::BC7: return "BC7";
+			default:                    return "?";
+			}
+		}
+
+		// Channels that carry data in the format, BC1 has no alpha worth comparing and BC5 only stores two channels
+		NODISCARD u32 GetComparedChannels(const Gfx::BlockFormat format) noexcept
+		{
+			switch (format)
+			{
+			case Gfx::BlockFormat::BC1: return 3;
+			case Gfx::BlockFormat::BC5: return 2;
+			default:                    return 4;
+			}
+		}
+	}
+
+	void RunTextureBenchmarks()
+	{
+		constexpr u64 Texels = u64{ ImageSize } * ImageSize;
+
+		std::vector<byte> blocks;
+		std::vector<byte> decoded(Texels * 4);
+
+		Log::Info("BlockCompressor, {}x{} images", ImageSize, ImageSize);
+		for (const TestImage& image : MakeTestImages())
+		{
+			for (const Gfx::BlockFormat format : image.Formats)
+			{
+				const DXGI_FORMAT dxgiFormat = Gfx::GetDxgiFormat(format);
+				blocks.resize(Gfx::GetSubresourceLayout(dxgiFormat, ImageSize, ImageSize, 0).Size);
+
+				const f64 serial = MeasureBest(3, [&]
+				{
+					Gfx::CompressImage(image.Rgba.data(), ImageSize, ImageSize, format, blocks.data(), false);
+				});
+				const f64 parallel = MeasureBest(3, [&]
+				{
+					Gfx::CompressImage(image.Rgba.data(), ImageSize, ImageSize, format, blocks.data(), true);
+				});
+
+				Gfx::DecompressImage(blocks.data(), ImageSize, ImageSize, format, decoded.data());
+				const f64 psnr = Gfx::ComputePsnr(image.Rgba.data(), decoded.data(), ImageSize, ImageSize, GetComparedChannels(format));
+
+				Log::Info("  {:<9}{}  {:6.2f} dB  serial {:7.2f} MTexel/s  parallel {:7.2f} MTexel/s",
+					image.Name, GetFormatName(format), psnr, GetRate(Texels, serial), GetRate(Texels, parallel));
+			}
+		}
+	}
+}
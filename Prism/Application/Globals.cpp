@@ -4,5 +4,4 @@ namespace Prism::Globals
 {
 	bool g_isCameraDebugOverlayOpen = true;
 	bool g_isCameraControlsWindowOpen = false;
-	int g_textureNumber = 0;
 }
@@ -4,5 +4,4 @@ namespace Prism::Globals
 {
 	extern bool g_isCameraDebugOverlayOpen;
 	extern bool g_isCameraControlsWindowOpen;
-	extern int g_textureNumber;
 }
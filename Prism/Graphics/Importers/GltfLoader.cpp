@@ -0,0 +1,681 @@
+#include "Graphics/Importers/GltfLoader.h"
+#include "Utils/Json.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <format>
+#include <string_view>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		constexpr u32 GlbMagic       = 0x46546C67;  // 'glTF'
+		constexpr u32 GlbVersion     = 2;
+		constexpr u32 GlbChunkJson   = 0x4E4F534A;  // 'JSON'
+		constexpr u32 GlbChunkBinary = 0x004E4942;  // 'BIN\0'
+
+		constexpr u32 ComponentUnsignedByte  = 5121;
+		constexpr u32 ComponentUnsignedShort = 5123;
+		constexpr u32 ComponentUnsignedInt   = 5125;
+		constexpr u32 ComponentFloat         = 5126;
+		constexpr u32 ModeTriangles          = 4;
+		constexpr u32 InvalidIndex           = ~0u;
+
+		struct GlbHeader
+		{
+			u32 Magic;
+			u32 Version;
+			u32 Length;
+		};
+
+		struct GlbChunkHeader
+		{
+			u32 Length;
+			u32 Type;
+		};
+
+		struct BufferView
+		{
+			std::span<const byte> Data;
+			u32 Stride = 0;  // 0 when tightly packed
+		};
+
+		using GltfError = GltfLoader::GltfError;
+
+		std::unexpected<GltfError> MakeError(const GltfError::Type type, const fs::path& path, const std::string_view reason)
+		{
+			return std::unexpected(GltfError
+			{
+				.Type      = type,
+				.ErrorCode = E_FAIL,
+				.Message   = std::format("{} {} ({})",
+					type == GltfError::Type::Unsupported ? "Unsupported glTF content in" : "Invalid glTF file",
+					path.string(),
+					reason)
+			});
+		}
+
+		u32 GetComponentCount(const std::string_view type) noexcept
+		{
+			if (type == "SCALAR") return 1;
+			if (type == "VEC2")   return 2;
+			if (type == "VEC3")   return 3;
+			if (type == "VEC4")   return 4;
+			return 0;
+		}
+
+		u32 GetComponentSize(const u32 componentType) noexcept
+		{
+			switch (componentType)
+			{
+			case ComponentUnsignedByte:  return 1;
+			case ComponentUnsignedShort: return 2;
+			case ComponentUnsignedInt:
+			case ComponentFloat:         return 4;
+			default:                     return 0;
+			}
+		}
+
+		u32 GetIndex(const Json::Value& object, const std::string_view key) noexcept
+		{
+			const Json::Value* value = object.Find(key);
+			return value ? value->AsU32(InvalidIndex) : InvalidIndex;
+		}
+
+		// Reads up to 'count' numbers of an optional array member, missing or short arrays keep the fallback values
+		void ReadNumbers(const Json::Value& object, const std::string_view key, f32* out, const size_t count) noexcept
+		{
+			if (const Json::Value* value = object.Find(key))
+			{
+				const std::span<const Json::Value> numbers = value->AsArray();
+				for (size_t i = 0; i < std::min(count, numbers.size()); i++)
+				{
+					out[i] = static_cast<f32>(numbers[i].AsNumber(out[i]));
+				}
+			}
+		}
+
+		// Local transform of a node, for row vectors. glTF stores column major matrices for column vectors, which is
+		// the same memory layout
+		Matrix GetNodeTransform(const Json::Value& node) noexcept
+		{
+			if (node.Find("matrix"))
+			{
+				Matrix matrix;
+				ReadNumbers(node, "matrix", &matrix._11, 16);
+				return matrix;
+			}
+
+			Vector3 translation;
+			Quaternion rotation;
+			Vector3 scale = Vector3::One;
+			ReadNumbers(node, "translation", &translation.x, 3);
+			ReadNumbers(node, "rotation", &rotation.x, 4);
+			ReadNumbers(node, "scale", &scale.x, 3);
+
+			return Matrix::CreateScale(scale) * Matrix::CreateFromQuaternion(rotation) * Matrix::CreateTranslation(translation);
+		}
+
+		// Relative URIs may percent encode reserved characters, spaces in file names being the usual one
+		Elos::String DecodeUri(const std::string_view uri)
+		{
+			Elos::String decoded;
+			decoded.reserve(uri.size());
+
+			for (size_t i = 0; i < uri.size(); i++)
+			{
+				u32 value = 0;
+				if (uri[i] == '%' && i + 2 < uri.size() &&
+					std::from_chars(uri.data() + i + 1, uri.data() + i + 3, value, 16).ptr == uri.data() + i + 3)
+				{
+					decoded.push_back(static_cast<char>(value));
+					i += 2;
+				}
+				else
+				{
+					decoded.push_back(uri[i]);
+				}
+			}
+
+			return decoded;
+		}
+	}
+
+	bool GltfLoader::IsGltfFile(const fs::path& path)
+	{
+		Elos::String extension = path.extension().string();
+		std::ranges::transform(extension, extension.begin(), [](const char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+		return extension == ".gltf" || extension == ".glb";
+	}
+
+	std::expected<GltfLoader::Document, GltfLoader::GltfError> GltfLoader::Load(const fs::path& path)
+	{
+		Document document;
+
+		auto fileResult = MappedFile::Open(path);
+		if (!fileResult)
+		{
+			return std::unexpected(GltfError
+			{
+				.Type      = GltfError::Type::OpenFailed,
+				.ErrorCode = fileResult.error().ErrorCode,
+				.Message   = fileResult.error().Message
+			});
+		}
+
+		const std::span<const byte> file = document.Files.emplace_back(std::move(fileResult.value())).GetData();
+
+		// GLB: 12 byte header, a JSON chunk and an optional binary chunk that backs buffer 0
+		std::string_view json(reinterpret_cast<const char*>(file.data()), file.size());
+		std::span<const byte> binaryChunk;
+
+		GlbHeader glbHeader{};
+		if (file.size() >= sizeof(GlbHeader))
+		{
+			std::memcpy(&glbHeader, file.data(), sizeof(GlbHeader));
+		}
+
+		if (glbHeader.Magic == GlbMagic)
+		{
+			if (glbHeader.Version != GlbVersion)
+			{
+				return MakeError(GltfError::Type::Unsupported, path, "GLB version is not 2");
+			}
+
+			if (glbHeader.Length > file.size())
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "GLB length exceeds the file size");
+			}
+
+			json = {};
+			size_t offset = sizeof(GlbHeader);
+			while (offset + sizeof(GlbChunkHeader) <= glbHeader.Length)
+			{
+				GlbChunkHeader chunk;
+				std::memcpy(&chunk, file.data() + offset, sizeof(GlbChunkHeader));
+				offset += sizeof(GlbChunkHeader);
+
+				if (chunk.Length > glbHeader.Length - offset)
+				{
+					return MakeError(GltfError::Type::InvalidFormat, path, "GLB chunk out of range");
+				}
+
+				if (chunk.Type == GlbChunkJson && json.empty())
+				{
+					json = std::string_view(reinterpret_cast<const char*>(file.data() + offset), chunk.Length);
+				}
+				else if (chunk.Type == GlbChunkBinary && binaryChunk.empty())
+				{
+					binaryChunk = file.subspan(offset, chunk.Length);
+				}
+
+				offset += (chunk.Length + 3) & ~size_t{ 3 };
+			}
+
+			if (json.empty())
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "GLB has no JSON chunk");
+			}
+		}
+
+		auto jsonResult = Json::Parse(json);
+		if (!jsonResult)
+		{
+			return MakeError(GltfError::Type::InvalidFormat, path, jsonResult.error().Message);
+		}
+
+		const Json::Value& root = jsonResult.value();
+		const auto GetArray = [&root](const std::string_view key) -> std::span<const Json::Value>
+		{
+			const Json::Value* value = root.Find(key);
+			return value ? value->AsArray() : std::span<const Json::Value>{};
+		};
+
+		const Json::Value* asset = root.Find("asset");
+		if (!asset || !asset->Find("version") || !asset->Find("version")->AsString().starts_with("2."))
+		{
+			return MakeError(GltfError::Type::Unsupported, path, "asset version is not 2.x");
+		}
+
+		// Compression (Draco, meshopt), quantization and the like change how accessors are read
+		if (const Json::Value* required = root.Find("extensionsRequired"); required && !required->AsArray().empty())
+		{
+			return MakeError(GltfError::Type::Unsupported, path,
+				std::format("requires extension {}", required->AsArray().front().AsString("?")));
+		}
+
+		// Buffers
+		std::vector<std::span<const byte>> buffers;
+		const std::span<const Json::Value> bufferDescs = GetArray("buffers");
+		buffers.reserve(bufferDescs.size());
+
+		for (size_t i = 0; i < bufferDescs.size(); i++)
+		{
+			const Json::Value& desc = bufferDescs[i];
+			const u32 byteLength    = GetIndex(desc, "byteLength");
+			const Json::Value* uri  = desc.Find("uri");
+
+			std::span<const byte> data;
+			if (!uri)
+			{
+				if (i != 0 || binaryChunk.empty())
+				{
+					return MakeError(GltfError::Type::InvalidFormat, path, "buffer without uri outside of a GLB");
+				}
+				data = binaryChunk;
+			}
+			else if (uri->AsString().starts_with("data:"))
+			{
+				return MakeError(GltfError::Type::Unsupported, path, "base64 data URI buffer");
+			}
+			else
+			{
+				const fs::path bufferPath = path.parent_path() / fs::path(DecodeUri(uri->AsString()));
+				document.Sidecars.push_back(bufferPath);
+				auto bufferResult = MappedFile::Open(bufferPath);
+				if (!bufferResult)
+				{
+					return std::unexpected(GltfError
+					{
+						.Type      = GltfError::Type::OpenFailed,
+						.ErrorCode = bufferResult.error().ErrorCode,
+						.Message   = bufferResult.error().Message
+					});
+				}
+				data = document.Files.emplace_back(std::move(bufferResult.value())).GetData();
+			}
+
+			if (byteLength == InvalidIndex || byteLength > data.size())
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "buffer is smaller than its byteLength");
+			}
+
+			buffers.push_back(data.first(byteLength));
+		}
+
+		// Buffer views
+		std::vector<BufferView> bufferViews;
+		const std::span<const Json::Value> bufferViewDescs = GetArray("bufferViews");
+		bufferViews.reserve(bufferViewDescs.size());
+
+		for (const Json::Value& desc : bufferViewDescs)
+		{
+			const u32 buffer     = GetIndex(desc, "buffer");
+			const u32 byteLength = GetIndex(desc, "byteLength");
+			const Json::Value* byteOffset = desc.Find("byteOffset");
+			const u64 offset     = byteOffset ? byteOffset->AsU32(InvalidIndex) : 0;
+
+			if (buffer >= buffers.size() || byteLength == InvalidIndex || offset == InvalidIndex ||
+				offset + byteLength > buffers[buffer].size())
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "bufferView out of range");
+			}
+
+			const Json::Value* byteStride = desc.Find("byteStride");
+			bufferViews.push_back(BufferView
+			{
+				.Data   = buffers[buffer].subspan(offset, byteLength),
+				.Stride = byteStride ? byteStride->AsU32(0) : 0
+			});
+		}
+
+		// Accessors, resolved lazily since only mesh attributes are read
+		const std::span<const Json::Value> accessors = GetArray("accessors");
+
+		struct AccessorData
+		{
+			const byte* Data   = nullptr;
+			u32 Count          = 0;
+			u32 Stride         = 0;
+			u32 ComponentType  = 0;
+			u32 ComponentCount = 0;
+		};
+
+		const auto ReadAccessor = [&](const u32 index) -> std::expected<AccessorData, GltfError>
+		{
+			if (index >= accessors.size())
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "accessor index out of range");
+			}
+
+			const Json::Value& desc = accessors[index];
+			if (desc.Find("sparse"))
+			{
+				return MakeError(GltfError::Type::Unsupported, path, "sparse accessor");
+			}
+
+			const u32 bufferView = GetIndex(desc, "bufferView");
+			if (bufferView == InvalidIndex)
+			{
+				return MakeError(GltfError::Type::Unsupported, path, "accessor without bufferView");
+			}
+
+			AccessorData data;
+			data.Count          = GetIndex(desc, "count");
+			data.ComponentType  = GetIndex(desc, "componentType");
+			data.ComponentCount = GetComponentCount(desc.Find("type") ? desc.Find("type")->AsString() : std::string_view{});
+
+			const u32 elementSize = GetComponentSize(data.ComponentType) * data.ComponentCount;
+			const Json::Value* byteOffset = desc.Find("byteOffset");
+			const u64 offset = byteOffset ? byteOffset->AsU32(InvalidIndex) : 0;
+
+			if (bufferView >= bufferViews.size() || data.Count == InvalidIndex || data.Count == 0 ||
+				elementSize == 0 || offset == InvalidIndex)
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "malformed accessor");
+			}
+
+			const BufferView& view = bufferViews[bufferView];
+			data.Stride = view.Stride != 0 ? view.Stride : elementSize;
+
+			if (data.Stride < elementSize || offset + u64{ data.Stride } * (data.Count - 1) + elementSize > view.Data.size())
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "accessor out of range");
+			}
+
+			data.Data = view.Data.data() + offset;
+			return data;
+		};
+
+		const auto ReadAttribute = [&](const Json::Value& attributes, const std::string_view name, const u32 componentCount)
+			-> std::expected<AttributeView, GltfError>
+		{
+			const u32 accessor = GetIndex(attributes, name);
+			if (accessor == InvalidIndex)
+			{
+				return AttributeView{};
+			}
+
+			auto data = ReadAccessor(accessor);
+			if (!data)
+			{
+				return std::unexpected(data.error());
+			}
+
+			if (data->ComponentCount != componentCount || data->ComponentType != ComponentFloat)
+			{
+				return MakeError(GltfError::Type::Unsupported, path, std::format("non float {} attribute", name));
+			}
+
+			return AttributeView{ .Data = data->Data, .Count = data->Count, .Stride = data->Stride };
+		};
+
+		// Meshes, every glTF primitive becomes one importer mesh like Assimp does
+		const std::span<const Json::Value> meshes = GetArray("meshes");
+		std::vector<u32> firstPrimitiveSlot(meshes.size() + 1, 0);
+		for (size_t i = 0; i < meshes.size(); i++)
+		{
+			const Json::Value* primitives = meshes[i].Find("primitives");
+			firstPrimitiveSlot[i + 1] = firstPrimitiveSlot[i] + static_cast<u32>(primitives ? primitives->AsArray().size() : 0);
+		}
+
+		std::vector<u32> slots(firstPrimitiveSlot.back(), InvalidIndex);
+
+		// Primitives without a material use the default one Assimp appends after the file's materials
+		const u32 defaultMaterial = static_cast<u32>(GetArray("materials").size());
+
+		const auto AddPrimitive = [&](const Json::Value& desc) -> std::expected<void, GltfError>
+		{
+			const Json::Value* mode = desc.Find("mode");
+			if (mode && mode->AsU32(InvalidIndex) != ModeTriangles)
+			{
+				return MakeError(GltfError::Type::Unsupported, path, "primitive is not a triangle list");
+			}
+
+			const Json::Value* attributes = desc.Find("attributes");
+			if (!attributes)
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "primitive without attributes");
+			}
+
+			MeshStreams primitive;
+			auto positions = ReadAttribute(*attributes, "POSITION", 3);
+			auto normals   = ReadAttribute(*attributes, "NORMAL", 3);
+			auto tangents  = ReadAttribute(*attributes, "TANGENT", 4);
+			auto texCoords = ReadAttribute(*attributes, "TEXCOORD_0", 2);
+
+			for (auto* attribute : { &positions, &normals, &tangents, &texCoords })
+			{
+				if (!*attribute)
+				{
+					return std::unexpected(attribute->error());
+				}
+			}
+
+			primitive.Positions = positions.value();
+			primitive.Normals   = normals.value();
+			primitive.Tangents  = tangents.value();
+			primitive.TexCoords = texCoords.value();
+
+			const u32 material      = GetIndex(desc, "material");
+			primitive.MaterialIndex = material < defaultMaterial ? material : defaultMaterial;
+
+			if (!primitive.Positions.IsValid())
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "primitive without POSITION");
+			}
+
+			const u32 vertexCount = primitive.Positions.Count;
+			for (const AttributeView* attribute : { &primitive.Normals, &primitive.Tangents, &primitive.TexCoords })
+			{
+				if (attribute->IsValid() && attribute->Count != vertexCount)
+				{
+					return MakeError(GltfError::Type::InvalidFormat, path, "attribute counts differ");
+				}
+			}
+
+			if (const u32 accessor = GetIndex(desc, "indices"); accessor != InvalidIndex)
+			{
+				auto data = ReadAccessor(accessor);
+				if (!data)
+				{
+					return std::unexpected(data.error());
+				}
+
+				const u32 indexSize = GetComponentSize(data->ComponentType);
+				if (data->ComponentCount != 1 || data->ComponentType == ComponentFloat || data->Stride != indexSize)
+				{
+					return MakeError(GltfError::Type::InvalidFormat, path, "malformed index accessor");
+				}
+
+				primitive.Indices = IndexView{ .Data = data->Data, .Count = data->Count, .IndexSize = indexSize };
+
+				// Out of range indices would make every later pass read out of bounds
+				u32 maxIndex = 0;
+				for (u32 i = 0; i < data->Count; i++)
+				{
+					u32 index = 0;
+					std::memcpy(&index, data->Data + size_t{ i } * indexSize, indexSize);
+					maxIndex = std::max(maxIndex, index);
+				}
+
+				if (maxIndex >= vertexCount)
+				{
+					return MakeError(GltfError::Type::InvalidFormat, path, "index out of range");
+				}
+			}
+
+			const u32 indexCount = primitive.Indices.IsValid() ? primitive.Indices.Count : vertexCount;
+			if (indexCount % 3 != 0)
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "triangle list index count is not a multiple of 3");
+			}
+
+			document.Primitives.push_back(primitive);
+			return {};
+		};
+
+		// Nodes, visited depth first like MeshImporter::ProcessNode, with their world transform
+		const std::span<const Json::Value> nodes = GetArray("nodes");
+		std::vector<bool> visited(nodes.size(), false);
+		std::vector<std::pair<u32, Matrix>> stack;
+
+		const auto VisitNode = [&](const u32 rootNode) -> std::expected<void, GltfError>
+		{
+			stack.assign(1, { rootNode, Matrix::Identity });
+			while (!stack.empty())
+			{
+				const auto [node, parentTransform] = stack.back();
+				stack.pop_back();
+
+				// Nodes form disjoint trees, a second visit means the file is malformed
+				if (node >= nodes.size() || visited[node])
+				{
+					return MakeError(GltfError::Type::InvalidFormat, path, "invalid node hierarchy");
+				}
+				visited[node] = true;
+
+				const Matrix transform = GetNodeTransform(nodes[node]) * parentTransform;
+
+				if (const u32 mesh = GetIndex(nodes[node], "mesh"); mesh != InvalidIndex)
+				{
+					if (mesh >= meshes.size())
+					{
+						return MakeError(GltfError::Type::InvalidFormat, path, "mesh index out of range");
+					}
+
+					const u32 primitiveCount = firstPrimitiveSlot[mesh + 1] - firstPrimitiveSlot[mesh];
+					for (u32 i = 0; i < primitiveCount; i++)
+					{
+						u32& slot = slots[firstPrimitiveSlot[mesh] + i];
+						if (slot == InvalidIndex)
+						{
+							slot = static_cast<u32>(document.Primitives.size());
+							if (auto result = AddPrimitive(meshes[mesh].Find("primitives")->AsArray()[i]); !result)
+							{
+								return result;
+							}
+						}
+						document.PrimitiveInstances.push_back(slot);
+						document.InstanceTransforms.push_back(transform);
+					}
+				}
+
+				if (const Json::Value* children = nodes[node].Find("children"))
+				{
+					const std::span<const Json::Value> childList = children->AsArray();
+					for (auto it = childList.rbegin(); it != childList.rend(); ++it)
+					{
+						stack.emplace_back(it->AsU32(InvalidIndex), transform);
+					}
+				}
+			}
+
+			return {};
+		};
+
+		const std::span<const Json::Value> scenes = GetArray("scenes");
+		const u32 sceneIndex = root.Find("scene") ? root.Find("scene")->AsU32(InvalidIndex) : 0;
+
+		if (sceneIndex < scenes.size())
+		{
+			const Json::Value* sceneNodes = scenes[sceneIndex].Find("nodes");
+			for (const Json::Value& node : sceneNodes ? sceneNodes->AsArray() : std::span<const Json::Value>{})
+			{
+				if (auto result = VisitNode(node.AsU32(InvalidIndex)); !result)
+				{
+					return std::unexpected(result.error());
+				}
+			}
+		}
+		else
+		{
+			// No default scene, every node without a parent is a root
+			std::vector<bool> isChild(nodes.size(), false);
+			for (const Json::Value& node : nodes)
+			{
+				const Json::Value* children = node.Find("children");
+				for (const Json::Value& child : children ? children->AsArray() : std::span<const Json::Value>{})
+				{
+					if (const u32 index = child.AsU32(InvalidIndex); index < nodes.size())
+					{
+						isChild[index] = true;
+					}
+				}
+			}
+
+			for (u32 node = 0; node < nodes.size(); node++)
+			{
+				if (!isChild[node])
+				{
+					if (auto result = VisitNode(node); !result)
+					{
+						return std::unexpected(result.error());
+					}
+				}
+			}
+		}
+
+		// Images stored in buffers (GLB and some .gltf exports) match what Assimp exposes as embedded textures
+		const std::span<const Json::Value> images = GetArray("images");
+		std::vector<u32> imageSlots(images.size(), MaterialSource::NoTexture);
+		for (size_t i = 0; i < images.size(); i++)
+		{
+			const Json::Value& desc = images[i];
+			if (const Json::Value* uri = desc.Find("uri"))
+			{
+				if (uri->AsString().starts_with("data:"))
+				{
+					return MakeError(GltfError::Type::Unsupported, path, "base64 data URI image");
+				}
+				continue;
+			}
+
+			const u32 bufferView = GetIndex(desc, "bufferView");
+			if (bufferView >= bufferViews.size())
+			{
+				return MakeError(GltfError::Type::InvalidFormat, path, "image bufferView out of range");
+			}
+
+			const Json::Value* name = desc.Find("name");
+			imageSlots[i] = static_cast<u32>(document.Images.size());
+			document.Images.push_back(Image
+			{
+				.Name = name && name->IsString() ? Elos::String(name->AsString()) : "EmbeddedTexture_" + std::to_string(i),
+				.Data = bufferViews[bufferView].Data
+			});
+		}
+
+		// Materials, textures resolve to the images loaded above
+		const std::span<const Json::Value> textures = GetArray("textures");
+		const auto GetTextureSlot = [&](const Json::Value* textureInfo) -> u32
+		{
+			const u32 texture = textureInfo ? GetIndex(*textureInfo, "index") : InvalidIndex;
+			const u32 image   = texture < textures.size() ? GetIndex(textures[texture], "source") : InvalidIndex;
+			return image < imageSlots.size() ? imageSlots[image] : MaterialSource::NoTexture;
+		};
+
+		const std::span<const Json::Value> materials = GetArray("materials");
+		document.Materials.reserve(materials.size() + 1);
+		for (size_t i = 0; i < materials.size(); i++)
+		{
+			const Json::Value& desc = materials[i];
+			const Json::Value* name = desc.Find("name");
+
+			MaterialSource& material = document.Materials.emplace_back();
+			material.Name = name && name->IsString() ? Elos::String(name->AsString()) : "Material_" + std::to_string(i);
+
+			// glTF defaults metallic and roughness to 1 when they are not given
+			const Json::Value* pbr = desc.Find("pbrMetallicRoughness");
+			const Json::Value* metallic  = pbr ? pbr->Find("metallicFactor") : nullptr;
+			const Json::Value* roughness = pbr ? pbr->Find("roughnessFactor") : nullptr;
+			material.Metallic  = metallic ? static_cast<f32>(metallic->AsNumber(1.0)) : 1.0f;
+			material.Roughness = roughness ? static_cast<f32>(roughness->AsNumber(1.0)) : 1.0f;
+
+			if (pbr)
+			{
+				ReadNumbers(*pbr, "baseColorFactor", &material.BaseColor.x, 4);
+				material.BaseColorTexture = GetTextureSlot(pbr->Find("baseColorTexture"));
+			}
+			ReadNumbers(desc, "emissiveFactor", &material.Emissive.x, 3);
+			material.NormalTexture = GetTextureSlot(desc.Find("normalTexture"));
+		}
+
+		// The default material used by primitives without one, see defaultMaterial
+		document.Materials.emplace_back().Name = "DefaultMaterial";
+
+		return document;
+	}
+}
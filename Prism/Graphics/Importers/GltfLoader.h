@@ -0,0 +1,56 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Graphics/Importers/MeshStreams.h"
+#include "Math/Math.h"
+#include "Utils/MappedFile.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/String.h>
+#include <expected>
+#include <span>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	// Reads glTF 2.0 (.gltf + .bin) and GLB files without going through Assimp
+	// Buffers are memory mapped and every accessor is exposed as a typed, strided view into the mapping,
+	// so nothing is copied until the importer builds its final vertex and index streams
+	class GltfLoader
+	{
+	public:
+		struct GltfError
+		{
+			enum class Type
+			{
+				OpenFailed,
+				InvalidFormat,
+				Unsupported  // Valid glTF using features this loader does not read, import through Assimp instead
+			};
+
+			Type Type;
+			HRESULT ErrorCode;
+			Elos::String Message;
+		};
+
+		struct Image
+		{
+			Elos::String Name;
+			std::span<const byte> Data;  // Encoded png/jpg, read through WIC
+		};
+
+		struct Document
+		{
+			std::vector<MeshStreams> Primitives;  // Unique primitives in order of their first node reference, views into Files
+			std::vector<u32> PrimitiveInstances;  // One entry per node reference, indexes Primitives
+			std::vector<Matrix> InstanceTransforms;  // World transform of every node reference, in glTF's right handed space
+			std::vector<Image> Images;  // Only images stored in buffers, external image files are not loaded
+			std::vector<MaterialSource> Materials;  // The file's materials followed by the default one, textures index Images
+
+			std::vector<MappedFile> Files;  // Keeps the views above alive
+			std::vector<fs::path> Sidecars;  // External .bin buffers, the mesh cache is only valid while they are unchanged
+		};
+
+	public:
+		static NODISCARD bool IsGltfFile(const fs::path& path);
+		static NODISCARD std::expected<Document, GltfError> Load(const fs::path& path);
+	};
+}
@@ -0,0 +1,54 @@
+#include "Graphics/Importers/ImportReport.h"
+#include "Utils/Json.h"
+#include <Windows.h>
+#include <Psapi.h>
+#include <format>
+
+namespace Prism::Gfx
+{
+	void ImportReport::AddPhase(const std::string_view name, const f64 seconds, const u64 bytes)
+	{
+		Phases.push_back(Phase{ .Name = Elos::String(name), .Seconds = seconds, .Bytes = bytes });
+	}
+
+	const ImportReport::Phase* ImportReport::FindPhase(const std::string_view name) const noexcept
+	{
+		for (const Phase& phase : Phases)
+		{
+			if (phase.Name == name)
+			{
+				return &phase;
+			}
+		}
+		return nullptr;
+	}
+
+	Elos::String ImportReport::ToJson() const
+	{
+		Elos::String json = std::format(
+			"{{\"file\":{},\"source\":{},\"totalSeconds\":{},\"fileBytes\":{},\"meshCount\":{},\"textureCount\":{},"
+			"\"sharedTextures\":{},\"vertexBytes\":{},\"indexBytes\":{},\"textureBytes\":{},\"peakMemoryBytes\":{},\"phases\":[",
+			Json::Quote(File), Json::Quote(Source), TotalSeconds, FileBytes, MeshCount, TextureCount,
+			SharedTextures, VertexBytes, IndexBytes, TextureBytes, PeakMemoryBytes);
+
+		for (size_t i = 0; i < Phases.size(); i++)
+		{
+			const Phase& phase = Phases[i];
+			json += std::format("{}{{\"name\":{},\"seconds\":{},\"bytes\":{}}}",
+				i == 0 ? "" : ",", Json::Quote(phase.Name), phase.Seconds, phase.Bytes);
+		}
+
+		json += "]}";
+		return json;
+	}
+
+	u64 ImportReport::QueryPeakMemory() noexcept
+	{
+		PROCESS_MEMORY_COUNTERS counters{};
+		if (!::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters)))
+		{
+			return 0;
+		}
+		return static_cast<u64>(counters.PeakWorkingSetSize);
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/String.h>
+#include <string_view>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	// Phase timings and byte counts of one MeshImporter::Import call, meant for tracking import regressions
+	// Phase names are dotted paths ("Assimp.Read", "Convert.Vertices", "Upload.Textures"...). Per mesh phases
+	// run on the worker pool and report CPU seconds summed over workers, every other phase is wall time
+	struct ImportReport
+	{
+		struct Phase
+		{
+			Elos::String Name;
+			f64 Seconds = 0.0;
+			u64 Bytes   = 0;  // Bytes consumed or produced by the phase, 0 when it does not apply
+		};
+
+		Elos::String File;
+		Elos::String Source;        // "cache", "gltf", "obj" or "assimp"
+		std::vector<Phase> Phases;  // In execution order
+		f64 TotalSeconds    = 0.0;
+		u64 FileBytes       = 0;
+		u32 MeshCount       = 0;    // Unique meshes, before instancing
+		u32 TextureCount    = 0;
+		u32 SharedTextures  = 0;    // Textures reused from the ResourceFactory texture cache instead of created
+		u64 VertexBytes     = 0;
+		u64 IndexBytes      = 0;
+		u64 TextureBytes    = 0;    // Source texture data, encoded images count their file size
+		u64 PeakMemoryBytes = 0;    // Process wide peak working set when the import finished
+
+		void AddPhase(const std::string_view name, const f64 seconds, const u64 bytes = 0);
+		NODISCARD const Phase* FindPhase(const std::string_view name) const noexcept;
+		NODISCARD Elos::String ToJson() const;
+
+		static NODISCARD u64 QueryPeakMemory() noexcept;
+	};
+}
@@ -0,0 +1,138 @@
+#include "Graphics/Importers/MappedIOSystem.h"
+#include "Utils/MappedFile.h"
+#include <assimp/IOStream.hpp>
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		class MappedIOStream final : public Assimp::IOStream
+		{
+		public:
+			MappedIOStream(MappedFile&& file, MappedIOSystem::Statistics& statistics) noexcept
+				: m_file(std::move(file))
+				, m_statistics(statistics)
+			{
+				Readahead(0);
+			}
+
+			size_t Read(void* buffer, const size_t size, const size_t count) override
+			{
+				if (size == 0 || m_cursor >= m_file.GetSize())
+				{
+					return 0;
+				}
+
+				// Only whole elements are read, like fread
+				const size_t elements = std::min(count, (m_file.GetSize() - m_cursor) / size);
+				const size_t bytes    = elements * size;
+
+				Readahead(m_cursor + bytes);
+				std::memcpy(buffer, m_file.GetData().data() + m_cursor, bytes);
+
+				m_cursor += bytes;
+				m_statistics.BytesRead += bytes;
+				return elements;
+			}
+
+			size_t Write(const void*, size_t, size_t) override
+			{
+				return 0;
+			}
+
+			aiReturn Seek(const size_t offset, const aiOrigin origin) override
+			{
+				size_t target = 0;
+				switch (origin)
+				{
+				case aiOrigin_SET: target = offset; break;
+				case aiOrigin_CUR: target = m_cursor + offset; break;
+				case aiOrigin_END: target = m_file.GetSize() - offset; break;
+				default: return aiReturn_FAILURE;
+				}
+
+				if (target > m_file.GetSize())
+				{
+					return aiReturn_FAILURE;
+				}
+
+				m_cursor = target;
+				return aiReturn_SUCCESS;
+			}
+
+			NODISCARD size_t Tell() const override
+			{
+				return m_cursor;
+			}
+
+			NODISCARD size_t FileSize() const override
+			{
+				return m_file.GetSize();
+			}
+
+			void Flush() override
+			{
+			}
+
+		private:
+			// Keeps at least half a window prefetched past 'end', issuing whole windows so requests stay large
+			void Readahead(const size_t end) noexcept
+			{
+				constexpr size_t Window = MappedIOSystem::ReadaheadSize;
+				if (m_prefetchedEnd >= m_file.GetSize() || end + Window / 2 <= m_prefetchedEnd)
+				{
+					return;
+				}
+
+				const size_t begin = std::max(m_prefetchedEnd, m_cursor);
+				m_prefetchedEnd    = std::min(m_file.GetSize(), end + Window);
+				m_file.Prefetch(begin, m_prefetchedEnd - begin);
+			}
+
+		private:
+			MappedFile m_file;
+			MappedIOSystem::Statistics& m_statistics;
+			size_t m_cursor        = 0;
+			size_t m_prefetchedEnd = 0;
+		};
+	}
+
+	bool MappedIOSystem::Exists(const char* file) const
+	{
+		std::error_code error;
+		return fs::is_regular_file(fs::path(file), error);
+	}
+
+	char MappedIOSystem::getOsSeparator() const
+	{
+		return '\\';
+	}
+
+	Assimp::IOStream* MappedIOSystem::Open(const char* file, const char* mode)
+	{
+		// Importers only ever read, anything else has no mapping to serve it
+		if (std::string_view(mode ? mode : "rb").find_first_of("wa+") != std::string_view::npos)
+		{
+			return nullptr;
+		}
+
+		const fs::path& path = m_openedFiles.emplace_back(file);
+		auto fileResult = MappedFile::Open(path);
+		if (!fileResult)
+		{
+			return nullptr;
+		}
+
+		m_statistics.FilesOpened++;
+		m_statistics.BytesMapped += fileResult.value().GetSize();
+		return new MappedIOStream(std::move(fileResult.value()), m_statistics);
+	}
+
+	void MappedIOSystem::Close(Assimp::IOStream* file)
+	{
+		delete file;
+	}
+}
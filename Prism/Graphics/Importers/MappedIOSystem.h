@@ -0,0 +1,41 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <assimp/IOSystem.hpp>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	// Assimp file system that serves every read (the source file and sidecars like .bin, .mtl or textures)
+	// from a memory mapping instead of buffered stream I/O. Reads are prefetched ReadaheadSize bytes ahead
+	// of the cursor, so cold files stream in with large sequential reads
+	class MappedIOSystem final : public Assimp::IOSystem
+	{
+	public:
+		struct Statistics
+		{
+			u32 FilesOpened = 0;
+			u64 BytesMapped = 0;  // Total size of the opened files
+			u64 BytesRead   = 0;  // Bytes copied out to Assimp
+		};
+
+		static constexpr size_t ReadaheadSize = 8 * 1024 * 1024;
+
+	public:
+		NODISCARD bool Exists(const char* file) const override;
+		NODISCARD char getOsSeparator() const override;
+		Assimp::IOStream* Open(const char* file, const char* mode = "rb") override;
+		void Close(Assimp::IOStream* file) override;
+
+		inline NODISCARD const Statistics& GetStatistics() const noexcept { return m_statistics; }
+
+		// Every file Assimp asked to read, including ones that failed to open
+		inline NODISCARD std::span<const std::filesystem::path> GetOpenedFiles() const noexcept { return m_openedFiles; }
+
+	private:
+		Statistics m_statistics;
+		std::vector<std::filesystem::path> m_openedFiles;
+	};
+}
@@ -0,0 +1,523 @@
+#include "Graphics/Importers/MeshCache.h"
+#include "Graphics/Utils/BlockCompressor.h"
+#include "Graphics/Utils/MipGenerator.h"
+#include "Utils/Hash.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <string_view>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		inline bool IsRangeValid(const u64 offset, const u64 size, const u64 fileSize) noexcept
+		{
+			return offset <= fileSize && size <= fileSize - offset;
+		}
+
+		// Missing files hash to 0, so a sidecar that appears later still invalidates the cache
+		u64 HashFile(const fs::path& path)
+		{
+			auto fileResult = MappedFile::Open(path);
+			return fileResult ? Hash::XXH64(fileResult.value().GetData()) : 0;
+		}
+
+		class BlobWriter
+		{
+		public:
+			explicit BlobWriter(std::ofstream& stream) : m_stream(stream) {}
+
+			u64 Write(const void* data, const u64 size, const u64 alignment = MeshCache::BlobAlignment)
+			{
+				static constexpr char zeros[MeshCache::BlobAlignment]{};
+				const u64 padding = (alignment - (m_offset % alignment)) % alignment;
+				m_stream.write(zeros, static_cast<std::streamsize>(padding));
+				m_offset += padding;
+
+				const u64 offset = m_offset;
+				m_stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+				m_offset += size;
+				return offset;
+			}
+
+		private:
+			std::ofstream& m_stream;
+			u64            m_offset = 0;
+		};
+	}
+
+	fs::path MeshCache::GetCachePath(const fs::path& sourcePath)
+	{
+		fs::path cachePath = sourcePath;
+		cachePath += ".pmesh";
+		return cachePath;
+	}
+
+	u64 MeshCache::HashSettings(const MeshImporter::ImportSettings& settings)
+	{
+		// Only settings that change the cooked output take part in the key
+		const bool flags[] =
+		{
+			settings.FlipUVs,
+			settings.CalculateNormals,
+			settings.CalculateTangents,
+			settings.Triangulate,
+			settings.JoinIdenticalVertices,
+			settings.ConvertToLeftHanded,
+			settings.FlipWindingOrder,
+			settings.OptimizeMeshes,
+			settings.Validate,
+			settings.ExtractEmbeddedTextures,
+			settings.OptimizeVertexCache,
+			settings.OptimizeOverdraw,
+			settings.OptimizeVertexFetch,
+			settings.BuildMeshlets,
+			settings.GenerateLods,
+			settings.UseNativeLoaders,
+			settings.PackMeshes,
+			settings.BakeNodeTransforms,
+			settings.GenerateMips,
+			settings.GenerateMips && settings.SrgbTextures
+		};
+
+		u64 hash = Hash::XXH64(flags, sizeof(flags));
+		hash = Hash::Combine(hash, std::bit_cast<u32>(settings.OverdrawThreshold));
+		hash = Hash::Combine(hash, sizeof(MeshImporter::VertexType));
+		hash = Hash::Combine(hash, static_cast<u32>(settings.VertexFormat));
+		hash = Hash::Combine(hash, settings.GenerateMips ? static_cast<u32>(settings.MipFilter) : 0);
+		hash = Hash::Combine(hash, static_cast<u32>(settings.TextureCompression));
+		hash = Hash::Combine(hash, settings.BuildMeshlets ? (u64{ settings.MaxMeshletVertices } << 32) | settings.MaxMeshletTriangles : 0);
+		if (settings.GenerateLods)
+		{
+			hash = Hash::Combine(hash, settings.MaxLodCount);
+			hash = Hash::Combine(hash, (u64{ std::bit_cast<u32>(settings.LodReductionRatio) } << 32) | std::bit_cast<u32>(settings.LodMaxError));
+		}
+		return hash;
+	}
+
+	std::expected<MeshCache::CacheKey, MeshCache::CacheError> MeshCache::ComputeKey(const fs::path& sourcePath, const MeshImporter::ImportSettings& settings)
+	{
+		auto fileResult = MappedFile::Open(sourcePath);
+		if (!fileResult)
+		{
+			return std::unexpected(CacheError
+			{
+				.Type      = CacheError::Type::FileNotFound,
+				.ErrorCode = fileResult.error().ErrorCode,
+				.Message   = fileResult.error().Message
+			});
+		}
+
+		return CacheKey
+		{
+			.SourceHash   = Hash::XXH64(fileResult.value().GetData()),
+			.SettingsHash = HashSettings(settings)
+		};
+	}
+
+	std::vector<MeshCache::Sidecar> MeshCache::HashSidecars(const fs::path& sourcePath, std::span<const fs::path> files)
+	{
+		std::error_code ec;
+		const fs::path directory = fs::absolute(sourcePath, ec).parent_path();
+
+		std::vector<Sidecar> sidecars;
+		sidecars.reserve(files.size());
+		for (const fs::path& file : files)
+		{
+			if (fs::equivalent(file, sourcePath, ec))
+			{
+				continue;
+			}
+
+			// Paths that cannot be made relative (another drive) are kept as they are
+			fs::path relative = fs::relative(file, directory, ec);
+			const Elos::String path = (ec || relative.empty() ? file : relative).generic_string();
+			if (std::ranges::none_of(sidecars, [&path](const Sidecar& sidecar) { return sidecar.Path == path; }))
+			{
+				sidecars.push_back(Sidecar{ .Path = path, .Hash = HashFile(file) });
+			}
+		}
+		return sidecars;
+	}
+
+	std::expected<MeshCache, MeshCache::CacheError> MeshCache::Open(const fs::path& cachePath, const CacheKey& key)
+	{
+		auto fileResult = MappedFile::Open(cachePath);
+		if (!fileResult)
+		{
+			return std::unexpected(CacheError
+			{
+				.Type      = CacheError::Type::FileNotFound,
+				.ErrorCode = fileResult.error().ErrorCode,
+				.Message   = fileResult.error().Message
+			});
+		}
+
+		MeshCache cache(std::move(fileResult.value()));
+
+		const auto InvalidFormat = [&cachePath](Elos::StringView reason)
+		{
+			return std::unexpected(CacheError
+			{
+				.Type      = CacheError::Type::InvalidFormat,
+				.ErrorCode = E_FAIL,
+				.Message   = std::format("Invalid mesh cache {} ({})", cachePath.string(), reason)
+			});
+		};
+
+		const std::span<const byte> data = cache.m_file.GetData();
+		const u64 fileSize = data.size();
+
+		if (fileSize < sizeof(FileHeader))
+		{
+			return InvalidFormat("file too small");
+		}
+
+		const FileHeader* header = reinterpret_cast<const FileHeader*>(data.data());
+		if (header->Magic != Magic || header->Version != FormatVersion)
+		{
+			return InvalidFormat("unknown magic or version");
+		}
+
+		if (header->SourceHash != key.SourceHash || header->SettingsHash != key.SettingsHash)
+		{
+			return std::unexpected(CacheError
+			{
+				.Type      = CacheError::Type::KeyMismatch,
+				.ErrorCode = E_FAIL,
+				.Message   = "Mesh cache is stale: " + cachePath.string()
+			});
+		}
+
+		if (!IsRangeValid(header->MeshTableOffset, u64{ header->MeshCount } * sizeof(MeshRecord), fileSize) ||
+			!IsRangeValid(header->TextureTableOffset, u64{ header->TextureCount } * sizeof(TextureRecord), fileSize) ||
+			!IsRangeValid(header->InstanceTableOffset, u64{ header->InstanceCount } * sizeof(u32), fileSize) ||
+			!IsRangeValid(header->MaterialTableOffset, u64{ header->MaterialCount } * sizeof(MaterialRecord), fileSize) ||
+			!IsRangeValid(header->SidecarTableOffset, u64{ header->SidecarCount } * sizeof(SidecarRecord), fileSize))
+		{
+			return InvalidFormat("tables out of range");
+		}
+
+		// The cache sits next to its source, sidecar paths are relative to that directory
+		const std::span sidecars(reinterpret_cast<const SidecarRecord*>(data.data() + header->SidecarTableOffset), header->SidecarCount);
+		for (const SidecarRecord& record : sidecars)
+		{
+			if (!IsRangeValid(record.PathOffset, record.PathLength, fileSize))
+			{
+				return InvalidFormat("sidecar path out of range");
+			}
+
+			const std::string_view path(reinterpret_cast<const char*>(data.data() + record.PathOffset), record.PathLength);
+			if (HashFile(cachePath.parent_path() / fs::path(path)) != record.Hash)
+			{
+				return std::unexpected(CacheError
+				{
+					.Type      = CacheError::Type::KeyMismatch,
+					.ErrorCode = E_FAIL,
+					.Message   = std::format("Mesh cache is stale, {} changed: {}", path, cachePath.string())
+				});
+			}
+		}
+
+		cache.m_meshInstances = std::span(
+			reinterpret_cast<const u32*>(data.data() + header->InstanceTableOffset), header->InstanceCount);
+
+		if (std::ranges::any_of(cache.m_meshInstances, [count = header->MeshCount](const u32 mesh) { return mesh >= count; }))
+		{
+			return InvalidFormat("instance references a missing mesh");
+		}
+
+		cache.m_meshRecords = std::span(
+			reinterpret_cast<const MeshRecord*>(data.data() + header->MeshTableOffset), header->MeshCount);
+		cache.m_textureRecords = std::span(
+			reinterpret_cast<const TextureRecord*>(data.data() + header->TextureTableOffset), header->TextureCount);
+		cache.m_materialRecords = std::span(
+			reinterpret_cast<const MaterialRecord*>(data.data() + header->MaterialTableOffset), header->MaterialCount);
+
+		for (const MeshRecord& record : cache.m_meshRecords)
+		{
+			if (record.VertexFormat > static_cast<u32>(VertexFormat::Compact) ||
+				record.VertexStride != GetVertexStride(static_cast<VertexFormat>(record.VertexFormat)) ||
+				!IsRangeValid(record.VertexOffset, u64{ record.VertexCount } * record.VertexStride, fileSize) ||
+				!IsRangeValid(record.IndexOffset, u64{ record.IndexCount } * sizeof(u32), fileSize) ||
+				!IsRangeValid(record.MeshletOffset, u64{ record.MeshletCount } * sizeof(Meshlet), fileSize) ||
+				!IsRangeValid(record.LodOffset, u64{ record.LodCount } * sizeof(Mesh::Lod), fileSize))
+			{
+				return InvalidFormat("mesh data out of range");
+			}
+
+			// Cached meshes skip the importer checks, an index past the vertex array would be uploaded and drawn as is
+			const std::span indices(reinterpret_cast<const u32*>(data.data() + record.IndexOffset), record.IndexCount);
+			if (!indices.empty() && std::ranges::max(indices) >= record.VertexCount)
+			{
+				return InvalidFormat("index out of range");
+			}
+
+			const std::span meshlets(reinterpret_cast<const Meshlet*>(data.data() + record.MeshletOffset), record.MeshletCount);
+			for (const Meshlet& meshlet : meshlets)
+			{
+				if (u64{ meshlet.IndexOffset } + meshlet.IndexCount > record.IndexCount)
+				{
+					return InvalidFormat("meshlet outside of its index buffer");
+				}
+			}
+
+			const std::span lods(reinterpret_cast<const Mesh::Lod*>(data.data() + record.LodOffset), record.LodCount);
+			for (const Mesh::Lod& lod : lods)
+			{
+				if (u64{ lod.IndexOffset } + lod.IndexCount > record.IndexCount)
+				{
+					return InvalidFormat("LOD outside of its index buffer");
+				}
+			}
+		}
+
+		for (const TextureRecord& record : cache.m_textureRecords)
+		{
+			if (!IsRangeValid(record.NameOffset, record.NameLength, fileSize) ||
+				!IsRangeValid(record.DataOffset, record.DataSize, fileSize))
+			{
+				return InvalidFormat("texture data out of range");
+			}
+
+			if (record.IsCompressed)
+			{
+				continue;
+			}
+
+			const DXGI_FORMAT format = static_cast<DXGI_FORMAT>(record.Format);
+			if (format != DXGI_FORMAT_R8G8B8A8_UNORM && !IsBlockCompressed(format))
+			{
+				return InvalidFormat("unsupported texture format");
+			}
+
+			if (record.MipLevels == 0 || record.MipLevels > GetMipLevelCount(record.Width, record.Height) ||
+				record.DataSize != GetChainSize(format, record.Width, record.Height, record.MipLevels))
+			{
+				return InvalidFormat("texture mip chain does not match its size");
+			}
+		}
+
+		for (const MaterialRecord& record : cache.m_materialRecords)
+		{
+			if (!IsRangeValid(record.NameOffset, record.NameLength, fileSize))
+			{
+				return InvalidFormat("material name out of range");
+			}
+		}
+
+		return cache;
+	}
+
+	std::expected<void, MeshCache::CacheError> MeshCache::Write(
+		const fs::path& cachePath,
+		const CacheKey& key,
+		std::span<const Sidecar> sidecars,
+		std::span<const MeshImporter::MeshBuffers> meshes,
+		std::span<const u32> meshInstances,
+		std::span<const MeshImporter::TextureView> textures,
+		std::span<const MaterialSource> materials)
+	{
+		// Write next to the final file and swap it in at the end so readers never see a partial cache
+		fs::path tempPath = cachePath;
+		tempPath += ".tmp";
+
+		// The temporary file must be closed before this runs, Windows cannot delete open files
+		const auto WriteFailed = [&cachePath, &tempPath]()
+		{
+			std::error_code ec;
+			fs::remove(tempPath, ec);
+
+			return std::unexpected(CacheError
+			{
+				.Type      = CacheError::Type::WriteFailed,
+				.ErrorCode = E_FAIL,
+				.Message   = "Failed to write mesh cache: " + cachePath.string()
+			});
+		};
+
+		{
+			std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+			if (!stream)
+			{
+				return WriteFailed();
+			}
+
+			BlobWriter writer(stream);
+
+			FileHeader header{};
+			writer.Write(&header, sizeof(header));
+
+			std::vector<MeshRecord> meshRecords;
+			meshRecords.reserve(meshes.size());
+			for (const MeshImporter::MeshBuffers& mesh : meshes)
+			{
+				const MeshImporter::MeshView view = mesh.AsView();
+
+				MeshRecord& record  = meshRecords.emplace_back();
+				record.VertexCount  = view.VertexCount;
+				record.VertexStride = view.VertexStride;
+				record.IndexCount   = static_cast<u32>(view.Indices.size());
+				record.VertexFormat = static_cast<u32>(view.Format);
+				std::memcpy(record.PositionScale, &view.Dequantization.Scale, sizeof(record.PositionScale));
+				std::memcpy(record.PositionOffset, &view.Dequantization.Offset, sizeof(record.PositionOffset));
+				record.VertexOffset = writer.Write(view.Vertices, u64{ view.VertexCount } * view.VertexStride);
+				record.IndexOffset  = writer.Write(view.Indices.data(), view.Indices.size() * sizeof(u32));
+				record.MeshletCount  = static_cast<u32>(view.Meshlets.size());
+				record.MeshletOffset = writer.Write(view.Meshlets.data(), view.Meshlets.size_bytes());
+				record.LodCount      = static_cast<u32>(view.Lods.size());
+				record.LodOffset     = writer.Write(view.Lods.data(), view.Lods.size_bytes());
+				record.SphereRadius  = view.Bounds.Sphere.Radius;
+				record.MaterialIndex = view.MaterialIndex;
+				std::memcpy(record.BoxCenter, &view.Bounds.Box.Center, sizeof(record.BoxCenter));
+				std::memcpy(record.BoxExtents, &view.Bounds.Box.Extents, sizeof(record.BoxExtents));
+				std::memcpy(record.SphereCenter, &view.Bounds.Sphere.Center, sizeof(record.SphereCenter));
+			}
+
+			std::vector<TextureRecord> textureRecords;
+			textureRecords.reserve(textures.size());
+			for (const MeshImporter::TextureView& texture : textures)
+			{
+				TextureRecord& record = textureRecords.emplace_back();
+				record.Width          = texture.Width;
+				record.Height         = texture.Height;
+				record.IsCompressed   = texture.IsCompressed ? 1u : 0u;
+				record.MipLevels      = texture.MipLevels;
+				record.Format         = static_cast<u32>(texture.Format);
+				record.SourceKey      = texture.SourceKey;
+				record.SourceBytes    = texture.SourceBytes;
+				record.NeedsCook      = texture.NeedsCook ? 1u : 0u;
+				record.NameLength     = static_cast<u32>(texture.Name.size());
+				record.NameOffset     = writer.Write(texture.Name.data(), texture.Name.size(), 1);
+				record.DataSize       = texture.Data.size();
+				record.DataOffset     = writer.Write(texture.Data.data(), texture.Data.size());
+			}
+
+			std::vector<MaterialRecord> materialRecords;
+			materialRecords.reserve(materials.size());
+			for (const MaterialSource& material : materials)
+			{
+				MaterialRecord& record  = materialRecords.emplace_back();
+				record.NameLength       = static_cast<u32>(material.Name.size());
+				record.NameOffset       = writer.Write(material.Name.data(), material.Name.size(), 1);
+				record.Metallic         = material.Metallic;
+				record.Roughness        = material.Roughness;
+				record.BaseColorTexture = material.BaseColorTexture;
+				record.NormalTexture    = material.NormalTexture;
+				std::memcpy(record.BaseColor, &material.BaseColor, sizeof(record.BaseColor));
+				std::memcpy(record.Emissive, &material.Emissive, sizeof(record.Emissive));
+			}
+
+			std::vector<SidecarRecord> sidecarRecords;
+			sidecarRecords.reserve(sidecars.size());
+			for (const Sidecar& sidecar : sidecars)
+			{
+				SidecarRecord& record = sidecarRecords.emplace_back();
+				record.Hash           = sidecar.Hash;
+				record.PathLength     = static_cast<u32>(sidecar.Path.size());
+				record.PathOffset     = writer.Write(sidecar.Path.data(), sidecar.Path.size(), 1);
+			}
+
+			header.Magic              = Magic;
+			header.Version            = FormatVersion;
+			header.SourceHash         = key.SourceHash;
+			header.SettingsHash       = key.SettingsHash;
+			header.MeshCount          = static_cast<u32>(meshRecords.size());
+			header.TextureCount       = static_cast<u32>(textureRecords.size());
+			header.MeshTableOffset    = writer.Write(meshRecords.data(), meshRecords.size() * sizeof(MeshRecord));
+			header.TextureTableOffset = writer.Write(textureRecords.data(), textureRecords.size() * sizeof(TextureRecord));
+			header.InstanceCount       = static_cast<u32>(meshInstances.size());
+			header.InstanceTableOffset = writer.Write(meshInstances.data(), meshInstances.size_bytes());
+			header.MaterialCount       = static_cast<u32>(materialRecords.size());
+			header.MaterialTableOffset = writer.Write(materialRecords.data(), materialRecords.size() * sizeof(MaterialRecord));
+			header.SidecarCount        = static_cast<u32>(sidecarRecords.size());
+			header.SidecarTableOffset  = writer.Write(sidecarRecords.data(), sidecarRecords.size() * sizeof(SidecarRecord));
+
+			stream.seekp(0);
+			stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			stream.close();
+
+			if (!stream)
+			{
+				return WriteFailed();
+			}
+		}
+
+		std::error_code ec;
+		fs::rename(tempPath, cachePath, ec);
+		if (ec)
+		{
+			return WriteFailed();
+		}
+
+		return {};
+	}
+
+	MeshImporter::MeshView MeshCache::GetMesh(const u32 index) const noexcept
+	{
+		const MeshRecord& record = m_meshRecords[index];
+		const byte* base = m_file.GetData().data();
+
+		return MeshImporter::MeshView
+		{
+			.Vertices       = base + record.VertexOffset,
+			.VertexCount    = record.VertexCount,
+			.VertexStride   = record.VertexStride,
+			.Indices        = std::span(reinterpret_cast<const u32*>(base + record.IndexOffset), record.IndexCount),
+			.Format         = static_cast<VertexFormat>(record.VertexFormat),
+			.Dequantization = PositionDequantization
+			{
+				.Scale  = Vector3(record.PositionScale),
+				.Offset = Vector3(record.PositionOffset)
+			},
+			.Meshlets       = std::span(reinterpret_cast<const Meshlet*>(base + record.MeshletOffset), record.MeshletCount),
+			.Lods           = std::span(reinterpret_cast<const Mesh::Lod*>(base + record.LodOffset), record.LodCount),
+			.Bounds         = Bounds
+			{
+				.Box    = DirectX::BoundingBox(Vector3(record.BoxCenter), Vector3(record.BoxExtents)),
+				.Sphere = DirectX::BoundingSphere(Vector3(record.SphereCenter), record.SphereRadius)
+			},
+			.MaterialIndex  = record.MaterialIndex
+		};
+	}
+
+	MeshImporter::TextureView MeshCache::GetTexture(const u32 index) const noexcept
+	{
+		const TextureRecord& record = m_textureRecords[index];
+		const byte* base = m_file.GetData().data();
+
+		return MeshImporter::TextureView
+		{
+			.Name         = Elos::StringView(reinterpret_cast<const char*>(base + record.NameOffset), record.NameLength),
+			.Width        = record.Width,
+			.Height       = record.Height,
+			.MipLevels    = record.MipLevels,
+			.Format       = static_cast<DXGI_FORMAT>(record.Format),
+			.IsCompressed = record.IsCompressed != 0,
+			.NeedsCook    = record.NeedsCook != 0,
+			.SourceKey    = record.SourceKey,
+			.SourceBytes  = record.SourceBytes,
+			.Data         = std::span(base + record.DataOffset, record.DataSize)
+		};
+	}
+
+	MaterialSource MeshCache::GetMaterial(const u32 index) const
+	{
+		const MaterialRecord& record = m_materialRecords[index];
+		const byte* base = m_file.GetData().data();
+
+		return MaterialSource
+		{
+			.Name             = Elos::String(reinterpret_cast<const char*>(base + record.NameOffset), record.NameLength),
+			.BaseColor        = Vector4(record.BaseColor),
+			.Emissive         = Vector3(record.Emissive),
+			.Metallic         = record.Metallic,
+			.Roughness        = record.Roughness,
+			.BaseColorTexture = record.BaseColorTexture,
+			.NormalTexture    = record.NormalTexture
+		};
+	}
+}
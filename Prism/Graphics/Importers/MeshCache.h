@@ -0,0 +1,156 @@
+#pragma once
+#include "Graphics/Importers/MeshImporter.h"
+#include "Utils/MappedFile.h"
+
+namespace Prism::Gfx
+{
+	// Cooked binary form of an imported model (.pmesh)
+	// Holds the final vertex/index streams, the texture table and the material table so warm starts skip Assimp and upload
+	// straight from the memory mapped file
+	class MeshCache
+	{
+	public:
+		struct CacheError
+		{
+			enum class Type
+			{
+				FileNotFound,
+				InvalidFormat,
+				KeyMismatch,
+				WriteFailed
+			};
+
+			Type Type;
+			HRESULT ErrorCode;
+			Elos::String Message;
+		};
+
+		struct CacheKey
+		{
+			u64 SourceHash   = 0;
+			u64 SettingsHash = 0;
+		};
+
+		// File the loader read besides the source (.bin buffers, .mtl libraries), its path is relative to the source's
+		// directory. Open hashes every sidecar again so editing one invalidates the cache like editing the source does
+		struct Sidecar
+		{
+			Elos::String Path;
+			u64 Hash = 0;  // XXH64 of the contents, 0 when the file does not exist
+		};
+
+		static constexpr u32 Magic         = 0x48534D50;  // 'PMSH'
+		static constexpr u32 FormatVersion = 13;
+		static constexpr u64 BlobAlignment = 16;
+
+	public:
+		static NODISCARD fs::path GetCachePath(const fs::path& sourcePath);
+		static NODISCARD u64 HashSettings(const MeshImporter::ImportSettings& settings);
+		static NODISCARD std::expected<CacheKey, CacheError> ComputeKey(const fs::path& sourcePath, const MeshImporter::ImportSettings& settings);
+		static NODISCARD std::vector<Sidecar> HashSidecars(const fs::path& sourcePath, std::span<const fs::path> files);
+		static NODISCARD std::expected<MeshCache, CacheError> Open(const fs::path& cachePath, const CacheKey& key);
+		static NODISCARD std::expected<void, CacheError> Write(
+			const fs::path& cachePath,
+			const CacheKey& key,
+			std::span<const Sidecar> sidecars,
+			std::span<const MeshImporter::MeshBuffers> meshes,
+			std::span<const u32> meshInstances,
+			std::span<const MeshImporter::TextureView> textures,
+			std::span<const MaterialSource> materials);
+
+		inline NODISCARD u32 GetMeshCount() const noexcept { return static_cast<u32>(m_meshRecords.size()); }
+		inline NODISCARD u32 GetTextureCount() const noexcept { return static_cast<u32>(m_textureRecords.size()); }
+		inline NODISCARD u32 GetMaterialCount() const noexcept { return static_cast<u32>(m_materialRecords.size()); }
+		inline NODISCARD std::span<const u32> GetMeshInstances() const noexcept { return m_meshInstances; }
+		NODISCARD MeshImporter::MeshView GetMesh(const u32 index) const noexcept;
+		NODISCARD MeshImporter::TextureView GetTexture(const u32 index) const noexcept;
+		NODISCARD MaterialSource GetMaterial(const u32 index) const;
+
+	private:
+		struct FileHeader
+		{
+			u32 Magic;
+			u32 Version;
+			u64 SourceHash;
+			u64 SettingsHash;
+			u32 MeshCount;
+			u32 TextureCount;
+			u64 MeshTableOffset;
+			u64 TextureTableOffset;
+			u32 InstanceCount;
+			u32 MaterialCount;
+			u64 InstanceTableOffset;  // One mesh index per node reference, in traversal order
+			u64 MaterialTableOffset;
+			u32 SidecarCount;
+			u32 Reserved;
+			u64 SidecarTableOffset;
+		};
+
+		struct SidecarRecord
+		{
+			u64 PathOffset;
+			u64 Hash;
+			u32 PathLength;
+			u32 Reserved;
+		};
+
+		struct MeshRecord
+		{
+			u64 VertexOffset;
+			u64 IndexOffset;
+			u32 VertexCount;
+			u32 VertexStride;
+			u32 IndexCount;
+			u32 VertexFormat;
+			f32 PositionScale[3];   // Dequantization, identity for VertexFormat::Standard
+			f32 PositionOffset[3];
+			u64 MeshletOffset;
+			u32 MeshletCount;
+			u32 LodCount;
+			u64 LodOffset;
+			f32 BoxCenter[3];
+			f32 BoxExtents[3];
+			f32 SphereCenter[3];
+			f32 SphereRadius;
+			u32 MaterialIndex;
+		};
+
+		struct TextureRecord
+		{
+			u64 NameOffset;
+			u64 DataOffset;
+			u64 DataSize;
+			u32 NameLength;
+			u32 Width;
+			u32 Height;
+			u32 IsCompressed;
+			u32 MipLevels;
+			u32 Format;  // DXGI_FORMAT of the chain, RGBA8 or BC
+			u64 SourceKey;
+			u64 SourceBytes;
+			u32 NeedsCook;  // The data is the source image, it was shared with another model when the cache was written
+			u32 Reserved;
+		};
+
+		struct MaterialRecord
+		{
+			u64 NameOffset;
+			u32 NameLength;
+			f32 BaseColor[4];
+			f32 Emissive[3];
+			f32 Metallic;
+			f32 Roughness;
+			u32 BaseColorTexture;  // Index into the texture table, MaterialSource::NoTexture if untextured
+			u32 NormalTexture;
+		};
+
+		explicit MeshCache(MappedFile&& file) noexcept : m_file(std::move(file)) {}
+
+	private:
+		MappedFile                     m_file;
+		std::span<const MeshRecord>    m_meshRecords;
+		std::span<const TextureRecord> m_textureRecords;
+		std::span<const MaterialRecord> m_materialRecords;
+		std::span<const u32>           m_meshInstances;
+	};
+}
@@ -1,16 +1,266 @@
 #include "Graphics/Importers/MeshImporter.h"
+#include "Graphics/Importers/GltfLoader.h"
+#include "Graphics/Importers/ObjLoader.h"
+#include "Graphics/Importers/MappedIOSystem.h"
+#include "Graphics/Importers/MeshCache.h"
+#include "Graphics/Importers/MeshOptimizer.h"
+#include "Graphics/Importers/MeshletBuilder.h"
+#include "Graphics/Importers/MeshSimplifier.h"
 #include "Graphics/Mesh.h"
+#include "Graphics/Utils/ImageDecoder.h"
+#include "Graphics/Utils/PixelConversion.h"
 #include "Graphics/Utils/ResourceFactory.h"
+#include "Graphics/Utils/TextureContainer.h"
+#include "Utils/Hash.h"
 #include "Utils/Log.h"
+#include <Elos/Utils/Timer.h>
+#include <assimp/DefaultIOSystem.h>
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
+#include <assimp/ProgressHandler.hpp>
 #include <VertexTypes.h>
 #include <WICTextureLoader.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <execution>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <optional>
 
 
 namespace Prism::Gfx
-{	
+{
+	namespace
+	{
+		using Clock = std::chrono::steady_clock;
+
+		// Imported vertices are mirrored into left handed space without reversing the winding and drawn through a right
+		// handed camera, so the faces the renderer keeps have cross(p1 - p0, p2 - p0) pointing away from the viewer
+		constexpr f32 FrontFaceSign = -1.0f;
+
+		inline f64 SecondsSince(const Clock::time_point start) noexcept
+		{
+			return std::chrono::duration<f64>(Clock::now() - start).count();
+		}
+
+		// Splits ReadFile into file reading and post-processing at Assimp's first post-process announcement
+		// Announcements carry an index into Assimp's internal step registry, active or not, whose order depends on how
+		// Assimp was built and which no public API maps to an aiProcess_* flag, so the steps are timed as one phase
+		class PostProcessTimer final : public Assimp::ProgressHandler
+		{
+		public:
+			bool Update(const float) override
+			{
+				return true;
+			}
+
+			void UpdatePostProcess(const int, const int) override
+			{
+				if (!m_postProcessing)
+				{
+					m_readTime       = SecondsSince(m_start);
+					m_postProcessing = true;
+				}
+			}
+
+			void Finish() noexcept
+			{
+				const f64 elapsed = SecondsSince(m_start);
+				if (m_postProcessing)
+				{
+					m_postProcessTime = elapsed - m_readTime;
+				}
+				else
+				{
+					m_readTime = elapsed;
+				}
+			}
+
+			NODISCARD inline f64 GetReadTime() const noexcept { return m_readTime; }
+			NODISCARD inline f64 GetPostProcessTime() const noexcept { return m_postProcessTime; }
+
+		private:
+			Clock::time_point m_start = Clock::now();
+			bool m_postProcessing     = false;
+			f64 m_readTime            = 0.0;
+			f64 m_postProcessTime     = 0.0;
+		};
+
+		// Assimp's own file system, remembering what the importer read so the mesh cache can check those files too
+		class RecordingIOSystem final : public Assimp::DefaultIOSystem
+		{
+		public:
+			Assimp::IOStream* Open(const char* file, const char* mode = "rb") override
+			{
+				m_openedFiles.emplace_back(file);
+				return DefaultIOSystem::Open(file, mode);
+			}
+
+			NODISCARD inline std::span<const fs::path> GetOpenedFiles() const noexcept { return m_openedFiles; }
+
+		private:
+			std::vector<fs::path> m_openedFiles;
+		};
+
+		void CountMeshBytes(ImportReport& report, const MeshImporter::MeshView& mesh)
+		{
+			report.MeshCount++;
+			report.VertexBytes += u64{ mesh.VertexCount } * mesh.VertexStride;
+			report.IndexBytes  += mesh.Indices.size_bytes();
+		}
+
+		void CountTextureBytes(ImportReport& report, const MeshImporter::TextureView& texture)
+		{
+			report.TextureCount++;
+			report.TextureBytes += texture.Data.size();
+		}
+
+		// Texture cache key of a source image, taken before anything is decoded. The description is part of it since raw
+		// texels are only meaningful with their size and format, and images that get cooked also hash the settings that
+		// shape the cooked texture so the same image cooked two ways is not shared
+		u64 HashTextureSource(const MeshImporter::TextureView& texture, const bool isNormalMap, const MeshImporter::ImportSettings& settings) noexcept
+		{
+			u64 hash = Hash::XXH64(texture.Data);
+			hash = Hash::Combine(hash, (u64{ texture.Width } << 32) | texture.Height);
+			hash = Hash::Combine(hash, (u64{ texture.MipLevels } << 32) | static_cast<u32>(texture.Format));
+			hash = Hash::Combine(hash, texture.IsCompressed ? 1 : 0);
+			if (texture.NeedsCook)
+			{
+				hash = Hash::Combine(hash, settings.GenerateMips ? 1 + static_cast<u64>(settings.MipFilter) : 0);
+				hash = Hash::Combine(hash, settings.GenerateMips && settings.SrgbTextures && !isNormalMap ? 1 : 0);
+				hash = Hash::Combine(hash, static_cast<u64>(settings.TextureCompression));
+				hash = Hash::Combine(hash, isNormalMap ? 1 : 0);
+			}
+			return hash;
+		}
+
+		// Normal maps skip the sRGB decode and get BC5, textures also used as base color stay color data
+		std::vector<bool> FindNormalMaps(const size_t textureCount, std::span<const MaterialSource> materials)
+		{
+			std::vector<bool> isNormalMap(textureCount, false);
+			for (const MaterialSource& material : materials)
+			{
+				if (material.NormalTexture < textureCount)
+				{
+					isNormalMap[material.NormalTexture] = true;
+				}
+			}
+			for (const MaterialSource& material : materials)
+			{
+				if (material.BaseColorTexture < textureCount)
+				{
+					isNormalMap[material.BaseColorTexture] = false;
+				}
+			}
+			return isNormalMap;
+		}
+
+		// Wall time of the whole conversion, then the CPU time and output size of its extraction steps
+		void AddConversionPhases(ImportReport& report, std::span<const MeshImporter::MeshBuffers> meshes, const f64 seconds)
+		{
+			f64 vertexTime  = 0.0;
+			f64 indexTime   = 0.0;
+			u64 vertexBytes = 0;
+			u64 indexBytes  = 0;
+			for (const MeshImporter::MeshBuffers& buffers : meshes)
+			{
+				const MeshImporter::MeshView view = buffers.AsView();
+				vertexTime  += buffers.VertexTime;
+				indexTime   += buffers.IndexTime;
+				vertexBytes += u64{ view.VertexCount } * view.VertexStride;
+				indexBytes  += view.Indices.size_bytes();
+			}
+
+			report.AddPhase("Convert", seconds);
+			report.AddPhase("Convert.Vertices", vertexTime, vertexBytes);
+			report.AddPhase("Convert.Indices", indexTime, indexBytes);
+		}
+
+		// Converts every source on the worker pool, each worker writes only to its own slot so the output order is
+		// fixed by the input order
+		template <typename Convert>
+		std::vector<MeshImporter::MeshBuffers> ConvertAll(const size_t count, const MeshImporter::ImportSettings& settings, const Convert& convert)
+		{
+			std::vector<MeshImporter::MeshBuffers> result(count);
+
+			if (settings.ParallelConversion && count > 1)
+			{
+				std::vector<size_t> slots(count);
+				std::iota(slots.begin(), slots.end(), size_t{ 0 });
+
+				std::for_each(std::execution::par, slots.begin(), slots.end(), [&](const size_t i)
+				{
+					result[i] = convert(i);
+				});
+			}
+			else
+			{
+				for (size_t i = 0; i < count; i++)
+				{
+					result[i] = convert(i);
+				}
+			}
+
+			return result;
+		}
+
+		// Gives every distinct (mesh, transform) reference one slot, in order of first reference, and returns the slot of
+		// each reference. Transforms are compared bit for bit, without transforms every mesh gets a single slot
+		std::vector<u32> AssignInstanceSlots(
+			std::span<const u32> references,
+			std::span<const Matrix> transforms,
+			std::vector<u32>& outSources,
+			std::vector<Matrix>& outTransforms)
+		{
+			using InstanceKey = std::pair<u32, std::array<u32, 16>>;
+			std::map<InstanceKey, u32> slots;
+
+			std::vector<u32> instances;
+			instances.reserve(references.size());
+			for (size_t i = 0; i < references.size(); i++)
+			{
+				InstanceKey key{ references[i], {} };
+				if (!transforms.empty())
+				{
+					key.second = std::bit_cast<std::array<u32, 16>>(transforms[i]);
+				}
+
+				const auto [it, inserted] = slots.try_emplace(key, static_cast<u32>(outSources.size()));
+				if (inserted)
+				{
+					outSources.push_back(references[i]);
+					if (!transforms.empty())
+					{
+						outTransforms.push_back(transforms[i]);
+					}
+				}
+				instances.push_back(it->second);
+			}
+
+			return instances;
+		}
+
+		// Moves a right handed transform into the space of vertices mirrored along Z, like aiProcess_MakeLeftHanded
+		inline Matrix MirrorZ(const Matrix& transform) noexcept
+		{
+			const Matrix mirror = Matrix::CreateScale(1.0f, 1.0f, -1.0f);
+			return mirror * transform * mirror;
+		}
+
+		// Assimp 5.1+ also sets the NGON encoding flag on triangles it split from polygons, they are still a plain list
+		inline bool IsTriangleList(const aiMesh* mesh) noexcept
+		{
+			return (mesh->mPrimitiveTypes & ~aiPrimitiveType_NGONEncodingFlag) == aiPrimitiveType_TRIANGLE;
+		}
+	}
+
 	std::expected<MeshImporter::MeshData, MeshImporter::ImportError> MeshImporter::Import(
 		const ResourceFactory& resourceFactory, const fs::path& filePath, const ImportSettings& settings)
 	{
@@ -24,124 +274,1141 @@ namespace Prism::Gfx
 			});
 		}
 
+		const Clock::time_point importStart = Clock::now();
+
+		ImportReport report;
+		report.File = filePath.string();
+
+		std::error_code sizeError;
+		report.FileBytes = fs::file_size(filePath, sizeError);
+
+		const auto FinishReport = [importStart](MeshData& meshData, ImportReport&& finishedReport)
+		{
+			finishedReport.TotalSeconds    = SecondsSince(importStart);
+			finishedReport.PeakMemoryBytes = ImportReport::QueryPeakMemory();
+			meshData.Report = std::move(finishedReport);
+		};
+
+		// Warm start: a cooked cache with a matching source hash and settings skips Assimp entirely
+		const fs::path cachePath = MeshCache::GetCachePath(filePath);
+		std::optional<MeshCache::CacheKey> cacheKey;
+
+		if (settings.UseMeshCache)
+		{
+			const Clock::time_point keyStart = Clock::now();
+			auto keyResult = MeshCache::ComputeKey(filePath, settings);
+			report.AddPhase("Cache.Key", SecondsSince(keyStart), report.FileBytes);
+
+			if (keyResult)
+			{
+				cacheKey = keyResult.value();
+
+				const Clock::time_point openStart = Clock::now();
+				auto cacheResult = MeshCache::Open(cachePath, *cacheKey);
+				if (cacheResult)
+				{
+					// Phases of a failed cache upload are dropped with this copy
+					ImportReport cacheReport = report;
+					cacheReport.Source = "cache";
+					cacheReport.AddPhase("Cache.Open", SecondsSince(openStart));
+
+					if (auto cachedData = ImportFromCache(resourceFactory, cacheResult.value(), settings, cacheReport); cachedData)
+					{
+						Log::Info("Loaded {} from mesh cache {}", filePath.string(), cachePath.string());
+						FinishReport(cachedData.value(), std::move(cacheReport));
+						return cachedData;
+					}
+				}
+				else if (cacheResult.error().Type != MeshCache::CacheError::Type::FileNotFound)
+				{
+					Log::Warn("Ignoring mesh cache: {}", cacheResult.error().Message);
+				}
+			}
+			else
+			{
+				Log::Warn("Failed to compute mesh cache key: {}", keyResult.error().Message);
+			}
+		}
+
+		std::vector<MeshBuffers> meshBuffers;
+		std::vector<u32> meshInstances;
+		std::vector<TextureBuffers> textureBuffers;  // Assimp textures, glTF images stay in the mapped file
+		std::vector<TextureView> textures;
+		std::vector<MaterialSource> materials;
+		std::vector<fs::path> sidecars;  // Files read besides the source, they are part of the cache key
+
+		std::optional<GltfLoader::Document> gltf;
+		if (settings.UseNativeLoaders && GltfLoader::IsGltfFile(filePath))
+		{
+			const Clock::time_point parseStart = Clock::now();
+			if (auto gltfResult = GltfLoader::Load(filePath); gltfResult)
+			{
+				gltf = std::move(gltfResult.value());
+				report.AddPhase("Gltf.Parse", SecondsSince(parseStart), report.FileBytes);
+			}
+			else
+			{
+				Log::Warn("{}, importing through Assimp", gltfResult.error().Message);
+			}
+		}
+
+		std::optional<ObjLoader::Document> obj;
+		if (settings.UseNativeLoaders && ObjLoader::IsObjFile(filePath))
+		{
+			const Clock::time_point parseStart = Clock::now();
+			if (auto objResult = ObjLoader::Load(filePath, settings.ParallelConversion); objResult)
+			{
+				obj = std::move(objResult.value());
+				report.AddPhase("Obj.Parse", SecondsSince(parseStart), report.FileBytes);
+				Log::Info("Parsed OBJ in {:3f}s", report.Phases.back().Seconds);
+			}
+			else
+			{
+				Log::Warn("{}, importing through Assimp", objResult.error().Message);
+			}
+		}
+
+		if (gltf)
+		{
+			report.Source = "gltf";
+
+			// Node transforms are baked in the space the vertices end up in
+			std::vector<Matrix> instanceTransforms;
+			if (settings.BakeNodeTransforms)
+			{
+				instanceTransforms = gltf->InstanceTransforms;
+				if (settings.ConvertToLeftHanded)
+				{
+					std::ranges::transform(instanceTransforms, instanceTransforms.begin(), MirrorZ);
+				}
+			}
+
+			std::vector<u32> sources;
+			std::vector<Matrix> transforms;
+			meshInstances = AssignInstanceSlots(gltf->PrimitiveInstances, instanceTransforms, sources, transforms);
+
+			std::vector<MeshStreams> primitives;
+			primitives.reserve(sources.size());
+			for (const u32 source : sources)
+			{
+				primitives.push_back(gltf->Primitives[source]);
+			}
+
+			// Assimp stores glTF texture coordinates V flipped, which aiProcess_FlipUVs flips back
+			const Clock::time_point convertStart = Clock::now();
+			meshBuffers = ConvertStreams(primitives, !settings.FlipUVs, settings, transforms);
+			AddConversionPhases(report, meshBuffers, SecondsSince(convertStart));
+
+			textures.reserve(gltf->Images.size());
+			for (const GltfLoader::Image& image : gltf->Images)
+			{
+				textures.push_back(TextureView{ .Name = image.Name, .IsCompressed = true, .Data = image.Data });
+			}
+			materials = gltf->Materials;
+			sidecars  = gltf->Sidecars;
+		}
+		else if (obj)
+		{
+			report.Source = "obj";
+
+			std::vector<MeshStreams> groups;
+			groups.reserve(obj->Groups.size());
+			for (const ObjLoader::MeshGroup& group : obj->Groups)
+			{
+				groups.push_back(group.AsStreams());
+			}
+
+			// Every group is referenced once by the root node, like the scene Assimp builds for OBJ files
+			const Clock::time_point convertStart = Clock::now();
+			meshBuffers = ConvertStreams(groups, settings.FlipUVs, settings);
+			AddConversionPhases(report, meshBuffers, SecondsSince(convertStart));
+			meshInstances.resize(meshBuffers.size());
+			std::iota(meshInstances.begin(), meshInstances.end(), 0u);
+			materials = std::move(obj->Materials);
+			sidecars  = std::move(obj->Sidecars);
+		}
+		else
+		{
+			report.Source = "assimp";
+
+			if (auto result = ConvertWithAssimp(
+				filePath, settings, meshBuffers, meshInstances, textureBuffers, materials, sidecars, report); !result)
+			{
+				return std::unexpected(result.error());
+			}
+
+			textures.reserve(textureBuffers.size());
+			for (const TextureBuffers& texture : textureBuffers)
+			{
+				textures.push_back(texture.AsView());
+			}
+		}
+
+		// Shared textures are found before cooking, only the misses are decoded and get their mips and block compression
+		std::vector<TextureBuffers> cookedTextures;
+		PrepareTextureSources(textures, materials, settings);
+		const std::vector<std::shared_ptr<Texture2D>> sharedTextures =
+			ResolveTextures(textures, materials, settings, cookedTextures, report);
+
+		if (settings.PackMeshes)
+		{
+			const Clock::time_point mergeStart = Clock::now();
+			const size_t meshCount = meshBuffers.size();
+			MergeByMaterial(meshBuffers, meshInstances, settings.ParallelConversion);
+			report.AddPhase("Pack.Merge", SecondsSince(mergeStart));
+			Log::Info("Merged {} meshes into {} by material", meshCount, meshBuffers.size());
+		}
+
+		if (cacheKey)
+		{
+			const Clock::time_point writeStart = Clock::now();
+			const std::vector<MeshCache::Sidecar> sidecarHashes = MeshCache::HashSidecars(filePath, sidecars);
+			if (auto result = MeshCache::Write(cachePath, *cacheKey, sidecarHashes, meshBuffers, meshInstances, textures, materials); !result)
+			{
+				Log::Warn("{}", result.error().Message);
+			}
+			report.AddPhase("Cache.Write", SecondsSince(writeStart));
+		}
+
+		auto meshData = UploadMeshData(resourceFactory, filePath, meshBuffers, meshInstances, textures, sharedTextures, materials, settings, report);
+		if (meshData)
+		{
+			FinishReport(meshData.value(), std::move(report));
+		}
+		return meshData;
+	}
+
+	std::expected<void, MeshImporter::ImportError> MeshImporter::ConvertWithAssimp(
+		const fs::path& filePath,
+		const ImportSettings& settings,
+		std::vector<MeshBuffers>& outMeshes,
+		std::vector<u32>& outMeshInstances,
+		std::vector<TextureBuffers>& outTextures,
+		std::vector<MaterialSource>& outMaterials,
+		std::vector<fs::path>& outSidecars,
+		ImportReport& report)
+	{
 		Assimp::Importer importer;
 		const u32 flags = GetAssimpImportFlags(settings);
-		
+
+		// The importer owns both handlers, the pointers stay valid for its lifetime
+		MappedIOSystem* ioSystem       = settings.UseMappedIO ? new MappedIOSystem() : nullptr;
+		RecordingIOSystem* recordingIO = ioSystem ? nullptr : new RecordingIOSystem();
+		importer.SetIOHandler(ioSystem ? static_cast<Assimp::IOSystem*>(ioSystem) : recordingIO);
+
+		PostProcessTimer* progress = new PostProcessTimer();
+		importer.SetProgressHandler(progress);
+
 		const aiScene* scene = importer.ReadFile(filePath.string(), flags);
+		progress->Finish();
+
+		const std::span<const fs::path> openedFiles = ioSystem ? ioSystem->GetOpenedFiles() : recordingIO->GetOpenedFiles();
+		outSidecars.assign(openedFiles.begin(), openedFiles.end());
+
+		const u64 bytesRead = ioSystem ? ioSystem->GetStatistics().BytesRead : report.FileBytes;
+		report.AddPhase("Assimp.Read", progress->GetReadTime(), bytesRead);
+		report.AddPhase("Assimp.PostProcess", progress->GetPostProcessTime());
+
+		if (ioSystem)
+		{
+			Log::Info("Assimp read {:.1f} MB from {} mapped files in {:3f}s",
+				static_cast<f64>(bytesRead) / (1024.0 * 1024.0), ioSystem->GetStatistics().FilesOpened, progress->GetReadTime());
+		}
+
+		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
+		{
+			return std::unexpected(ImportError
+			{
+				.Type      = ImportError::Type::AssimpError,
+				.ErrorCode = E_FAIL,
+				.Message   = "Assimp error: " + Elos::String(importer.GetErrorString())
+			});
+		}
+
+		// Gather mesh references in node traversal order so the output is deterministic
+		std::vector<u32> meshReferences;
+		std::vector<Matrix> referenceTransforms;
+		meshReferences.reserve(scene->mNumMeshes);
+		referenceTransforms.reserve(scene->mNumMeshes);
+		ProcessNode(scene->mRootNode, Matrix::Identity, meshReferences, referenceTransforms);
+
+		// Every aiMesh is converted and uploaded once, in order of its first reference
+		// With baked transforms that holds for every distinct (aiMesh, transform) pair instead
+		std::vector<u32> sources;
+		std::vector<Matrix> transforms;
+		outMeshInstances = AssignInstanceSlots(
+			meshReferences,
+			settings.BakeNodeTransforms ? std::span<const Matrix>(referenceTransforms) : std::span<const Matrix>{},
+			sources,
+			transforms);
+
+		std::vector<const aiMesh*> meshes;
+		meshes.reserve(sources.size());
+		for (const u32 source : sources)
+		{
+			meshes.push_back(scene->mMeshes[source]);
+		}
+
+		if (meshes.size() < meshReferences.size())
+		{
+			Log::Info("{} mesh references share {} unique meshes", meshReferences.size(), meshes.size());
+		}
+
+		const Clock::time_point convertStart = Clock::now();
+		outMeshes = ConvertMeshes(meshes, settings, transforms);
+		AddConversionPhases(report, outMeshes, SecondsSince(convertStart));
+
+		const Clock::time_point decodeStart = Clock::now();
+		outTextures = LoadTextures(scene);
+
+		u64 textureBytes = 0;
+		for (const TextureBuffers& texture : outTextures)
+		{
+			textureBytes += texture.Data.size();
+		}
+		report.AddPhase("Textures.Decode", SecondsSince(decodeStart), textureBytes);
+
+		outMaterials = LoadMaterials(scene);
+
+		return {};
+	}
+
+	std::expected<MeshImporter::MeshData, MeshImporter::ImportError> MeshImporter::UploadMeshData(
+		const ResourceFactory& resourceFactory,
+		const fs::path& filePath,
+		std::span<const MeshBuffers> meshes,
+		std::span<const u32> meshInstances,
+		std::span<const TextureView> textures,
+		std::span<const std::shared_ptr<Texture2D>> sharedTextures,
+		std::span<const MaterialSource> materials,
+		const ImportSettings& settings,
+		ImportReport& report)
+	{
+		MeshData meshData;
+
+		// Upload on the calling thread, the immediate context is not thread safe
+		const Clock::time_point meshStart = Clock::now();
+		std::vector<MeshView> views;
+		views.reserve(meshes.size());
+		for (const MeshBuffers& buffers : meshes)
+		{
+			CountMeshBytes(report, views.emplace_back(buffers.AsView()));
+		}
+
+		if (auto result = UploadMeshes(resourceFactory, meshData, views, settings.PackMeshes); !result)
+		{
+			return std::unexpected(result.error());
+		}
+		report.AddPhase("Upload.Meshes", SecondsSince(meshStart), report.VertexBytes + report.IndexBytes);
+
+		const Clock::time_point textureStart = Clock::now();
+		meshData.Textures.reserve(textures.size());
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			if (auto result = UploadTexture(resourceFactory, meshData, textures[i], sharedTextures[i], settings); !result)
+			{
+				// We don't exit if we fail to import textures
+				Log::Warn("Failed to import texture {} for mesh or model {}",
+					result.error().Message, filePath.string());
+				break;
+			}
+			CountTextureBytes(report, textures[i]);
+		}
+		report.AddPhase("Upload.Textures", SecondsSince(textureStart), report.TextureBytes);
+
+		// Materials reference the textures above, instances then share the material of their mesh
+		const Clock::time_point materialStart = Clock::now();
+		if (auto result = UploadMaterials(resourceFactory, meshData, materials, views); !result)
+		{
+			return std::unexpected(result.error());
+		}
+		ExpandInstances(meshData, meshInstances);
+		report.AddPhase("Upload.Materials", SecondsSince(materialStart));
+
+		return meshData;
+	}
+
+	std::expected<MeshImporter::MeshData, MeshImporter::ImportError> MeshImporter::ImportFromCache(
+		const ResourceFactory& resourceFactory, const MeshCache& cache, const ImportSettings& settings, ImportReport& report)
+	{
+		MeshData meshData;
+
+		const Clock::time_point meshStart = Clock::now();
+		std::vector<MeshView> views;
+		views.reserve(cache.GetMeshCount());
+		for (u32 i = 0; i < cache.GetMeshCount(); i++)
+		{
+			CountMeshBytes(report, views.emplace_back(cache.GetMesh(i)));
+		}
+
+		if (auto result = UploadMeshes(resourceFactory, meshData, views, settings.PackMeshes); !result)
+		{
+			return std::unexpected(result.error());
+		}
+		report.AddPhase("Upload.Meshes", SecondsSince(meshStart), report.VertexBytes + report.IndexBytes);
+
+		std::vector<MaterialSource> materials;
+		materials.reserve(cache.GetMaterialCount());
+		for (u32 i = 0; i < cache.GetMaterialCount(); i++)
+		{
+			materials.push_back(cache.GetMaterial(i));
+		}
+
+		// Textures shared when the cache was written are stored as their source, they are cooked here if nothing shares them now
+		std::vector<TextureView> textures;
+		textures.reserve(cache.GetTextureCount());
+		for (u32 i = 0; i < cache.GetTextureCount(); i++)
+		{
+			textures.push_back(cache.GetTexture(i));
+		}
+
+		std::vector<TextureBuffers> cookedTextures;
+		const std::vector<std::shared_ptr<Texture2D>> sharedTextures =
+			ResolveTextures(textures, materials, settings, cookedTextures, report);
+
+		const Clock::time_point textureStart = Clock::now();
+		meshData.Textures.reserve(textures.size());
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			if (auto result = UploadTexture(resourceFactory, meshData, textures[i], sharedTextures[i], settings); !result)
+			{
+				Log::Warn("Failed to import cached texture {}", result.error().Message);
+				break;
+			}
+			CountTextureBytes(report, textures[i]);
+		}
+		report.AddPhase("Upload.Textures", SecondsSince(textureStart), report.TextureBytes);
+
+		const Clock::time_point materialStart = Clock::now();
+		if (auto result = UploadMaterials(resourceFactory, meshData, materials, views); !result)
+		{
+			return std::unexpected(result.error());
+		}
+		ExpandInstances(meshData, cache.GetMeshInstances());
+		report.AddPhase("Upload.Materials", SecondsSince(materialStart));
+
+		return meshData;
+	}
+	
+	std::vector<MeshImporter::MeshBuffers> MeshImporter::ConvertMeshes(
+		std::span<const aiMesh* const> meshes, const ImportSettings& settings, std::span<const Matrix> transforms)
+	{
+		Elos::ScopedTimer convertTimer([count = meshes.size()](const Elos::Timer::TimeInfo& timeInfo)
+		{
+			Log::Info("Converted {} meshes in {:3f}s", count, timeInfo.TotalTime);
+		});
+
+		std::vector<MeshBuffers> result = ConvertAll(meshes.size(), settings, [&](const size_t i)
+		{
+			return ProcessMesh(meshes[i], settings, transforms.empty() ? Matrix::Identity : transforms[i]);
+		});
+		LogConversionStats(result, settings);
+		return result;
+	}
+
+	std::vector<MeshImporter::MeshBuffers> MeshImporter::ConvertStreams(
+		std::span<const MeshStreams> meshes, const bool flipV, const ImportSettings& settings, std::span<const Matrix> transforms)
+	{
+		Elos::ScopedTimer convertTimer([count = meshes.size()](const Elos::Timer::TimeInfo& timeInfo)
+		{
+			Log::Info("Converted {} meshes in {:3f}s", count, timeInfo.TotalTime);
+		});
+
+		std::vector<MeshBuffers> result = ConvertAll(meshes.size(), settings, [&](const size_t i)
+		{
+			return ProcessStreams(meshes[i], flipV, settings, transforms.empty() ? Matrix::Identity : transforms[i]);
+		});
+		LogConversionStats(result, settings);
+		return result;
+	}
+
+	void MeshImporter::LogConversionStats(std::span<const MeshBuffers> meshes, const ImportSettings& settings)
+	{
+		size_t vertexTotal = 0;
+		f64 vertexTime     = 0.0;  // Summed over workers, so this is per core throughput
+		for (const MeshBuffers& buffers : meshes)
+		{
+			vertexTotal += buffers.AsView().VertexCount;
+			vertexTime  += buffers.VertexTime;
+		}
+
+		if (vertexTime > 0.0)
+		{
+			Log::Info("Vertex extraction: {} vertices in {:.3f}s ({:.1f} M vertices/s)",
+				vertexTotal, vertexTime, static_cast<f64>(vertexTotal) / vertexTime * 1e-6);
+		}
+
+		if (settings.OptimizeVertexCache)
+		{
+			// Triangle weighted averages over the whole model
+			f64 trianglesTotal = 0.0, missesBefore = 0.0, missesAfter = 0.0, overdrawBefore = 0.0, overdrawAfter = 0.0;
+			for (const MeshBuffers& buffers : meshes)
+			{
+				if (buffers.ACMRAfter <= 0.0f)
+				{
+					continue;  // Pass was skipped for this mesh
+				}
+
+				const f64 triangles = static_cast<f64>(buffers.GetLodIndexCount() / 3);
+				trianglesTotal += triangles;
+				missesBefore   += buffers.ACMRBefore * triangles;
+				missesAfter    += buffers.ACMRAfter * triangles;
+				overdrawBefore += buffers.OverdrawBefore * triangles;
+				overdrawAfter  += buffers.OverdrawAfter * triangles;
+			}
+
+			if (trianglesTotal > 0.0)
+			{
+				Log::Info("Vertex cache optimization: ACMR {:.3f} -> {:.3f} ({} triangles)",
+					missesBefore / trianglesTotal, missesAfter / trianglesTotal, static_cast<u64>(trianglesTotal));
+
+				if (settings.OptimizeOverdraw)
+				{
+					Log::Info("Overdraw optimization: overdraw {:.3f} -> {:.3f}",
+						overdrawBefore / trianglesTotal, overdrawAfter / trianglesTotal);
+				}
+			}
+		}
+
+		if (settings.GenerateLods)
+		{
+			size_t lodCount = 0, fullTriangles = 0, lodTriangles = 0;
+			for (const MeshBuffers& buffers : meshes)
+			{
+				lodCount      += buffers.Lods.size();
+				fullTriangles += buffers.GetLodIndexCount() / 3;
+				lodTriangles  += (buffers.Indices.size() - buffers.GetLodIndexCount()) / 3;
+			}
+
+			Log::Info("Generated {} LODs for {} meshes ({} full detail triangles, {} LOD triangles)",
+				lodCount, meshes.size(), fullTriangles, lodTriangles);
+		}
+
+		if (settings.BuildMeshlets)
+		{
+			size_t meshletCount = 0;
+			for (const MeshBuffers& buffers : meshes)
+			{
+				meshletCount += buffers.Meshlets.size();
+			}
+
+			Log::Info("Built {} meshlets (max {} vertices, {} triangles)",
+				meshletCount, settings.MaxMeshletVertices, settings.MaxMeshletTriangles);
+		}
+	}
+
+	void MeshImporter::ProcessNode(
+		const aiNode* node, const Matrix& parentTransform, std::vector<u32>& outMeshReferences, std::vector<Matrix>& outTransforms)
+	{
+		// aiMatrix4x4 is row major for column vectors, transposing it gives the row vector matrix
+		const aiMatrix4x4& local = node->mTransformation;
+		const Matrix transform = Matrix(
+			local.a1, local.b1, local.c1, local.d1,
+			local.a2, local.b2, local.c2, local.d2,
+			local.a3, local.b3, local.c3, local.d3,
+			local.a4, local.b4, local.c4, local.d4) * parentTransform;
+
+		// Process meshes for this node
+		for (u32 i = 0; i < node->mNumMeshes; i++)
+		{
+			outMeshReferences.push_back(node->mMeshes[i]);
+			outTransforms.push_back(transform);
+		}
+
+		// Process children node
+		for (u32 i = 0; i < node->mNumChildren; i++)
+		{
+			ProcessNode(node->mChildren[i], transform, outMeshReferences, outTransforms);
+		}
+	}
+
+	void MeshImporter::BakeTransform(MeshBuffers& buffers, const Matrix& transform, const bool isTriangleList, const ImportSettings& settings)
+	{
+		if (transform == Matrix::Identity)
+		{
+			return;
+		}
+
+		TransformVertices(buffers.Vertices, transform, settings.ParallelConversion);
+
+		// Mirroring transforms turn front faces into back faces
+		if (isTriangleList && transform.Determinant() < 0.0f)
+		{
+			for (size_t i = 0; i + 2 < buffers.Indices.size(); i += 3)
+			{
+				std::swap(buffers.Indices[i + 1], buffers.Indices[i + 2]);
+			}
+		}
+	}
+
+	void MeshImporter::ExpandInstances(MeshData& meshData, std::span<const u32> meshInstances)
+	{
+		// The first reference keeps the uploaded mesh, later ones become instances sharing its buffers
+		std::vector<std::shared_ptr<Mesh>> uniqueMeshes = std::move(meshData.Meshes);
+		std::vector<bool> referenced(uniqueMeshes.size(), false);
+
+		meshData.Meshes.clear();
+		meshData.Meshes.reserve(meshInstances.size());
+		for (const u32 slot : meshInstances)
+		{
+			const std::shared_ptr<Mesh>& mesh = uniqueMeshes[slot];
+			meshData.Meshes.push_back(referenced[slot] ? mesh->CreateInstance() : mesh);
+			referenced[slot] = true;
+		}
+	}
+
+	void MeshImporter::MergeByMaterial(std::vector<MeshBuffers>& meshes, std::vector<u32>& meshInstances, const bool parallel)
+	{
+		// Only meshes drawn once can be merged, instances keep their own mesh
+		// Compact meshes are left alone since their positions are quantized against their own bounds
+		// Only triangle lists are merged, a point or line index stream appended to triangles would be drawn as triangles
+		std::vector<u32> referenceCounts(meshes.size(), 0);
+		for (const u32 slot : meshInstances)
+		{
+			referenceCounts[slot]++;
+		}
+
+		std::vector<std::vector<u32>> groups;  // Source meshes of every output mesh, in order of first appearance
+		std::vector<u32> remap(meshes.size());
+		std::unordered_map<u32, u32> materialGroups;
+		for (u32 i = 0; i < static_cast<u32>(meshes.size()); i++)
+		{
+			if (referenceCounts[i] == 1 && meshes[i].Format == VertexFormat::Standard && meshes[i].IsTriangleList)
+			{
+				const auto [it, inserted] = materialGroups.try_emplace(meshes[i].MaterialIndex, static_cast<u32>(groups.size()));
+				if (inserted)
+				{
+					groups.emplace_back();
+				}
+				groups[it->second].push_back(i);
+				remap[i] = it->second;
+			}
+			else
+			{
+				remap[i] = static_cast<u32>(groups.size());
+				groups.push_back({ i });
+			}
+		}
+
+		if (groups.size() == meshes.size())
+		{
+			return;
+		}
+
+		std::vector<MeshBuffers> merged(groups.size());
+		const auto MergeGroup = [&](const size_t target)
+		{
+			const std::vector<u32>& group = groups[target];
+			merged[target] = group.size() == 1 ? std::move(meshes[group.front()]) : MergeBuffers(meshes, group);
+		};
+
+		if (parallel)
+		{
+			std::vector<size_t> slots(groups.size());
+			std::iota(slots.begin(), slots.end(), size_t{ 0 });
+			std::for_each(std::execution::par, slots.begin(), slots.end(), MergeGroup);
+		}
+		else
+		{
+			for (size_t i = 0; i < groups.size(); i++)
+			{
+				MergeGroup(i);
+			}
+		}
+
+		// A merged mesh is drawn once, where the first of its sources was
+		std::vector<bool> emitted(groups.size(), false);
+		std::vector<u32> instances;
+		instances.reserve(meshInstances.size());
+		for (const u32 slot : meshInstances)
+		{
+			const u32 target = remap[slot];
+			if (groups[target].size() > 1)
+			{
+				if (emitted[target])
+				{
+					continue;
+				}
+				emitted[target] = true;
+			}
+			instances.push_back(target);
+		}
+
+		meshes        = std::move(merged);
+		meshInstances = std::move(instances);
+	}
+
+	MeshImporter::MeshBuffers MeshImporter::MergeBuffers(std::span<const MeshBuffers> meshes, std::span<const u32> sources)
+	{
+		MeshBuffers merged;
+		merged.MaterialIndex = meshes[sources.front()].MaterialIndex;
+
+		size_t vertexCount = 0;
+		size_t indexCount  = 0;
+		size_t meshletCount = 0;
+		u32 lodCount = 1;
+		for (const u32 source : sources)
+		{
+			const MeshBuffers& mesh = meshes[source];
+			vertexCount  += mesh.Vertices.size();
+			indexCount   += mesh.Indices.size();
+			meshletCount += mesh.Meshlets.size();
+			lodCount      = std::max(lodCount, static_cast<u32>(mesh.Lods.size()));
+			merged.Bounds = merged.Bounds.Merge(mesh.Bounds);
+			merged.VertexTime += mesh.VertexTime;
+			merged.IndexTime  += mesh.IndexTime;
+		}
+
+		merged.Vertices.reserve(vertexCount);
+		for (const u32 source : sources)
+		{
+			const std::vector<VertexType>& vertices = meshes[source].Vertices;
+			merged.Vertices.insert(merged.Vertices.end(), vertices.begin(), vertices.end());
+		}
+
+		// LOD n of the merged mesh is LOD n of every source, or its coarsest one when it has fewer
+		// Ranges are laid out LOD by LOD so each merged LOD stays contiguous
+		merged.Indices.reserve(indexCount);
+		merged.Meshlets.reserve(meshletCount);
+		for (u32 lod = 0; lod < lodCount; lod++)
+		{
+			Mesh::Lod mergedLod{ .IndexOffset = static_cast<u32>(merged.Indices.size()) };
+
+			u32 baseVertex = 0;
+			for (const u32 source : sources)
+			{
+				const MeshBuffers& mesh = meshes[source];
+				const Mesh::Lod sourceLod = mesh.Lods.empty()
+					? Mesh::Lod{ .IndexOffset = 0, .IndexCount = static_cast<u32>(mesh.Indices.size()) }
+					: mesh.Lods[std::min(lod, static_cast<u32>(mesh.Lods.size()) - 1)];
+
+				if (lod == 0)
+				{
+					// Meshlets cover LOD 0 only
+					const u32 meshletOffset = static_cast<u32>(merged.Indices.size());
+					for (Meshlet meshlet : mesh.Meshlets)
+					{
+						meshlet.IndexOffset += meshletOffset;
+						merged.Meshlets.push_back(meshlet);
+					}
+				}
+
+				const auto first = mesh.Indices.begin() + sourceLod.IndexOffset;
+				std::transform(first, first + sourceLod.IndexCount, std::back_inserter(merged.Indices),
+					[baseVertex](const u32 index) { return index + baseVertex; });
+
+				mergedLod.Error = std::max(mergedLod.Error, sourceLod.Error);
+				baseVertex += static_cast<u32>(mesh.Vertices.size());
+			}
+
+			mergedLod.IndexCount = static_cast<u32>(merged.Indices.size()) - mergedLod.IndexOffset;
+			if (lodCount > 1)
+			{
+				merged.Lods.push_back(mergedLod);
+			}
+		}
+
+		return merged;
+	}
+
+	MeshImporter::MeshBuffers MeshImporter::ProcessMesh(const aiMesh* mesh, const ImportSettings& settings, const Matrix& transform)
+	{
+		MeshBuffers buffers;
+		std::vector<VertexType>& vertices = buffers.Vertices;
+		std::vector<u32>& indices         = buffers.Indices;
+
+		{
+			Elos::ScopedTimer vertexTimer([&buffers](const Elos::Timer::TimeInfo& timeInfo)
+			{
+				buffers.VertexTime = timeInfo.TotalTime;
+			});
+
+			// Attribute presence is resolved once, the kernel then streams the aiVector3D arrays straight into the output
+			const VertexStreams streams
+			{
+				.Positions   = &mesh->mVertices[0].x,
+				.Normals     = mesh->HasNormals() ? &mesh->mNormals[0].x : nullptr,
+				.Tangents    = mesh->HasTangentsAndBitangents() ? &mesh->mTangents[0].x : nullptr,
+				.TexCoords   = mesh->HasTextureCoords(0) ? &mesh->mTextureCoords[0][0].x : nullptr,
+				.VertexCount = mesh->mNumVertices
+			};
+
+			vertices.resize(mesh->mNumVertices);
+			InterleaveVertices(streams, vertices, settings.ParallelConversion);
+		}
+
+		{
+			Elos::ScopedTimer indexTimer([&buffers](const Elos::Timer::TimeInfo& timeInfo)
+			{
+				buffers.IndexTime = timeInfo.TotalTime;
+			});
+
+			if (IsTriangleList(mesh))
+			{
+				indices.resize(size_t{ mesh->mNumFaces } * 3);
+				u32* out = indices.data();
+				for (u32 i = 0; i < mesh->mNumFaces; i++, out += 3)
+				{
+					const u32* face = mesh->mFaces[i].mIndices;
+					out[0] = face[0];
+					out[1] = face[1];
+					out[2] = face[2];
+				}
+			}
+			else
+			{
+				indices.reserve(size_t{ mesh->mNumFaces } * 3);
+				for (u32 i = 0; i < mesh->mNumFaces; i++)
+				{
+					const aiFace& face = mesh->mFaces[i];
+					indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
+				}
+			}
+		}
+
+		const bool isTriangleList = IsTriangleList(mesh);
+		BakeTransform(buffers, transform, isTriangleList, settings);
+
+		buffers.MaterialIndex  = mesh->mMaterialIndex;
+		buffers.IsTriangleList = isTriangleList;
+		PostProcessMesh(buffers, isTriangleList, mesh->HasNormals(), mesh->HasTextureCoords(0), settings);
+		return buffers;
+	}
+
+	MeshImporter::MeshBuffers MeshImporter::ProcessStreams(
+		const MeshStreams& mesh, const bool flipV, const ImportSettings& settings, const Matrix& transform)
+	{
+		MeshBuffers buffers;
+		std::vector<VertexType>& vertices = buffers.Vertices;
+		std::vector<u32>& indices         = buffers.Indices;
+		const u32 vertexCount             = mesh.Positions.Count;
+
+		{
+			Elos::ScopedTimer vertexTimer([&buffers](const Elos::Timer::TimeInfo& timeInfo)
+			{
+				buffers.VertexTime = timeInfo.TotalTime;
+			});
+
+			// Float streams are read in place, whatever their stride
+			const VertexStreams streams
+			{
+				.Positions      = reinterpret_cast<const f32*>(mesh.Positions.Data),
+				.Normals        = reinterpret_cast<const f32*>(mesh.Normals.Data),
+				.Tangents       = reinterpret_cast<const f32*>(mesh.Tangents.Data),
+				.TexCoords      = reinterpret_cast<const f32*>(mesh.TexCoords.Data),
+				.PositionStride = mesh.Positions.Stride,
+				.NormalStride   = mesh.Normals.Stride,
+				.TangentStride  = mesh.Tangents.Stride,
+				.TexCoordStride = mesh.TexCoords.Stride,
+				.VertexCount    = vertexCount
+			};
+
+			vertices.resize(vertexCount);
+			InterleaveVertices(streams, vertices, settings.ParallelConversion);
+		}
+
+		{
+			Elos::ScopedTimer indexTimer([&buffers](const Elos::Timer::TimeInfo& timeInfo)
+			{
+				buffers.IndexTime = timeInfo.TotalTime;
+			});
+
+			const IndexView& source = mesh.Indices;
+			if (!source.IsValid())
+			{
+				indices.resize(vertexCount);
+				std::iota(indices.begin(), indices.end(), 0u);
+			}
+			else if (source.IndexSize == sizeof(u32))
+			{
+				// Already in the importer index format
+				indices.resize(source.Count);
+				std::memcpy(indices.data(), source.Data, size_t{ source.Count } * sizeof(u32));
+			}
+			else
+			{
+				indices.resize(source.Count);
+				for (u32 i = 0; i < source.Count; i++)
+				{
+					u32 index = 0;
+					std::memcpy(&index, source.Data + size_t{ i } * source.IndexSize, source.IndexSize);
+					indices[i] = index;
+				}
+			}
+		}
+
+		const bool hasTexCoords = mesh.TexCoords.IsValid();
+		bool hasNormals         = mesh.Normals.IsValid();
+
+		// Same generation steps aiProcess_GenSmoothNormals and aiProcess_CalcTangentSpace run before the conversions below
+		if (!hasNormals && settings.CalculateNormals)
+		{
+			ComputeNormals(buffers);
+			hasNormals = true;
+		}
+
+		if (!mesh.Tangents.IsValid() && settings.CalculateTangents && hasNormals && hasTexCoords)
+		{
+			ComputeTangents(buffers);
+		}
+
+		// Match the Assimp path: flipV stands in for aiProcess_FlipUVs and aiProcess_MakeLeftHanded mirrors the Z axis
+		if (flipV || settings.ConvertToLeftHanded)
+		{
+			for (VertexType& vertex : vertices)
+			{
+				if (settings.ConvertToLeftHanded)
+				{
+					vertex.position.z = -vertex.position.z;
+					vertex.normal.z   = -vertex.normal.z;
+					vertex.tangent.z  = -vertex.tangent.z;
+				}
+
+				if (flipV)
+				{
+					vertex.textureCoordinate.y = 1.0f - vertex.textureCoordinate.y;
+				}
+			}
+		}
 
-		if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
+		if (settings.FlipWindingOrder)
 		{
-			return std::unexpected(ImportError
+			for (size_t i = 0; i + 2 < indices.size(); i += 3)
 			{
-				.Type      = ImportError::Type::AssimpError,
-				.ErrorCode = E_FAIL,
-				.Message   = "Assimp error: " + Elos::String(importer.GetErrorString())
-			});
+				std::swap(indices[i + 1], indices[i + 2]);
+			}
 		}
 
-		MeshData meshData;
-		meshData.Meshes.reserve(scene->mNumMeshes);
+		BakeTransform(buffers, transform, true, settings);
+
+		buffers.MaterialIndex = mesh.MaterialIndex;
+		PostProcessMesh(buffers, true, hasNormals, hasTexCoords, settings);
+		return buffers;
+	}
+
+	void MeshImporter::ComputeNormals(MeshBuffers& buffers)
+	{
+		std::vector<VertexType>& vertices = buffers.Vertices;
+		std::vector<Vector3> normals(vertices.size(), Vector3::Zero);
 
-		if (auto result = ProcessNode(resourceFactory, meshData, scene->mRootNode, scene); !result)
+		// Area weighted face normals, the cross product length is twice the triangle area
+		const std::vector<u32>& indices = buffers.Indices;
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
 		{
-			return std::unexpected(result.error());
+			const Vector3 p0 = vertices[indices[i + 0]].position;
+			const Vector3 p1 = vertices[indices[i + 1]].position;
+			const Vector3 p2 = vertices[indices[i + 2]].position;
+			const Vector3 normal = (p1 - p0).Cross(p2 - p0);
+
+			normals[indices[i + 0]] += normal;
+			normals[indices[i + 1]] += normal;
+			normals[indices[i + 2]] += normal;
 		}
 
-		if (auto result = LoadTextures(resourceFactory, meshData, scene); !result)
+		for (size_t i = 0; i < vertices.size(); i++)
 		{
-			// We don't exit if we fail to import textures
-			auto& error = result.error();
-			Log::Warn("Failed to import texture {} for mesh or model {}",
-				error.Message, filePath.string());
+			normals[i].Normalize();
+			vertices[i].normal = normals[i];
 		}
-
-		return meshData;
 	}
-	
-	std::expected<void, MeshImporter::ImportError> MeshImporter::ProcessNode(const ResourceFactory& resourceFactory, MeshData& meshData, aiNode* node, const aiScene* scene)
+
+	void MeshImporter::ComputeTangents(MeshBuffers& buffers)
 	{
-		// Process meshes for this node
-		for (u32 i = 0; i < node->mNumMeshes; i++)
+		std::vector<VertexType>& vertices = buffers.Vertices;
+		std::vector<Vector3> tangents(vertices.size(), Vector3::Zero);
+
+		// Per triangle dP/du, averaged per vertex and orthogonalized against the normal
+		const std::vector<u32>& indices = buffers.Indices;
+		for (size_t i = 0; i + 2 < indices.size(); i += 3)
 		{
-			aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-			if (auto result = ProcessMesh(resourceFactory, meshData, mesh, scene); !result)
+			const VertexType& v0 = vertices[indices[i + 0]];
+			const VertexType& v1 = vertices[indices[i + 1]];
+			const VertexType& v2 = vertices[indices[i + 2]];
+
+			const Vector3 edge1 = Vector3(v1.position) - Vector3(v0.position);
+			const Vector3 edge2 = Vector3(v2.position) - Vector3(v0.position);
+			const Vector2 deltaUV1 = Vector2(v1.textureCoordinate) - Vector2(v0.textureCoordinate);
+			const Vector2 deltaUV2 = Vector2(v2.textureCoordinate) - Vector2(v0.textureCoordinate);
+
+			const f32 determinant = deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y;
+			if (determinant == 0.0f)
 			{
-				return std::unexpected(result.error());
+				continue;  // Degenerate UV mapping, does not define a direction
 			}
+
+			// Normalized so tiny UV islands weigh as much as large ones
+			Vector3 tangent = (edge1 * deltaUV2.y - edge2 * deltaUV1.y) / determinant;
+			tangent.Normalize();
+			tangents[indices[i + 0]] += tangent;
+			tangents[indices[i + 1]] += tangent;
+			tangents[indices[i + 2]] += tangent;
 		}
 
-		// Process children node
-		for (UINT i = 0; i < node->mNumChildren; i++)
+		for (size_t i = 0; i < vertices.size(); i++)
+		{
+			const Vector3 normal = vertices[i].normal;
+			Vector3 tangent = tangents[i] - normal * normal.Dot(tangents[i]);
+
+			if (tangent.LengthSquared() <= kEpsilon)
+			{
+				// No usable UV gradient, any direction perpendicular to the normal keeps the basis valid
+				tangent = std::abs(normal.x) < 0.9f ? Vector3::UnitX.Cross(normal) : Vector3::UnitY.Cross(normal);
+			}
+
+			tangent.Normalize();
+			vertices[i].tangent = Vector4(tangent.x, tangent.y, tangent.z, 0.0f);
+		}
+	}
+
+	void MeshImporter::PostProcessMesh(
+		MeshBuffers& buffers,
+		const bool isTriangleList,
+		const bool hasNormals,
+		const bool hasTexCoords,
+		const ImportSettings& settings)
+	{
+		std::vector<VertexType>& vertices = buffers.Vertices;
+		std::vector<u32>& indices         = buffers.Indices;
+
+		// Reordering only makes sense for pure triangle lists
+		if (settings.OptimizeVertexCache && isTriangleList)
 		{
-			if (auto result = ProcessNode(resourceFactory, meshData, node->mChildren[i], scene); !result)
+			const u32 vertexCount = static_cast<u32>(vertices.size());
+			buffers.ACMRBefore = MeshOptimizer::ComputeACMR(indices, vertexCount);
+
+			if (settings.OptimizeOverdraw)
 			{
-				return std::unexpected(result.error());
+				buffers.OverdrawBefore = MeshOptimizer::EstimateOverdraw(indices, vertices.data(), vertexCount, sizeof(VertexType), FrontFaceSign).Overdraw;
+			}
+
+			MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+
+			if (settings.OptimizeOverdraw)
+			{
+				MeshOptimizer::OptimizeOverdraw(
+					indices, vertices.data(), vertexCount, sizeof(VertexType), FrontFaceSign, settings.OverdrawThreshold);
+				buffers.OverdrawAfter = MeshOptimizer::EstimateOverdraw(indices, vertices.data(), vertexCount, sizeof(VertexType), FrontFaceSign).Overdraw;
 			}
+
+			buffers.ACMRAfter = MeshOptimizer::ComputeACMR(indices, vertexCount);
 		}
 
-		return {};
+		if (settings.GenerateLods && isTriangleList)
+		{
+			GenerateLods(buffers, hasNormals, hasTexCoords, settings);
+		}
+
+		// Runs last, it depends on the final triangle order
+		if (settings.OptimizeVertexFetch)
+		{
+			const u32 vertexCount = MeshOptimizer::OptimizeVertexFetch(
+				indices, vertices.data(), static_cast<u32>(vertices.size()), sizeof(VertexType));
+			vertices.resize(vertexCount);
+		}
+
+		buffers.Bounds = Bounds::FromPositions(vertices.data(), static_cast<u32>(vertices.size()), sizeof(VertexType));
+
+		// Needs the final index order, meshlets are ranges of LOD 0
+		if (settings.BuildMeshlets && isTriangleList)
+		{
+			buffers.Meshlets = MeshletBuilder::Build(
+				std::span(indices).first(buffers.GetLodIndexCount()),
+				vertices.data(),
+				static_cast<u32>(vertices.size()),
+				sizeof(VertexType),
+				settings.MaxMeshletVertices,
+				settings.MaxMeshletTriangles,
+				settings.ParallelConversion);
+		}
+
+		if (settings.VertexFormat == VertexFormat::Compact)
+		{
+			// Quantize last so the optimizers above keep working on full precision positions
+			buffers.CompactVertices.resize(vertices.size());
+			buffers.Dequantization = PackCompactVertices(vertices, buffers.CompactVertices);
+			buffers.Format         = VertexFormat::Compact;
+
+			vertices.clear();
+			vertices.shrink_to_fit();
+		}
 	}
 
-	std::expected<void, MeshImporter::ImportError> MeshImporter::ProcessMesh(const ResourceFactory& resourceFactory, MeshData& meshData, aiMesh* mesh, [[maybe_unused]] const aiScene* scene)
+	void MeshImporter::GenerateLods(MeshBuffers& buffers, const bool hasNormals, const bool hasTexCoords, const ImportSettings& settings)
 	{
-		using VertexType = DirectX::VertexPositionNormalTangentColorTexture;
+		std::vector<u32>& indices = buffers.Indices;
+		const u32 vertexCount     = static_cast<u32>(buffers.Vertices.size());
 
-		std::vector<VertexType> vertices;
-		std::vector<u32> indices;
+		buffers.Lods.clear();
+		buffers.Lods.push_back(Mesh::Lod{ .IndexOffset = 0, .IndexCount = static_cast<u32>(indices.size()), .Error = 0.0f });
 
-		vertices.reserve(mesh->mNumVertices);
-		indices.reserve(mesh->mNumFaces * 3);
-
-		// Extract vertices
-		for (u32 i = 0; i < mesh->mNumVertices; i++)
+		Vector3 boundsMin = buffers.Vertices.empty() ? Vector3::Zero : Vector3(buffers.Vertices.front().position);
+		Vector3 boundsMax = boundsMin;
+		for (const VertexType& vertex : buffers.Vertices)
 		{
-			VertexType vertex{};
+			boundsMin = Vector3::Min(boundsMin, vertex.position);
+			boundsMax = Vector3::Max(boundsMax, vertex.position);
+		}
 
-			vertex.position.x = mesh->mVertices[i].x;
-			vertex.position.y = mesh->mVertices[i].y;
-			vertex.position.z = mesh->mVertices[i].z;
+		const f32 maxError = settings.LodMaxError * Vector3::Distance(boundsMin, boundsMax) * 0.5f;
 
-			if (mesh->HasNormals())
+		MeshSimplifier::SimplifyOptions options;
+		options.NormalOffset   = hasNormals ? static_cast<u32>(offsetof(VertexType, normal)) : MeshSimplifier::NoAttribute;
+		options.TexCoordOffset = hasTexCoords ? static_cast<u32>(offsetof(VertexType, textureCoordinate)) : MeshSimplifier::NoAttribute;
+
+		// Each LOD is simplified from the previous one, so its error is bounded by the sum of the steps
+		std::vector<u32> previous = indices;
+		f32 accumulatedError = 0.0f;
+
+		for (u32 lod = 1; lod < settings.MaxLodCount; lod++)
+		{
+			const u32 targetIndexCount = static_cast<u32>(static_cast<f32>(previous.size()) * settings.LodReductionRatio);
+			if (targetIndexCount < 3)
 			{
-				vertex.normal.x = mesh->mNormals[i].x;
-				vertex.normal.y = mesh->mNormals[i].y;
-				vertex.normal.z = mesh->mNormals[i].z;
+				break;
 			}
 
-			if (mesh->HasTextureCoords(0))
+			MeshSimplifier::SimplifyResult result = MeshSimplifier::Simplify(
+				previous, buffers.Vertices.data(), vertexCount, sizeof(VertexType), targetIndexCount, maxError, options);
+
+			// Stop once the error limit or locked borders keep the simplifier from making real progress
+			if (result.Indices.empty() || static_cast<f32>(result.Indices.size()) > static_cast<f32>(previous.size()) * 0.9f)
 			{
-				vertex.textureCoordinate.x = mesh->mTextureCoords[0][i].x;
-				vertex.textureCoordinate.y = mesh->mTextureCoords[0][i].y;
+				break;
 			}
 
-			if (mesh->HasTangentsAndBitangents())
+			if (settings.OptimizeVertexCache)
 			{
-				vertex.tangent.x = mesh->mTangents[i].x;
-				vertex.tangent.y = mesh->mTangents[i].y;
-				vertex.tangent.z = mesh->mTangents[i].z;
+				MeshOptimizer::OptimizeVertexCache(result.Indices, vertexCount);
 			}
 
-			vertices.push_back(vertex);
-		}
-
-		// Extract indices
-		for (u32 i = 0; i < mesh->mNumFaces; i++)
-		{
-			const aiFace& face = mesh->mFaces[i];
-			for (u32 j = 0; j < face.mNumIndices; ++j)
+			accumulatedError += result.Error;
+			buffers.Lods.push_back(Mesh::Lod
 			{
-				indices.push_back(face.mIndices[j]);
-			}
+				.IndexOffset = static_cast<u32>(indices.size()),
+				.IndexCount  = static_cast<u32>(result.Indices.size()),
+				.Error       = accumulatedError
+			});
+
+			indices.insert(indices.end(), result.Indices.begin(), result.Indices.end());
+			previous = std::move(result.Indices);
 		}
+	}
 
+	std::expected<void, MeshImporter::ImportError> MeshImporter::UploadMesh(const ResourceFactory& resourceFactory, MeshData& meshData, const MeshView& mesh)
+	{
 		Mesh::MeshDesc meshDesc;
-		meshDesc.VertexStride = sizeof(VertexType);
+		meshDesc.VertexStride = mesh.VertexStride;
 		meshDesc.Topology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+		meshDesc.Format = mesh.Format;
+		meshDesc.Dequantization = mesh.Dequantization;
+		meshDesc.Meshlets = mesh.Meshlets;
+		meshDesc.Lods = mesh.Lods;
+		meshDesc.Bounds = mesh.Bounds;
 
 		auto meshResult = resourceFactory.CreateMesh(
-			vertices.data(),
-			static_cast<u32>(vertices.size()),
-			std::span(indices),
+			mesh.Vertices,
+			mesh.VertexCount,
+			mesh.Indices,
 			meshDesc);
 
 		if (!meshResult)
@@ -159,49 +1426,454 @@ namespace Prism::Gfx
 		return {};
 	}
 
-	std::expected<void, MeshImporter::ImportError> MeshImporter::LoadTextures(const ResourceFactory& resourceFactory, MeshData& meshData, const aiScene* scene)
+	std::expected<void, MeshImporter::ImportError> MeshImporter::UploadMeshes(
+		const ResourceFactory& resourceFactory, MeshData& meshData, std::span<const MeshView> meshes, const bool pack)
 	{
-		if (!scene->HasTextures())
+		meshData.Meshes.reserve(meshData.Meshes.size() + meshes.size());
+		if (!pack)
 		{
+			for (const MeshView& mesh : meshes)
+			{
+				if (auto result = UploadMesh(resourceFactory, meshData, mesh); !result)
+				{
+					return std::unexpected(result.error());
+				}
+			}
 			return {};
 		}
 
-		meshData.Textures.reserve(scene->mNumTextures);
+		// Consecutive meshes with the same vertex layout share one buffer pair, split when it would exceed MaxPackBytes
+		size_t first = 0;
+		while (first < meshes.size())
+		{
+			const MeshView& head = meshes[first];
+			u64 packBytes   = 0;
+			u32 vertexCount = 0;
+			size_t indexCount = 0;
+			size_t last = first;
+			for (; last < meshes.size(); last++)
+			{
+				const MeshView& mesh = meshes[last];
+				const u64 meshBytes = u64{ mesh.VertexCount } * mesh.VertexStride + mesh.Indices.size_bytes();
+				if (mesh.Format != head.Format || mesh.VertexStride != head.VertexStride ||
+					(last > first && packBytes + meshBytes > MaxPackBytes))
+				{
+					break;
+				}
+				packBytes   += meshBytes;
+				vertexCount += mesh.VertexCount;
+				indexCount  += mesh.Indices.size();
+			}
+
+			const std::span<const MeshView> pack = meshes.subspan(first, last - first);
+			first = last;
+
+			if (pack.size() == 1)
+			{
+				if (auto result = UploadMesh(resourceFactory, meshData, pack.front()); !result)
+				{
+					return std::unexpected(result.error());
+				}
+				continue;
+			}
+
+			std::vector<byte> vertices(u64{ vertexCount } * head.VertexStride);
+			std::vector<u32> indices;
+			std::vector<Mesh::SubmeshDesc> submeshes;
+			indices.reserve(indexCount);
+			submeshes.reserve(pack.size());
+
+			u32 baseVertex = 0;
+			for (const MeshView& mesh : pack)
+			{
+				submeshes.push_back(Mesh::SubmeshDesc
+				{
+					.BaseVertex     = baseVertex,
+					.VertexCount    = mesh.VertexCount,
+					.StartIndex     = static_cast<u32>(indices.size()),
+					.IndexCount     = static_cast<u32>(mesh.Indices.size()),
+					.Dequantization = mesh.Dequantization,
+					.Meshlets       = mesh.Meshlets,
+					.Lods           = mesh.Lods,
+					.Bounds         = mesh.Bounds
+				});
+
+				std::copy_n(static_cast<const byte*>(mesh.Vertices), u64{ mesh.VertexCount } * mesh.VertexStride,
+					vertices.data() + u64{ baseVertex } * head.VertexStride);
+				indices.insert(indices.end(), mesh.Indices.begin(), mesh.Indices.end());
+				baseVertex += mesh.VertexCount;
+			}
+
+			Mesh::MeshDesc meshDesc;
+			meshDesc.VertexStride = head.VertexStride;
+			meshDesc.Topology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+			meshDesc.Format = head.Format;
+
+			auto meshesResult = resourceFactory.CreateMeshes(vertices.data(), vertexCount, indices, meshDesc, submeshes);
+			if (!meshesResult)
+			{
+				return std::unexpected(ImportError
+				{
+					.Type      = ImportError::Type::MeshCreationFailed,
+					.ErrorCode = meshesResult.error().ErrorCode,
+					.Message   = "Failed to create packed meshes: " + meshesResult.error().Message
+				});
+			}
+
+			std::ranges::move(meshesResult.value(), std::back_inserter(meshData.Meshes));
+		}
+
+		return {};
+	}
+
+	std::vector<MeshImporter::TextureBuffers> MeshImporter::LoadTextures(const aiScene* scene)
+	{
+		std::vector<TextureBuffers> textures;
+
+		if (!scene->HasTextures())
+		{
+			return textures;
+		}
+
+		textures.reserve(scene->mNumTextures);
 
 		for (u32 i = 0; i < scene->mNumTextures; i++)
 		{
 			const aiTexture* texture = scene->mTextures[i];
-			
-			std::vector<byte> textureData;
+			TextureBuffers& buffers = textures.emplace_back();
+
+			// Create a mapping for the texture name/identifier
+			buffers.Name = texture->mFilename.length > 0
+				? Elos::String(texture->mFilename.C_Str())
+				: "EmbeddedTexture_" + std::to_string(i);
 
 			if (texture->mHeight == 0)
 			{
 				// Compressed texture: data is stored as a continuous block
-				textureData.resize(texture->mWidth);
-				std::memcpy(textureData.data(), texture->pcData, texture->mWidth);
+				buffers.IsCompressed = true;
+				buffers.Data.resize(texture->mWidth);
+				std::memcpy(buffers.Data.data(), texture->pcData, texture->mWidth);
 			}
 			else
 			{
 				// Uncompressed texture: data is stored as an array of texels
-				const size_t dataSize = texture->mWidth * texture->mHeight * 4; // RGBA
-				textureData.resize(dataSize);
+				buffers.Width  = texture->mWidth;
+				buffers.Height = texture->mHeight;
+
+				// aiTexel is BGRA in memory, the converted texels are both uploaded and cached from this buffer
+				buffers.Data.resize(size_t{ texture->mWidth } * texture->mHeight * 4);
+				ConvertBgra8ToRgba8(texture->pcData, buffers.Data.data(), texture->mWidth, texture->mHeight);
+			}
+		}
+
+		return textures;
+	}
+
+	void MeshImporter::PrepareTextureSources(std::span<TextureView> textures, std::span<const MaterialSource> materials, const ImportSettings& settings)
+	{
+		const bool cook = settings.GenerateMips || settings.TextureCompression != TextureCompression::None;
+		const std::vector<bool> isNormalMap = FindNormalMaps(textures.size(), materials);
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			// DDS/KTX2 already hold their final format and mips
+			TextureView& texture = textures[i];
+			texture.NeedsCook    = cook && !(texture.IsCompressed && TextureContainer::IsContainer(texture.Data));
+			texture.SourceKey    = HashTextureSource(texture, isNormalMap[i], settings);
+			texture.SourceBytes  = texture.Data.size();
+		}
+	}
 
-				for (u32 h = 0; h < texture->mHeight; h++)
+	std::vector<std::shared_ptr<Texture2D>> MeshImporter::ResolveTextures(
+		std::vector<TextureView>& textures,
+		std::span<const MaterialSource> materials,
+		const ImportSettings& settings,
+		std::vector<TextureBuffers>& outCooked,
+		ImportReport& report)
+	{
+		// Hits are held until the upload so they cannot expire in between
+		std::vector<std::shared_ptr<Texture2D>> sharedTextures(textures.size());
+		if (settings.TextureCache)
+		{
+			TextureCache& cache = *settings.TextureCache;
+			for (size_t i = 0; i < textures.size(); i++)
+			{
+				sharedTextures[i] = cache.Find(textures[i].SourceKey, textures[i].SourceBytes);
+				if (sharedTextures[i])
 				{
-					for (u32 w = 0; w < texture->mWidth; w++)
-					{
-						const aiTexel& texel = texture->pcData[h * texture->mWidth + w];
-						const size_t index = (h * texture->mWidth + w) * 4;
+					report.SharedTextures++;
+					Log::Info("Reused texture: {}", textures[i].Name);
+				}
+			}
+		}
 
-						textureData[index + 0] = static_cast<byte>(texel.r);
-						textureData[index + 1] = static_cast<byte>(texel.g);
-						textureData[index + 2] = static_cast<byte>(texel.b);
-						textureData[index + 3] = static_cast<byte>(texel.a);
-					}
+		// Hits keep their source view, a mesh cache written from it cooks them on a later miss
+		const std::vector<bool> isNormalMap = FindNormalMaps(textures.size(), materials);
+		std::vector<TextureView> sources;
+		std::vector<bool> sourceIsNormalMap;
+		std::vector<size_t> sourceSlots;
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			if (textures[i].NeedsCook && !sharedTextures[i])
+			{
+				sources.push_back(textures[i]);
+				sourceIsNormalMap.push_back(isNormalMap[i]);
+				sourceSlots.push_back(i);
+			}
+		}
+
+		if (!sources.empty())
+		{
+			outCooked = CookTextures(sources, sourceIsNormalMap, settings, report);
+			for (size_t i = 0; i < sourceSlots.size(); i++)
+			{
+				textures[sourceSlots[i]] = outCooked[i].AsView();
+			}
+		}
+
+		return sharedTextures;
+	}
+
+	std::vector<MeshImporter::TextureBuffers> MeshImporter::CookTextures(
+		std::span<const TextureView> textures,
+		const std::vector<bool>& isNormalMap,
+		const ImportSettings& settings,
+		ImportReport& report)
+	{
+		std::vector<TextureBuffers> cooked;
+		cooked.reserve(textures.size());
+
+		// WIC needs COM on the calling thread, so images decode in order and each mip chain is filtered on the worker pool
+		const Clock::time_point mipStart = Clock::now();
+		u64 mipBytes = 0;
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			const TextureView& texture = textures[i];
+			TextureBuffers& buffers = cooked.emplace_back();
+			buffers.Name        = Elos::String(texture.Name);
+			buffers.SourceKey   = texture.SourceKey;
+			buffers.SourceBytes = texture.SourceBytes;
+
+			if (texture.IsCompressed && TextureContainer::IsContainer(texture.Data))
+			{
+				// DDS/KTX2 already hold their final format and mips, keep the file as the cooked data
+				buffers.IsCompressed = true;
+				buffers.Data.assign(texture.Data.begin(), texture.Data.end());
+				continue;
+			}
+
+			if (texture.IsCompressed)
+			{
+				auto imageResult = DecodeImage(texture.Data);
+				if (!imageResult)
+				{
+					// Keep the encoded image, the upload still goes through WIC without mips
+					Log::Warn("{} for texture {}, uploading it without mips", imageResult.error().Message, texture.Name);
+					buffers.IsCompressed = true;
+					buffers.Data.assign(texture.Data.begin(), texture.Data.end());
+					continue;
+				}
+
+				buffers.Width  = imageResult.value().Width;
+				buffers.Height = imageResult.value().Height;
+				buffers.Data   = std::move(imageResult.value().Texels);
+			}
+			else
+			{
+				buffers.Width  = texture.Width;
+				buffers.Height = texture.Height;
+				buffers.Data.assign(texture.Data.begin(), texture.Data.begin() + GetMipLevel(texture.Width, texture.Height, 0).GetSize());
+			}
+
+			buffers.MipLevels = settings.GenerateMips ? GetMipLevelCount(buffers.Width, buffers.Height) : 1;
+			buffers.Data.resize(GetMipChainSize(buffers.Width, buffers.Height, buffers.MipLevels));
+			GenerateMips(
+				buffers.Data.data(),
+				buffers.Width,
+				buffers.Height,
+				buffers.MipLevels,
+				settings.MipFilter,
+				settings.SrgbTextures && !isNormalMap[i],
+				settings.ParallelConversion);
+			mipBytes += buffers.Data.size();
+		}
+		report.AddPhase("Textures.Mips", SecondsSince(mipStart), mipBytes);
+
+		if (settings.TextureCompression != TextureCompression::None)
+		{
+			const Clock::time_point compressStart = Clock::now();
+			u64 compressedBytes = 0;
+			for (size_t i = 0; i < cooked.size(); i++)
+			{
+				CompressTexture(cooked[i], isNormalMap[i], settings);
+				compressedBytes += cooked[i].Data.size();
+			}
+			report.AddPhase("Textures.Compress", SecondsSince(compressStart), compressedBytes);
+		}
+
+		return cooked;
+	}
+
+	void MeshImporter::CompressTexture(TextureBuffers& texture, const bool isNormalMap, const ImportSettings& settings)
+	{
+		// D3D11 needs the top level of a block compressed texture to be made of whole blocks
+		if (texture.IsCompressed || texture.Width % 4 != 0 || texture.Height % 4 != 0)
+		{
+			return;
+		}
+
+		const auto HasAlpha = [&texture]()
+		{
+			for (size_t i = 3; i < size_t{ texture.Width } * texture.Height * 4; i += 4)
+			{
+				if (static_cast<u8>(texture.Data[i]) != 255)
+				{
+					return true;
+				}
+			}
+			return false;
+		};
+
+		const BlockFormat format = isNormalMap
+			? BlockFormat::BC5
+			: settings.TextureCompression == TextureCompression::HighQuality ? BlockFormat::BC7
+			: HasAlpha() ? BlockFormat::BC3 : BlockFormat::BC1;
+		const DXGI_FORMAT dxgiFormat = GetDxgiFormat(format);
+
+		std::vector<byte> blocks(GetChainSize(dxgiFormat, texture.Width, texture.Height, texture.MipLevels));
+		for (u32 level = 0; level < texture.MipLevels; level++)
+		{
+			const SubresourceLayout source      = GetSubresourceLayout(texture.Format, texture.Width, texture.Height, level);
+			const SubresourceLayout destination = GetSubresourceLayout(dxgiFormat, texture.Width, texture.Height, level);
+			CompressImage(
+				texture.Data.data() + source.Offset,
+				source.Width,
+				source.Height,
+				format,
+				blocks.data() + destination.Offset,
+				settings.ParallelConversion);
+		}
+
+		texture.Format = dxgiFormat;
+		texture.Data   = std::move(blocks);
+	}
+
+	std::vector<MaterialSource> MeshImporter::LoadMaterials(const aiScene* scene)
+	{
+		std::vector<MaterialSource> materials;
+		materials.reserve(scene->mNumMaterials);
+
+		for (u32 i = 0; i < scene->mNumMaterials; i++)
+		{
+			const aiMaterial* source = scene->mMaterials[i];
+			MaterialSource& material = materials.emplace_back();
+
+			aiString name;
+			material.Name = source->Get(AI_MATKEY_NAME, name) == AI_SUCCESS && name.length > 0
+				? Elos::String(name.C_Str())
+				: "Material_" + std::to_string(i);
+
+			// PBR importers fill the base color, the others only the diffuse color and opacity
+			aiColor4D color;
+			if (source->Get(AI_MATKEY_BASE_COLOR, color) == AI_SUCCESS)
+			{
+				material.BaseColor = Vector4(color.r, color.g, color.b, color.a);
+			}
+			else if (source->Get(AI_MATKEY_COLOR_DIFFUSE, color) == AI_SUCCESS)
+			{
+				f32 opacity = 1.0f;
+				source->Get(AI_MATKEY_OPACITY, opacity);
+				material.BaseColor = Vector4(color.r, color.g, color.b, opacity);
+			}
+
+			aiColor3D emissive;
+			if (source->Get(AI_MATKEY_COLOR_EMISSIVE, emissive) == AI_SUCCESS)
+			{
+				material.Emissive = Vector3(emissive.r, emissive.g, emissive.b);
+			}
+
+			source->Get(AI_MATKEY_METALLIC_FACTOR, material.Metallic);
+			source->Get(AI_MATKEY_ROUGHNESS_FACTOR, material.Roughness);
+
+			// Only embedded textures are loaded, their index in mTextures is their index in the texture list
+			aiString path;
+			if (source->GetTexture(aiTextureType_BASE_COLOR, 0, &path) == AI_SUCCESS ||
+				source->GetTexture(aiTextureType_DIFFUSE, 0, &path) == AI_SUCCESS)
+			{
+				if (const i32 texture = scene->GetEmbeddedTextureAndIndex(path.C_Str()).second; texture >= 0)
+				{
+					material.BaseColorTexture = static_cast<u32>(texture);
+				}
+			}
+
+			if (source->GetTexture(aiTextureType_NORMALS, 0, &path) == AI_SUCCESS)
+			{
+				if (const i32 texture = scene->GetEmbeddedTextureAndIndex(path.C_Str()).second; texture >= 0)
+				{
+					material.NormalTexture = static_cast<u32>(texture);
 				}
 			}
+		}
+
+		return materials;
+	}
+
+	std::expected<void, MeshImporter::ImportError> MeshImporter::UploadMaterials(
+		const ResourceFactory& resourceFactory, MeshData& meshData, std::span<const MaterialSource> materials, std::span<const MeshView> meshes)
+	{
+		meshData.Materials.reserve(materials.size());
+		for (const MaterialSource& material : materials)
+		{
+			// Textures that failed to load leave the material untextured
+			const bool hasTexture = material.BaseColorTexture < meshData.Textures.size();
+			auto materialResult = resourceFactory.CreateMaterial(Material::MaterialDesc
+			{
+				.Name             = material.Name,
+				.BaseColor        = material.BaseColor,
+				.Emissive         = material.Emissive,
+				.Metallic         = material.Metallic,
+				.Roughness        = material.Roughness,
+				.BaseColorTexture = hasTexture ? meshData.Textures[material.BaseColorTexture] : nullptr
+			});
+
+			if (!materialResult)
+			{
+				return std::unexpected(ImportError
+				{
+					.Type      = ImportError::Type::MaterialCreationFailed,
+					.ErrorCode = materialResult.error().ErrorCode,
+					.Message   = "Failed to create material: " + materialResult.error().Message
+				});
+			}
+			meshData.Materials.push_back(std::move(materialResult.value()));
+		}
+
+		// Uploaded meshes match the views one to one, before instances are expanded
+		for (size_t i = 0; i < meshes.size(); i++)
+		{
+			if (meshes[i].MaterialIndex < meshData.Materials.size())
+			{
+				meshData.Meshes[i]->SetMaterial(meshData.Materials[meshes[i].MaterialIndex]);
+			}
+		}
+
+		return {};
+	}
 
-			auto textureResult = CreateTextureFromData(resourceFactory, textureData, texture);
+	std::expected<void, MeshImporter::ImportError> MeshImporter::UploadTexture(
+		const ResourceFactory& resourceFactory,
+		MeshData& meshData,
+		const TextureView& texture,
+		std::shared_ptr<Texture2D> sharedTexture,
+		const ImportSettings& settings)
+	{
+		// Texture cache hits were found by ResolveTextures, they are shared with the models that created or reused them
+		if (!sharedTexture)
+		{
+			// Only cooked chains stream, encoded images and containers have no chain laid out in memory
+			const bool stream = settings.Streamer && !texture.IsCompressed && texture.MipLevels > 1;
+			auto textureResult = stream
+				? settings.Streamer->CreateTexture(texture.Width, texture.Height, texture.MipLevels, texture.Format, texture.Data)
+				: CreateTextureFromData(resourceFactory, texture);
 			if (!textureResult)
 			{
 				return std::unexpected(ImportError
@@ -212,52 +1884,76 @@ namespace Prism::Gfx
 				});
 			}
 
-			// Store the texture
-			meshData.Textures.push_back(std::move(textureResult.value()));
-
-			// Create a mapping for the texture name/identifier
-			const Elos::String textureName = texture->mFilename.length > 0
-				? Elos::String(texture->mFilename.C_Str())
-				: "EmbeddedTexture_" + std::to_string(i);
-			
-			meshData.TextureMap[textureName] = i;
-			Log::Info("Loaded texture: {}", textureName);
+			sharedTexture = std::move(textureResult.value());
+			if (settings.TextureCache)
+			{
+				settings.TextureCache->Insert(texture.SourceKey, texture.SourceBytes, sharedTexture);
+			}
+			Log::Info("Loaded texture: {}", texture.Name);
 		}
 
+		// Store the texture
+		meshData.TextureMap[Elos::String(texture.Name)] = meshData.Textures.size();
+		meshData.Textures.push_back(std::move(sharedTexture));
 
 		return {};
 	}
 
 	std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> 
-		MeshImporter::CreateTextureFromData(const ResourceFactory& resourceFactory, const std::vector<byte>& textureData, const aiTexture* aiTex)
+		MeshImporter::CreateTextureFromData(const ResourceFactory& resourceFactory, const TextureView& texture)
 	{
-		if (aiTex->mHeight == 0)
+		if (texture.IsCompressed)
 		{
-			// Compressed texture - use WIC to load
-			return CreateTextureFromCompressedData(resourceFactory, textureData);
+			// Image file, DDS/KTX2 upload as stored and other formats go through WIC
+			return CreateTextureFromCompressedData(resourceFactory, texture.Data);
 		}
 		else
 		{
-			// Uncompressed RGBA texture
+			// Raw RGBA8 or block compressed texels, levels are stored back to back
+			if (texture.MipLevels == 0 || texture.Data.size() < GetChainSize(texture.Format, texture.Width, texture.Height, texture.MipLevels))
+			{
+				return std::unexpected(Texture2D::TextureError
+				{
+					.Type      = Texture2D::TextureError::Type::InvalidDimensions,
+					.ErrorCode = E_INVALIDARG,
+					.Message   = "Texture data is smaller than its mip chain"
+				});
+			}
+
 			Texture2D::Texture2DDesc desc;
-			desc.Width          = aiTex->mWidth;
-			desc.Height         = aiTex->mHeight;
-			desc.Format         = DXGI_FORMAT_R8G8B8A8_UNORM;
+			desc.Width          = texture.Width;
+			desc.Height         = texture.Height;
+			desc.Format         = texture.Format;
 			desc.Usage          = D3D11_USAGE_DEFAULT;
 			desc.BindFlags      = D3D11_BIND_SHADER_RESOURCE;
 			desc.CPUAccessFlags = 0;
 			desc.MiscFlags      = 0;
-			desc.MipLevels      = 1;
+			desc.MipLevels      = texture.MipLevels;
 			desc.ArraySize      = 1;
 
-			const u32 rowPitch = aiTex->mWidth * 4; // 4 bytes per pixel for RGBA
-			return resourceFactory.CreateTexture2D(desc, textureData.data(), rowPitch);
+			std::vector<D3D11_SUBRESOURCE_DATA> subresources(texture.MipLevels);
+			for (u32 level = 0; level < texture.MipLevels; level++)
+			{
+				const SubresourceLayout layout = GetSubresourceLayout(texture.Format, texture.Width, texture.Height, level);
+				subresources[level] = D3D11_SUBRESOURCE_DATA
+				{
+					.pSysMem          = texture.Data.data() + layout.Offset,
+					.SysMemPitch      = layout.RowPitch,
+					.SysMemSlicePitch = 0
+				};
+			}
+			return resourceFactory.CreateTexture2D(desc, subresources);
 		}
 	}
 
 	std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> 
-		MeshImporter::CreateTextureFromCompressedData(const ResourceFactory& resourceFactory, const std::vector<byte>& compressedData)
+		MeshImporter::CreateTextureFromCompressedData(const ResourceFactory& resourceFactory, std::span<const byte> compressedData)
 	{
+		if (TextureContainer::IsContainer(compressedData))
+		{
+			return resourceFactory.CreateTextureFromContainer(compressedData);
+		}
+
 		return resourceFactory.CreateTextureFromWIC(
 			compressedData.data(),
 			static_cast<u32>(compressedData.size())
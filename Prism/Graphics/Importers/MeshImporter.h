@@ -1,11 +1,17 @@
 #pragma once
 #include "StandardTypes.h"
 #include "Graphics/Mesh.h"
+#include "Graphics/Importers/ImportReport.h"
+#include "Graphics/Importers/MeshStreams.h"
+#include "Graphics/Utils/BlockCompressor.h"
+#include "Graphics/Utils/MipGenerator.h"
+#include <VertexTypes.h>
 #include <Elos/Common/String.h>
 #include <Elos/Common/FunctionMacros.h>
 #include <filesystem>
 #include <expected>
 #include <vector>
+#include <span>
 #include <unordered_map>
 
 namespace fs = std::filesystem;
@@ -18,10 +24,15 @@ namespace Prism::Gfx
 {
     class ResourceFactory;
     class Texture2D;
+    class TextureCache;
+    class TextureStreamer;
+    class MeshCache;
 
     class MeshImporter
     {
     public:
+        using VertexType = DirectX::VertexPositionNormalTangentColorTexture;
+
         struct ImportError
         {
             enum class Type
@@ -30,7 +41,8 @@ namespace Prism::Gfx
                 AssimpError,
                 MeshCreationFailed,
                 NoMeshesFound,
-                TextureLoadingFailed
+                TextureLoadingFailed,
+                MaterialCreationFailed
             };
 
             Type Type;
@@ -42,7 +54,112 @@ namespace Prism::Gfx
         {
             std::vector<std::shared_ptr<Mesh>> Meshes;
             std::vector<std::shared_ptr<Texture2D>> Textures;
+            std::vector<std::shared_ptr<Material>> Materials;  // Meshes point at these, see Mesh::GetMaterial
             std::unordered_map<Elos::String, u64> TextureMap;
+            ImportReport Report;
+        };
+
+        // Non owning views over uploadable data, backed either by the buffers below or by a mapped mesh cache
+        struct MeshView
+        {
+            const void* Vertices = nullptr;
+            u32 VertexCount      = 0;
+            u32 VertexStride     = 0;
+            std::span<const u32> Indices;
+            VertexFormat Format  = VertexFormat::Standard;
+            PositionDequantization Dequantization;
+            std::span<const Meshlet> Meshlets;
+            std::span<const Mesh::Lod> Lods;
+            Prism::Bounds Bounds;
+            u32 MaterialIndex    = 0;
+        };
+
+        struct TextureView
+        {
+            Elos::StringView Name;
+            u32 Width         = 0;
+            u32 Height        = 0;
+            u32 MipLevels     = 1;  // Unless IsCompressed, Data holds the whole chain, see GetSubresourceLayout
+            DXGI_FORMAT Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+            bool IsCompressed = false;  // Image file uploaded as is, DDS/KTX2 directly and anything else (png, jpg...) through WIC
+            bool NeedsCook    = false;  // Data is still the source image, cooked only when the texture cache misses it
+            u64 SourceKey     = 0;      // TextureCache key, hash of the source image and of the settings shaping its cooked form
+            u64 SourceBytes   = 0;      // Size of the source image, kept once Data holds the cooked chain
+            std::span<const byte> Data;
+        };
+
+        // CPU side geometry of a single aiMesh, ready to be uploaded
+        struct MeshBuffers
+        {
+            std::vector<VertexType> Vertices;
+            std::vector<VertexCompact> CompactVertices;  // Replaces Vertices when Format is VertexFormat::Compact
+            std::vector<u32> Indices;
+            std::vector<Meshlet> Meshlets;  // Empty unless BuildMeshlets is set
+            std::vector<Mesh::Lod> Lods;    // Empty unless GenerateLods is set, LOD n > 0 indices follow LOD 0 in Indices
+            Prism::Bounds Bounds;  // Object space box and sphere of the final vertices
+            u32 MaterialIndex = 0;
+            bool IsTriangleList = true;  // False for point, line and mixed source meshes, MergeByMaterial leaves them alone
+            VertexFormat Format = VertexFormat::Standard;
+            PositionDequantization Dequantization;
+            f32 ACMRBefore = 0.0f;  // Average cache miss ratio before/after OptimizeVertexCache, 0 if the pass did not run
+            f32 ACMRAfter  = 0.0f;
+            f32 OverdrawBefore = 0.0f;  // Estimated overdraw before/after OptimizeOverdraw, 0 if the pass did not run
+            f32 OverdrawAfter  = 0.0f;
+            f64 VertexTime     = 0.0;   // Seconds spent converting source streams into vertices
+            f64 IndexTime      = 0.0;   // Seconds spent converting source faces into indices
+
+            NODISCARD MeshView AsView() const noexcept
+            {
+                const bool isCompact = Format == VertexFormat::Compact;
+                return MeshView
+                {
+                    .Vertices       = isCompact ? static_cast<const void*>(CompactVertices.data()) : static_cast<const void*>(Vertices.data()),
+                    .VertexCount    = static_cast<u32>(isCompact ? CompactVertices.size() : Vertices.size()),
+                    .VertexStride   = GetVertexStride(Format),
+                    .Indices        = Indices,
+                    .Format         = Format,
+                    .Dequantization = Dequantization,
+                    .Meshlets       = Meshlets,
+                    .Lods           = Lods,
+                    .Bounds         = Bounds,
+                    .MaterialIndex  = MaterialIndex
+                };
+            }
+
+            NODISCARD u32 GetLodIndexCount(const u32 lod = 0) const noexcept
+            {
+                return Lods.empty() ? static_cast<u32>(Indices.size()) : Lods[lod].IndexCount;
+            }
+        };
+
+        // CPU side copy of an embedded texture, either RGBA8 texels or an encoded image (png, jpg...) for WIC
+        struct TextureBuffers
+        {
+            Elos::String Name;
+            u32 Width         = 0;
+            u32 Height        = 0;
+            u32 MipLevels     = 1;
+            DXGI_FORMAT Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+            bool IsCompressed = false;
+            u64 SourceKey     = 0;
+            u64 SourceBytes   = 0;
+            std::vector<byte> Data;
+
+            NODISCARD TextureView AsView() const noexcept
+            {
+                return TextureView
+                {
+                    .Name         = Name,
+                    .Width        = Width,
+                    .Height       = Height,
+                    .MipLevels    = MipLevels,
+                    .Format       = Format,
+                    .IsCompressed = IsCompressed,
+                    .SourceKey    = SourceKey,
+                    .SourceBytes  = SourceBytes,
+                    .Data         = Data
+                };
+            }
         };
 
         struct ImportSettings
@@ -57,6 +174,30 @@ namespace Prism::Gfx
             bool OptimizeMeshes          = true;
             bool Validate                = true;
             bool ExtractEmbeddedTextures = true;
+            bool ParallelConversion      = true;  // Convert meshes on the worker pool before uploading them in order
+            bool UseMeshCache            = false; // Load from / write to a cooked .pmesh next to the source file, hashes the whole source on every import
+            bool OptimizeVertexCache     = true;  // Reorder triangles for post-transform vertex cache reuse
+            bool OptimizeOverdraw        = false; // Sort triangle clusters to reduce overdraw, needs OptimizeVertexCache
+            f32 OverdrawThreshold        = 1.05f; // Max ACMR growth traded for overdraw (1.0 keeps cache order)
+            bool OptimizeVertexFetch     = true;  // Store vertices in first-use order and drop unreferenced ones
+            bool BuildMeshlets           = false; // Split meshes into meshlets with culling bounds for Model::Render(renderer, camera)
+            u32 MaxMeshletVertices       = 64;
+            u32 MaxMeshletTriangles      = 124;
+            bool GenerateLods            = false; // Append simplified index ranges, selected per mesh by Model::Render(renderer, camera)
+            u32 MaxLodCount              = 4;     // Including LOD 0
+            f32 LodReductionRatio        = 0.5f;  // Target index count of each LOD relative to the previous one
+            f32 LodMaxError              = 0.05f; // Max simplification error per step, relative to the mesh radius
+            VertexFormat VertexFormat    = VertexFormat::Standard;  // Compact needs the SimpleModelCompact vertex shader
+            bool UseNativeLoaders        = true;  // Read .gltf/.glb/.obj directly, files the native loaders reject still go through Assimp
+            bool UseMappedIO             = true;  // Serve Assimp file reads from memory mappings instead of buffered streams
+            bool PackMeshes              = false; // Share vertex/index buffers between meshes and merge single use meshes by material
+            bool BakeNodeTransforms      = false; // Flatten static scenes into world space vertices, identical (mesh, transform) pairs still share one mesh
+            bool GenerateMips            = true;  // Decode textures and build their full mip chain on the CPU, cooked into the mesh cache
+            MipFilter MipFilter          = MipFilter::Box;
+            bool SrgbTextures            = true;  // Filter color texture mips in linear space, normal maps are always linear
+            TextureCompression TextureCompression = TextureCompression::Standard;  // Block compress textures with 4 texel aligned sizes
+            TextureCache* TextureCache   = nullptr; // Reuse textures with identical data already created through this cache, usually the resource factory one
+            TextureStreamer* Streamer    = nullptr; // Upload only the tail mips of cooked textures, the rest streams in through this streamer
         };
 
     public:
@@ -65,18 +206,100 @@ namespace Prism::Gfx
             const fs::path& filePath,
             const ImportSettings& settings = {});
 
+        // Converts the vertices and indices of every mesh. Output order matches the input order
+        // When given, transforms hold one matrix per mesh that is baked into its vertices
+        static NODISCARD std::vector<MeshBuffers> ConvertMeshes(
+            std::span<const aiMesh* const> meshes,
+            const ImportSettings& settings = {},
+            std::span<const Matrix> transforms = {});
 
     private:
-        static std::expected<void, ImportError> ProcessNode(const ResourceFactory& resourceFactory, MeshData& meshData, aiNode* node, const aiScene* scene);
-        static std::expected<void, ImportError> ProcessMesh(const ResourceFactory& resourceFactory, MeshData& meshData, aiMesh* mesh, const aiScene* scene);
-        static std::expected<void, ImportError> LoadTextures(const ResourceFactory& resourceFactory, MeshData& meshData, const aiScene* scene);
+        static constexpr u64 MaxPackBytes = 256ull << 20;  // Vertex plus index bytes of one shared buffer pair
+
+        static std::expected<MeshData, ImportError> ImportFromCache(
+            const ResourceFactory& resourceFactory,
+            const MeshCache& cache,
+            const ImportSettings& settings,
+            ImportReport& report);
+        static std::expected<void, ImportError> ConvertWithAssimp(
+            const fs::path& filePath,
+            const ImportSettings& settings,
+            std::vector<MeshBuffers>& outMeshes,
+            std::vector<u32>& outMeshInstances,
+            std::vector<TextureBuffers>& outTextures,
+            std::vector<MaterialSource>& outMaterials,
+            std::vector<fs::path>& outSidecars,
+            ImportReport& report);
+        static std::expected<MeshData, ImportError> UploadMeshData(
+            const ResourceFactory& resourceFactory,
+            const fs::path& filePath,
+            std::span<const MeshBuffers> meshes,
+            std::span<const u32> meshInstances,
+            std::span<const TextureView> textures,
+            std::span<const std::shared_ptr<Texture2D>> sharedTextures,
+            std::span<const MaterialSource> materials,
+            const ImportSettings& settings,
+            ImportReport& report);
+        static std::vector<MeshBuffers> ConvertStreams(
+            std::span<const MeshStreams> meshes,
+            const bool flipV,
+            const ImportSettings& settings,
+            std::span<const Matrix> transforms = {});
+        static void LogConversionStats(std::span<const MeshBuffers> meshes, const ImportSettings& settings);
+        static void ProcessNode(
+            const aiNode* node,
+            const Matrix& parentTransform,
+            std::vector<u32>& outMeshReferences,
+            std::vector<Matrix>& outTransforms);
+        static void ExpandInstances(MeshData& meshData, std::span<const u32> meshInstances);
+        static void MergeByMaterial(std::vector<MeshBuffers>& meshes, std::vector<u32>& meshInstances, const bool parallel);
+        static MeshBuffers MergeBuffers(std::span<const MeshBuffers> meshes, std::span<const u32> sources);
+        static MeshBuffers ProcessMesh(const aiMesh* mesh, const ImportSettings& settings, const Matrix& transform);
+        static MeshBuffers ProcessStreams(const MeshStreams& mesh, const bool flipV, const ImportSettings& settings, const Matrix& transform);
+        static void BakeTransform(MeshBuffers& buffers, const Matrix& transform, const bool isTriangleList, const ImportSettings& settings);
+        static void ComputeNormals(MeshBuffers& buffers);
+        static void ComputeTangents(MeshBuffers& buffers);
+        static void PostProcessMesh(
+            MeshBuffers& buffers,
+            const bool isTriangleList,
+            const bool hasNormals,
+            const bool hasTexCoords,
+            const ImportSettings& settings);
+        static void GenerateLods(MeshBuffers& buffers, const bool hasNormals, const bool hasTexCoords, const ImportSettings& settings);
+        static std::expected<void, ImportError> UploadMesh(const ResourceFactory& resourceFactory, MeshData& meshData, const MeshView& mesh);
+        static std::expected<void, ImportError> UploadMeshes(const ResourceFactory& resourceFactory, MeshData& meshData, std::span<const MeshView> meshes, const bool pack);
+        static std::vector<TextureBuffers> LoadTextures(const aiScene* scene);
+        static void PrepareTextureSources(std::span<TextureView> textures, std::span<const MaterialSource> materials, const ImportSettings& settings);
+        static std::vector<std::shared_ptr<Texture2D>> ResolveTextures(
+            std::vector<TextureView>& textures,
+            std::span<const MaterialSource> materials,
+            const ImportSettings& settings,
+            std::vector<TextureBuffers>& outCooked,
+            ImportReport& report);
+        static std::vector<TextureBuffers> CookTextures(
+            std::span<const TextureView> textures,
+            const std::vector<bool>& isNormalMap,
+            const ImportSettings& settings,
+            ImportReport& report);
+        static void CompressTexture(TextureBuffers& texture, const bool isNormalMap, const ImportSettings& settings);
+        static std::vector<MaterialSource> LoadMaterials(const aiScene* scene);
+        static std::expected<void, ImportError> UploadMaterials(
+            const ResourceFactory& resourceFactory,
+            MeshData& meshData,
+            std::span<const MaterialSource> materials,
+            std::span<const MeshView> meshes);
+        static std::expected<void, ImportError> UploadTexture(
+            const ResourceFactory& resourceFactory,
+            MeshData& meshData,
+            const TextureView& texture,
+            std::shared_ptr<Texture2D> sharedTexture,
+            const ImportSettings& settings);
         static std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> CreateTextureFromData(
             const ResourceFactory& resourceFactory,
-            const std::vector<byte>& textureData,
-            const aiTexture* aiTex);
+            const TextureView& texture);
         static std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> CreateTextureFromCompressedData(
             const ResourceFactory& resourceFactory,
-            const std::vector<byte>& compressedData);
+            std::span<const byte> compressedData);
         static u32 GetAssimpImportFlags(const ImportSettings& settings);
     };
 }
\ No newline at end of file
@@ -0,0 +1,572 @@
+#include "Graphics/Importers/MeshOptimizer.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		// Ref: https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+		constexpr u32 ForsythCacheSize    = 32;
+		constexpr f32 CacheDecayPower     = 1.5f;
+		constexpr f32 LastTriScore        = 0.75f;
+		constexpr f32 ValenceBoostScale   = 2.0f;
+		constexpr f32 ValenceBoostPower   = 0.5f;
+
+		struct Float3
+		{
+			f32 X, Y, Z;
+		};
+
+		inline Float3 LoadPosition(const void* vertices, const u32 vertexStride, const u32 index)
+		{
+			Float3 position;
+			std::memcpy(&position, static_cast<const byte*>(vertices) + size_t{ index } * vertexStride, sizeof(Float3));
+			return position;
+		}
+
+		// FIFO cache simulation used to place cluster boundaries, mirrors ComputeACMR
+		class CacheSimulator
+		{
+		public:
+			CacheSimulator(const u32 vertexCount, const u32 cacheSize)
+				: m_insertedAt(vertexCount, 0)
+				, m_cacheSize(cacheSize)
+			{
+			}
+
+			void Reset()
+			{
+				m_time += m_cacheSize;  // Everything inserted so far is now older than the cache
+			}
+
+			u32 Access(const u32 index)
+			{
+				if (m_insertedAt[index] == 0 || m_time - m_insertedAt[index] >= m_cacheSize)
+				{
+					m_insertedAt[index] = ++m_time;
+					return 1;
+				}
+				return 0;
+			}
+
+		private:
+			std::vector<u64> m_insertedAt;
+			u64              m_time = 0;
+			u32              m_cacheSize;
+		};
+
+		f32 ComputeVertexScore(const i32 cachePosition, const u32 remainingTriangles)
+		{
+			if (remainingTriangles == 0)
+			{
+				return -1.0f;  // No triangles left to emit, the vertex no longer matters
+			}
+
+			f32 score = 0.0f;
+			if (cachePosition >= 0)
+			{
+				if (cachePosition < 3)
+				{
+					// Used by the last triangle, fixed score to avoid favouring strips over fans
+					score = LastTriScore;
+				}
+				else
+				{
+					const f32 scaler = 1.0f / static_cast<f32>(ForsythCacheSize - 3);
+					score = std::pow(1.0f - static_cast<f32>(cachePosition - 3) * scaler, CacheDecayPower);
+				}
+			}
+
+			// Boost vertices with few triangles left so lone triangles do not get stranded
+			score += ValenceBoostScale * std::pow(static_cast<f32>(remainingTriangles), -ValenceBoostPower);
+			return score;
+		}
+	}
+
+	f32 MeshOptimizer::ComputeACMR(std::span<const u32> indices, const u32 vertexCount, const u32 cacheSize)
+	{
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0 || cacheSize == 0)
+		{
+			return 0.0f;
+		}
+
+		// Simulate a FIFO cache by remembering when each vertex was last pushed
+		std::vector<u64> insertedAt(vertexCount, 0);
+		u64 misses = 0;
+
+		for (const u32 index : indices)
+		{
+			if (index >= vertexCount)
+			{
+				continue;
+			}
+
+			if (insertedAt[index] == 0 || misses - insertedAt[index] >= cacheSize)
+			{
+				misses++;
+				insertedAt[index] = misses;
+			}
+		}
+
+		return static_cast<f32>(misses) / static_cast<f32>(triangleCount);
+	}
+
+	void MeshOptimizer::OptimizeVertexCache(std::span<u32> indices, const u32 vertexCount)
+	{
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount < 2 || vertexCount == 0)
+		{
+			return;
+		}
+
+		// Vertex -> triangle adjacency (CSR), remaining counts shrink as triangles get emitted
+		std::vector<u32> remaining(vertexCount, 0);
+		for (const u32 index : indices)
+		{
+			remaining[index]++;
+		}
+
+		std::vector<u32> adjacencyOffsets(vertexCount + 1, 0);
+		for (u32 v = 0; v < vertexCount; v++)
+		{
+			adjacencyOffsets[v + 1] = adjacencyOffsets[v] + remaining[v];
+		}
+
+		std::vector<u32> adjacency(indices.size());
+		{
+			std::vector<u32> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for (size_t i = 0; i < indices.size(); i++)
+			{
+				adjacency[cursor[indices[i]]++] = static_cast<u32>(i / 3);
+			}
+		}
+
+		std::vector<i32> cachePosition(vertexCount, -1);
+		std::vector<f32> vertexScore(vertexCount);
+		for (u32 v = 0; v < vertexCount; v++)
+		{
+			vertexScore[v] = ComputeVertexScore(-1, remaining[v]);
+		}
+
+		std::vector<f32> triangleScore(triangleCount);
+		std::vector<bool> emitted(triangleCount, false);
+
+		i64 bestTriangle = -1;
+		f32 bestScore    = -1.0f;
+		for (size_t t = 0; t < triangleCount; t++)
+		{
+			triangleScore[t] = vertexScore[indices[t * 3 + 0]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+			if (triangleScore[t] > bestScore)
+			{
+				bestScore    = triangleScore[t];
+				bestTriangle = static_cast<i64>(t);
+			}
+		}
+
+		std::vector<u32> output;
+		output.reserve(indices.size());
+
+		std::array<u32, ForsythCacheSize + 3> cache{};
+		std::array<u32, ForsythCacheSize + 3> newCache{};
+		u32 cacheCount = 0;
+		size_t scanCursor = 0;
+
+		while (output.size() < triangleCount * 3)
+		{
+			if (bestTriangle < 0)
+			{
+				// Nothing in the cache has triangles left, restart from the first unemitted triangle
+				while (emitted[scanCursor])
+				{
+					scanCursor++;
+				}
+				bestTriangle = static_cast<i64>(scanCursor);
+			}
+
+			const size_t triangle = static_cast<size_t>(bestTriangle);
+			const u32 corners[3] = { indices[triangle * 3 + 0], indices[triangle * 3 + 1], indices[triangle * 3 + 2] };
+			emitted[triangle] = true;
+
+			for (const u32 v : corners)
+			{
+				output.push_back(v);
+
+				// Remove the triangle from the vertex's live adjacency list
+				u32* begin = adjacency.data() + adjacencyOffsets[v];
+				u32* end   = begin + remaining[v];
+				u32* it    = std::find(begin, end, static_cast<u32>(triangle));
+				if (it != end)
+				{
+					std::swap(*it, *(end - 1));
+					remaining[v]--;
+				}
+			}
+
+			// New cache: the emitted triangle's vertices first, then the previous entries in LRU order
+			u32 newCount = 0;
+			for (const u32 v : corners)
+			{
+				if (std::find(newCache.begin(), newCache.begin() + newCount, v) == newCache.begin() + newCount)
+				{
+					newCache[newCount++] = v;
+				}
+			}
+
+			for (u32 i = 0; i < cacheCount; i++)
+			{
+				const u32 v = cache[i];
+				if (std::find(newCache.begin(), newCache.begin() + newCount, v) != newCache.begin() + newCount)
+				{
+					continue;
+				}
+
+				if (newCount < newCache.size())
+				{
+					newCache[newCount++] = v;
+				}
+				else
+				{
+					cachePosition[v] = -1;  // Pushed out of the cache
+					vertexScore[v]   = ComputeVertexScore(-1, remaining[v]);
+				}
+			}
+
+			for (u32 i = 0; i < newCount; i++)
+			{
+				const u32 v      = newCache[i];
+				cachePosition[v] = i < ForsythCacheSize ? static_cast<i32>(i) : -1;
+				vertexScore[v]   = ComputeVertexScore(cachePosition[v], remaining[v]);
+			}
+
+			std::swap(cache, newCache);
+			cacheCount = newCount;
+
+			// Only triangles touching the cache changed score, pick the next one among them
+			bestTriangle = -1;
+			bestScore    = -1.0f;
+			for (u32 i = 0; i < cacheCount; i++)
+			{
+				const u32 v = cache[i];
+				for (u32 a = 0; a < remaining[v]; a++)
+				{
+					const u32 t = adjacency[adjacencyOffsets[v] + a];
+					triangleScore[t] = vertexScore[indices[t * 3 + 0]] + vertexScore[indices[t * 3 + 1]] + vertexScore[indices[t * 3 + 2]];
+					if (triangleScore[t] > bestScore)
+					{
+						bestScore    = triangleScore[t];
+						bestTriangle = static_cast<i64>(t);
+					}
+				}
+			}
+		}
+
+		std::ranges::copy(output, indices.begin());
+	}
+
+	void MeshOptimizer::OptimizeOverdraw(
+		std::span<u32> indices, const void* vertices, const u32 vertexCount, const u32 vertexStride, const f32 frontFaceSign, const f32 threshold)
+	{
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount < 2 || vertexCount == 0 || !vertices)
+		{
+			return;
+		}
+
+		// Hard boundaries: triangles where the cache is completely cold (all three vertices miss)
+		std::vector<size_t> hardBoundaries;
+		{
+			CacheSimulator cache(vertexCount, DefaultCacheSize);
+			for (size_t t = 0; t < triangleCount; t++)
+			{
+				const u32 misses = cache.Access(indices[t * 3 + 0]) + cache.Access(indices[t * 3 + 1]) + cache.Access(indices[t * 3 + 2]);
+				if (t == 0 || misses == 3)
+				{
+					hardBoundaries.push_back(t);
+				}
+			}
+			hardBoundaries.push_back(triangleCount);
+		}
+
+		// Soft boundaries: split hard clusters further while the split cluster's ACMR stays within the threshold
+		std::vector<size_t> clusters;
+		{
+			CacheSimulator cache(vertexCount, DefaultCacheSize);
+			for (size_t c = 0; c + 1 < hardBoundaries.size(); c++)
+			{
+				const size_t start = hardBoundaries[c];
+				const size_t end   = hardBoundaries[c + 1];
+
+				cache.Reset();
+				u32 clusterMisses = 0;
+				for (size_t t = start; t < end; t++)
+				{
+					clusterMisses += cache.Access(indices[t * 3 + 0]) + cache.Access(indices[t * 3 + 1]) + cache.Access(indices[t * 3 + 2]);
+				}
+				const f32 clusterThreshold = threshold * static_cast<f32>(clusterMisses) / static_cast<f32>(end - start);
+
+				cache.Reset();
+				size_t softStart = start;
+				u32 softMisses   = 0;
+				clusters.push_back(start);
+
+				for (size_t t = start; t < end; t++)
+				{
+					softMisses += cache.Access(indices[t * 3 + 0]) + cache.Access(indices[t * 3 + 1]) + cache.Access(indices[t * 3 + 2]);
+
+					const f32 softACMR = static_cast<f32>(softMisses) / static_cast<f32>(t - softStart + 1);
+					if (t + 1 < end && softACMR <= clusterThreshold)
+					{
+						clusters.push_back(t + 1);
+						softStart  = t + 1;
+						softMisses = 0;
+						cache.Reset();
+					}
+				}
+			}
+			clusters.push_back(triangleCount);
+		}
+
+		const size_t clusterCount = clusters.size() - 1;
+		if (clusterCount < 2)
+		{
+			return;
+		}
+
+		// Area weighted centroid and normal for every cluster
+		std::vector<Float3> clusterCentroids(clusterCount);
+		std::vector<Float3> clusterNormals(clusterCount);
+		Float3 meshCentroid{ 0.0f, 0.0f, 0.0f };
+		f32 meshArea = 0.0f;
+
+		for (size_t c = 0; c < clusterCount; c++)
+		{
+			Float3 centroid{ 0.0f, 0.0f, 0.0f };
+			Float3 normal{ 0.0f, 0.0f, 0.0f };
+			f32 clusterArea = 0.0f;
+
+			for (size_t t = clusters[c]; t < clusters[c + 1]; t++)
+			{
+				const Float3 p0 = LoadPosition(vertices, vertexStride, indices[t * 3 + 0]);
+				const Float3 p1 = LoadPosition(vertices, vertexStride, indices[t * 3 + 1]);
+				const Float3 p2 = LoadPosition(vertices, vertexStride, indices[t * 3 + 2]);
+
+				const Float3 e1{ p1.X - p0.X, p1.Y - p0.Y, p1.Z - p0.Z };
+				const Float3 e2{ p2.X - p0.X, p2.Y - p0.Y, p2.Z - p0.Z };
+				const Float3 n{ e1.Y * e2.Z - e1.Z * e2.Y, e1.Z * e2.X - e1.X * e2.Z, e1.X * e2.Y - e1.Y * e2.X };
+				const f32 area = std::sqrt(n.X * n.X + n.Y * n.Y + n.Z * n.Z);
+
+				centroid.X += (p0.X + p1.X + p2.X) * (area / 3.0f);
+				centroid.Y += (p0.Y + p1.Y + p2.Y) * (area / 3.0f);
+				centroid.Z += (p0.Z + p1.Z + p2.Z) * (area / 3.0f);
+				normal.X   += n.X;
+				normal.Y   += n.Y;
+				normal.Z   += n.Z;
+				clusterArea += area;
+			}
+
+			meshCentroid.X += centroid.X;
+			meshCentroid.Y += centroid.Y;
+			meshCentroid.Z += centroid.Z;
+			meshArea       += clusterArea;
+
+			const f32 invArea = clusterArea > 0.0f ? 1.0f / clusterArea : 0.0f;
+			clusterCentroids[c] = { centroid.X * invArea, centroid.Y * invArea, centroid.Z * invArea };
+
+			const f32 normalLength = std::sqrt(normal.X * normal.X + normal.Y * normal.Y + normal.Z * normal.Z);
+			const f32 invNormal    = normalLength > 0.0f ? 1.0f / normalLength : 0.0f;
+			clusterNormals[c] = { normal.X * invNormal, normal.Y * invNormal, normal.Z * invNormal };
+		}
+
+		if (meshArea > 0.0f)
+		{
+			meshCentroid = { meshCentroid.X / meshArea, meshCentroid.Y / meshArea, meshCentroid.Z / meshArea };
+		}
+
+		// Clusters facing away from the mesh center are likely to occlude the rest, draw them first. The summed cross
+		// products point along the visible side only when front faces are wound toward the viewer
+		std::vector<f32> sortKeys(clusterCount);
+		for (size_t c = 0; c < clusterCount; c++)
+		{
+			const Float3& centroid = clusterCentroids[c];
+			const Float3& normal   = clusterNormals[c];
+			sortKeys[c] = frontFaceSign * ((centroid.X - meshCentroid.X) * normal.X
+				+ (centroid.Y - meshCentroid.Y) * normal.Y
+				+ (centroid.Z - meshCentroid.Z) * normal.Z);
+		}
+
+		std::vector<size_t> order(clusterCount);
+		std::iota(order.begin(), order.end(), size_t{ 0 });
+		std::ranges::stable_sort(order, [&sortKeys](const size_t a, const size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+		std::vector<u32> output;
+		output.reserve(indices.size());
+		for (const size_t c : order)
+		{
+			output.insert(output.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+		}
+
+		std::ranges::copy(output, indices.begin());
+	}
+
+	MeshOptimizer::OverdrawStats MeshOptimizer::EstimateOverdraw(
+		std::span<const u32> indices, const void* vertices, const u32 vertexCount, const u32 vertexStride, const f32 frontFaceSign)
+	{
+		OverdrawStats stats;
+		const size_t triangleCount = indices.size() / 3;
+		if (triangleCount == 0 || vertexCount == 0 || !vertices)
+		{
+			return stats;
+		}
+
+		// Normalize the mesh into the unit cube so every view uses the full grid
+		Float3 minBounds = LoadPosition(vertices, vertexStride, 0);
+		Float3 maxBounds = minBounds;
+		for (u32 v = 1; v < vertexCount; v++)
+		{
+			const Float3 p = LoadPosition(vertices, vertexStride, v);
+			minBounds = { std::min(minBounds.X, p.X), std::min(minBounds.Y, p.Y), std::min(minBounds.Z, p.Z) };
+			maxBounds = { std::max(maxBounds.X, p.X), std::max(maxBounds.Y, p.Y), std::max(maxBounds.Z, p.Z) };
+		}
+
+		const f32 extent = std::max({ maxBounds.X - minBounds.X, maxBounds.Y - minBounds.Y, maxBounds.Z - minBounds.Z });
+		const f32 scale  = extent > 0.0f ? 1.0f / extent : 0.0f;
+
+		std::vector<Float3> normalized(vertexCount);
+		for (u32 v = 0; v < vertexCount; v++)
+		{
+			const Float3 p = LoadPosition(vertices, vertexStride, v);
+			normalized[v] = { (p.X - minBounds.X) * scale, (p.Y - minBounds.Y) * scale, (p.Z - minBounds.Z) * scale };
+		}
+
+		constexpr u32 grid = OverdrawGridSize;
+		std::vector<f32> depth(grid * grid);
+		std::vector<u8> touched(grid * grid);
+
+		// Three axes, each viewed from both sides. Swapping the screen axes flips the winding for the opposite side
+		for (u32 axis = 0; axis < 3; axis++)
+		{
+			for (u32 side = 0; side < 2; side++)
+			{
+				std::ranges::fill(depth, 1.0f);
+				std::ranges::fill(touched, u8{ 0 });
+
+				const auto Project = [axis, side](const Float3& p) -> Float3
+				{
+					const f32 coords[3] = { p.X, p.Y, p.Z };
+					f32 u = coords[(axis + 1) % 3];
+					f32 v = coords[(axis + 2) % 3];
+					f32 z = coords[axis];
+					if (side == 1)
+					{
+						std::swap(u, v);
+						z = 1.0f - z;
+					}
+					return { u * grid, v * grid, z };
+				};
+
+				for (size_t t = 0; t < triangleCount; t++)
+				{
+					// Every view looks down its axis, so a positive area means the cross product points away from it.
+					// Front faces wound toward the viewer are reversed to rasterize with a positive area as well
+					const Float3 a = Project(normalized[indices[t * 3 + 0]]);
+					Float3 b = Project(normalized[indices[t * 3 + 1]]);
+					Float3 c = Project(normalized[indices[t * 3 + 2]]);
+					if (frontFaceSign > 0.0f)
+					{
+						std::swap(b, c);
+					}
+
+					const f32 area = (b.X - a.X) * (c.Y - a.Y) - (b.Y - a.Y) * (c.X - a.X);
+					if (area <= 0.0f)
+					{
+						continue;  // Back facing or degenerate
+					}
+
+					const i32 minX = std::max(0, static_cast<i32>(std::floor(std::min({ a.X, b.X, c.X }))));
+					const i32 minY = std::max(0, static_cast<i32>(std::floor(std::min({ a.Y, b.Y, c.Y }))));
+					const i32 maxX = std::min(static_cast<i32>(grid) - 1, static_cast<i32>(std::ceil(std::max({ a.X, b.X, c.X }))));
+					const i32 maxY = std::min(static_cast<i32>(grid) - 1, static_cast<i32>(std::ceil(std::max({ a.Y, b.Y, c.Y }))));
+					const f32 invArea = 1.0f / area;
+
+					for (i32 y = minY; y <= maxY; y++)
+					{
+						for (i32 x = minX; x <= maxX; x++)
+						{
+							// Sample at pixel centers with edge functions
+							const f32 px = static_cast<f32>(x) + 0.5f;
+							const f32 py = static_cast<f32>(y) + 0.5f;
+							const f32 w0 = (c.X - b.X) * (py - b.Y) - (c.Y - b.Y) * (px - b.X);
+							const f32 w1 = (a.X - c.X) * (py - c.Y) - (a.Y - c.Y) * (px - c.X);
+							const f32 w2 = (b.X - a.X) * (py - a.Y) - (b.Y - a.Y) * (px - a.X);
+							if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f)
+							{
+								continue;
+							}
+
+							const f32 z = (w0 * a.Z + w1 * b.Z + w2 * c.Z) * invArea;
+							const size_t pixel = static_cast<size_t>(y) * grid + static_cast<size_t>(x);
+							if (z <= depth[pixel])
+							{
+								depth[pixel] = z;
+								stats.PixelsShaded++;
+								if (!touched[pixel])
+								{
+									touched[pixel] = 1;
+									stats.PixelsCovered++;
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
+		stats.Overdraw = stats.PixelsCovered > 0
+			? static_cast<f32>(stats.PixelsShaded) / static_cast<f32>(stats.PixelsCovered)
+			: 0.0f;
+
+		return stats;
+	}
+
+	u32 MeshOptimizer::OptimizeVertexFetch(std::span<u32> indices, void* vertices, const u32 vertexCount, const u32 vertexStride)
+	{
+		if (vertexCount == 0 || vertexStride == 0 || !vertices)
+		{
+			return vertexCount;
+		}
+
+		constexpr u32 unused = ~0u;
+		std::vector<u32> remap(vertexCount, unused);
+		u32 nextVertex = 0;
+
+		for (u32& index : indices)
+		{
+			u32& target = remap[index];
+			if (target == unused)
+			{
+				target = nextVertex++;
+			}
+			index = target;
+		}
+
+		std::vector<byte> reordered(size_t{ nextVertex } * vertexStride);
+		const byte* source = static_cast<const byte*>(vertices);
+
+		for (u32 v = 0; v < vertexCount; v++)
+		{
+			if (remap[v] != unused)
+			{
+				std::memcpy(reordered.data() + size_t{ remap[v] } * vertexStride, source + size_t{ v } * vertexStride, vertexStride);
+			}
+		}
+
+		std::memcpy(vertices, reordered.data(), reordered.size());
+		return nextVertex;
+	}
+}
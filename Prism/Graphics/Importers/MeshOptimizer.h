@@ -0,0 +1,59 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <span>
+
+namespace Prism::Gfx
+{
+	// CPU side passes that reorder triangle list geometry for faster rendering
+	class MeshOptimizer
+	{
+	public:
+		static constexpr u32 DefaultCacheSize         = 16;     // FIFO size used to estimate post-transform cache hits
+		static constexpr f32 DefaultOverdrawThreshold = 1.05f;  // Allow 5% ACMR loss in exchange for less overdraw
+		static constexpr u32 OverdrawGridSize         = 256;    // Resolution of each view rendered by EstimateOverdraw
+
+		struct OverdrawStats
+		{
+			u64 PixelsCovered = 0;  // Pixels touched by at least one triangle
+			u64 PixelsShaded  = 0;  // Pixels that passed the depth test, counting every overwrite
+			f32 Overdraw      = 0.0f;  // Shaded / Covered, 1.0 means no overdraw
+		};
+
+	public:
+		// Average cache miss ratio: transformed vertices per triangle for a FIFO cache of the given size
+		static NODISCARD f32 ComputeACMR(std::span<const u32> indices, const u32 vertexCount, const u32 cacheSize = DefaultCacheSize);
+
+		// Reorders triangles for post-transform vertex cache reuse (Forsyth's linear speed optimizer)
+		static void OptimizeVertexCache(std::span<u32> indices, const u32 vertexCount);
+
+		// Splits cache optimized triangles into clusters and sorts them front-to-back with a view independent heuristic
+		// Clusters are split as long as their ACMR stays within threshold * the ACMR of the cache optimized order
+		// Positions are float3 at the start of each vertex, vertexStride bytes apart. frontFaceSign is 1 when front faces
+		// have cross(p1 - p0, p2 - p0) pointing toward the viewer and -1 when it points away, like MeshletCullContext
+		static void OptimizeOverdraw(
+			std::span<u32> indices,
+			const void* vertices,
+			const u32 vertexCount,
+			const u32 vertexStride,
+			const f32 frontFaceSign,
+			const f32 threshold = DefaultOverdrawThreshold);
+
+		// Remaps vertices into first-use order of the index buffer and drops unreferenced ones
+		// Works on raw vertices of any stride, rewrites indices and vertices in place and returns the new vertex count
+		static NODISCARD u32 OptimizeVertexFetch(
+			std::span<u32> indices,
+			void* vertices,
+			const u32 vertexCount,
+			const u32 vertexStride);
+
+		// Software rasterizes the mesh from the six axis directions with back face culling and a depth test
+		// Use the same frontFaceSign as OptimizeOverdraw, otherwise the back faces are the ones being measured
+		static NODISCARD OverdrawStats EstimateOverdraw(
+			std::span<const u32> indices,
+			const void* vertices,
+			const u32 vertexCount,
+			const u32 vertexStride,
+			const f32 frontFaceSign);
+	};
+}
@@ -0,0 +1,395 @@
+#include "Graphics/Importers/MeshSimplifier.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <unordered_map>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		struct Float3
+		{
+			f32 X, Y, Z;
+		};
+
+		inline Float3 LoadFloat3(const void* vertices, const u32 vertexStride, const u32 index, const u32 offset = 0)
+		{
+			Float3 value;
+			std::memcpy(&value, static_cast<const byte*>(vertices) + size_t{ index } * vertexStride + offset, sizeof(Float3));
+			return value;
+		}
+
+		inline Float3 Subtract(const Float3& a, const Float3& b) { return { a.X - b.X, a.Y - b.Y, a.Z - b.Z }; }
+		inline f32 Dot(const Float3& a, const Float3& b) { return a.X * b.X + a.Y * b.Y + a.Z * b.Z; }
+		inline Float3 Cross(const Float3& a, const Float3& b)
+		{
+			return { a.Y * b.Z - a.Z * b.Y, a.Z * b.X - a.X * b.Z, a.X * b.Y - a.Y * b.X };
+		}
+
+		// Symmetric 4x4 plane quadric, error(p) = p'Ap + 2b'p + c. Doubles since errors are tiny differences of large sums
+		struct Quadric
+		{
+			f64 A00 = 0.0, A11 = 0.0, A22 = 0.0, A01 = 0.0, A02 = 0.0, A12 = 0.0;
+			f64 B0 = 0.0, B1 = 0.0, B2 = 0.0;
+			f64 C = 0.0;
+			f64 Weight = 0.0;
+
+			void AddPlane(const f64 nx, const f64 ny, const f64 nz, const f64 d, const f64 weight)
+			{
+				A00 += weight * nx * nx; A11 += weight * ny * ny; A22 += weight * nz * nz;
+				A01 += weight * nx * ny; A02 += weight * nx * nz; A12 += weight * ny * nz;
+				B0  += weight * nx * d;  B1  += weight * ny * d;  B2  += weight * nz * d;
+				C   += weight * d * d;
+				Weight += weight;
+			}
+
+			Quadric& operator+=(const Quadric& other)
+			{
+				A00 += other.A00; A11 += other.A11; A22 += other.A22;
+				A01 += other.A01; A02 += other.A02; A12 += other.A12;
+				B0  += other.B0;  B1  += other.B1;  B2  += other.B2;
+				C   += other.C;
+				Weight += other.Weight;
+				return *this;
+			}
+
+			f64 Evaluate(const Float3& p) const
+			{
+				const f64 x = p.X, y = p.Y, z = p.Z;
+				const f64 error = A00 * x * x + A11 * y * y + A22 * z * z
+					+ 2.0 * (A01 * x * y + A02 * x * z + A12 * y * z)
+					+ 2.0 * (B0 * x + B1 * y + B2 * z)
+					+ C;
+				return std::max(error, 0.0);  // Rounding can push it slightly negative
+			}
+		};
+
+		struct Collapse
+		{
+			u32 From;
+			u32 To;
+			f64 Cost;  // Mean squared distance to the planes of the removed area, plus attribute deviation
+		};
+
+		struct PositionKey
+		{
+			u32 X, Y, Z;
+			bool operator==(const PositionKey&) const = default;
+		};
+
+		struct PositionKeyHash
+		{
+			size_t operator()(const PositionKey& key) const noexcept
+			{
+				return (size_t{ key.X } * 73856093u) ^ (size_t{ key.Y } * 19349663u) ^ (size_t{ key.Z } * 83492791u);
+			}
+		};
+
+		inline u64 EdgeKey(const u32 a, const u32 b) { return (u64{ a } << 32) | b; }
+	}
+
+	MeshSimplifier::SimplifyResult MeshSimplifier::Simplify(
+		std::span<const u32> indices,
+		const void* vertices,
+		const u32 vertexCount,
+		const u32 vertexStride,
+		const u32 targetIndexCount,
+		const f32 targetError,
+		const SimplifyOptions& options)
+	{
+		SimplifyResult result;
+		result.Indices.assign(indices.begin(), indices.end() - indices.size() % 3);
+
+		if (result.Indices.empty() || !vertices || vertexCount == 0 || targetIndexCount >= result.Indices.size())
+		{
+			return result;
+		}
+
+		std::vector<Float3> positions(vertexCount);
+		Float3 boundsMin = LoadFloat3(vertices, vertexStride, 0);
+		Float3 boundsMax = boundsMin;
+		for (u32 v = 0; v < vertexCount; v++)
+		{
+			positions[v] = LoadFloat3(vertices, vertexStride, v);
+			boundsMin = { std::min(boundsMin.X, positions[v].X), std::min(boundsMin.Y, positions[v].Y), std::min(boundsMin.Z, positions[v].Z) };
+			boundsMax = { std::max(boundsMax.X, positions[v].X), std::max(boundsMax.Y, positions[v].Y), std::max(boundsMax.Z, positions[v].Z) };
+		}
+
+		const Float3 extent = Subtract(boundsMax, boundsMin);
+		const f64 radiusSquared = 0.25 * Dot(extent, extent);  // Makes attribute costs comparable to squared distances
+
+		// Vertices split on UV/normal seams share a position, collapse decisions are made per position
+		std::vector<u32> positionId(vertexCount);
+		std::vector<u32> wedgeCount(vertexCount, 0);
+		{
+			std::unordered_map<PositionKey, u32, PositionKeyHash> firstVertex;
+			firstVertex.reserve(vertexCount);
+			for (u32 v = 0; v < vertexCount; v++)
+			{
+				const PositionKey key{ std::bit_cast<u32>(positions[v].X), std::bit_cast<u32>(positions[v].Y), std::bit_cast<u32>(positions[v].Z) };
+				positionId[v] = firstVertex.try_emplace(key, v).first->second;
+				wedgeCount[positionId[v]]++;
+			}
+		}
+
+		std::vector<u8> locked(vertexCount, 0);
+		if (options.LockBorders)
+		{
+			std::vector<u8> lockedPosition(vertexCount, 0);
+
+			// Seams: moving one wedge without the others would tear the surface
+			for (u32 v = 0; v < vertexCount; v++)
+			{
+				lockedPosition[positionId[v]] |= wedgeCount[positionId[v]] > 1 ? 1 : 0;
+			}
+
+			// Open borders and non manifold edges: any edge not shared by exactly two triangles
+			std::vector<u64> edges;
+			edges.reserve(result.Indices.size());
+			for (size_t i = 0; i < result.Indices.size(); i += 3)
+			{
+				for (u32 corner = 0; corner < 3; corner++)
+				{
+					const u32 a = positionId[result.Indices[i + corner]];
+					const u32 b = positionId[result.Indices[i + (corner + 1) % 3]];
+					edges.push_back(EdgeKey(std::min(a, b), std::max(a, b)));
+				}
+			}
+
+			std::ranges::sort(edges);
+			for (size_t i = 0; i < edges.size();)
+			{
+				size_t run = i + 1;
+				while (run < edges.size() && edges[run] == edges[i])
+				{
+					run++;
+				}
+
+				if (run - i != 2)
+				{
+					lockedPosition[static_cast<u32>(edges[i] >> 32)] = 1;
+					lockedPosition[static_cast<u32>(edges[i] & 0xFFFFFFFFu)] = 1;
+				}
+				i = run;
+			}
+
+			for (u32 v = 0; v < vertexCount; v++)
+			{
+				locked[v] = lockedPosition[positionId[v]];
+			}
+		}
+
+		// Area weighted plane quadrics, accumulated per position
+		std::vector<Quadric> quadrics(vertexCount);
+		for (size_t i = 0; i < result.Indices.size(); i += 3)
+		{
+			const Float3& p0 = positions[result.Indices[i + 0]];
+			const Float3 normal = Cross(Subtract(positions[result.Indices[i + 1]], p0), Subtract(positions[result.Indices[i + 2]], p0));
+			const f32 length = std::sqrt(Dot(normal, normal));
+			if (length <= 0.0f)
+			{
+				continue;
+			}
+
+			const f64 nx = normal.X / length, ny = normal.Y / length, nz = normal.Z / length;
+			const f64 d = -(nx * p0.X + ny * p0.Y + nz * p0.Z);
+			for (u32 corner = 0; corner < 3; corner++)
+			{
+				quadrics[positionId[result.Indices[i + corner]]].AddPlane(nx, ny, nz, d, 0.5 * length);
+			}
+		}
+
+		auto attributeCost = [&](const u32 from, const u32 to) -> f64
+		{
+			f64 cost = 0.0;
+			if (options.NormalOffset != NoAttribute)
+			{
+				const Float3 delta = Subtract(
+					LoadFloat3(vertices, vertexStride, from, options.NormalOffset),
+					LoadFloat3(vertices, vertexStride, to, options.NormalOffset));
+				cost += options.NormalWeight * Dot(delta, delta);
+			}
+
+			if (options.TexCoordOffset != NoAttribute)
+			{
+				f32 uvFrom[2], uvTo[2];
+				std::memcpy(uvFrom, static_cast<const byte*>(vertices) + size_t{ from } * vertexStride + options.TexCoordOffset, sizeof(uvFrom));
+				std::memcpy(uvTo, static_cast<const byte*>(vertices) + size_t{ to } * vertexStride + options.TexCoordOffset, sizeof(uvTo));
+				const f32 du = uvFrom[0] - uvTo[0];
+				const f32 dv = uvFrom[1] - uvTo[1];
+				cost += options.TexCoordWeight * (du * du + dv * dv);
+			}
+
+			return cost * radiusSquared;
+		};
+
+		const f64 errorLimit = f64{ targetError } * targetError;
+		const u32 targetCount = targetIndexCount - targetIndexCount % 3;
+		f64 maxError = 0.0;
+
+		std::vector<u32> triangleOffsets(vertexCount + 1);
+		std::vector<u32> vertexTriangles;
+		std::vector<u64> directedEdges;
+		std::vector<Collapse> candidates;
+		std::vector<u32> remap(vertexCount);
+		std::vector<u8> touched(vertexCount);
+
+		// Every pass collapses an independent set of the cheapest edges, then rebuilds adjacency
+		while (result.Indices.size() > targetCount)
+		{
+			const u32 triangleCount = static_cast<u32>(result.Indices.size() / 3);
+
+			std::ranges::fill(triangleOffsets, 0u);
+			for (const u32 index : result.Indices)
+			{
+				triangleOffsets[index + 1]++;
+			}
+			std::partial_sum(triangleOffsets.begin(), triangleOffsets.end(), triangleOffsets.begin());
+
+			vertexTriangles.resize(result.Indices.size());
+			{
+				std::vector<u32> cursor(triangleOffsets.begin(), triangleOffsets.end() - 1);
+				for (u32 t = 0; t < triangleCount; t++)
+				{
+					for (u32 corner = 0; corner < 3; corner++)
+					{
+						vertexTriangles[cursor[result.Indices[t * 3 + corner]]++] = t;
+					}
+				}
+			}
+
+			directedEdges.clear();
+			for (u32 t = 0; t < triangleCount; t++)
+			{
+				for (u32 corner = 0; corner < 3; corner++)
+				{
+					const u32 a = result.Indices[t * 3 + corner];
+					const u32 b = result.Indices[t * 3 + (corner + 1) % 3];
+					directedEdges.push_back(EdgeKey(a, b));
+					directedEdges.push_back(EdgeKey(b, a));
+				}
+			}
+
+			std::ranges::sort(directedEdges);
+			directedEdges.erase(std::unique(directedEdges.begin(), directedEdges.end()), directedEdges.end());
+
+			candidates.clear();
+			for (const u64 edge : directedEdges)
+			{
+				const u32 from = static_cast<u32>(edge >> 32);
+				const u32 to   = static_cast<u32>(edge & 0xFFFFFFFFu);
+				if (locked[from] || from == to)
+				{
+					continue;
+				}
+
+				Quadric combined = quadrics[positionId[from]];
+				combined += quadrics[positionId[to]];
+
+				const f64 cost = (combined.Weight > 0.0 ? combined.Evaluate(positions[to]) / combined.Weight : 0.0) + attributeCost(from, to);
+				if (cost <= errorLimit)
+				{
+					candidates.push_back({ from, to, cost });
+				}
+			}
+
+			if (candidates.empty())
+			{
+				break;
+			}
+
+			std::ranges::sort(candidates, {}, &Collapse::Cost);
+
+			std::iota(remap.begin(), remap.end(), 0u);
+			std::ranges::fill(touched, u8{ 0 });
+
+			const u32 trianglesToRemove = (static_cast<u32>(result.Indices.size()) - targetCount) / 3;
+			u32 trianglesRemoved = 0;
+			u32 collapses = 0;
+
+			for (const Collapse& collapse : candidates)
+			{
+				if (trianglesRemoved >= trianglesToRemove)
+				{
+					break;
+				}
+
+				if (touched[collapse.From] || touched[collapse.To])
+				{
+					continue;
+				}
+
+				// Reject collapses that flip or fold any triangle that survives
+				bool flips = false;
+				u32 removedHere = 0;
+				for (u32 i = triangleOffsets[collapse.From]; i < triangleOffsets[collapse.From + 1] && !flips; i++)
+				{
+					const u32* tri = &result.Indices[size_t{ vertexTriangles[i] } * 3];
+					if (tri[0] == collapse.To || tri[1] == collapse.To || tri[2] == collapse.To)
+					{
+						removedHere++;
+						continue;
+					}
+
+					Float3 before[3], after[3];
+					for (u32 corner = 0; corner < 3; corner++)
+					{
+						before[corner] = positions[tri[corner]];
+						after[corner]  = tri[corner] == collapse.From ? positions[collapse.To] : before[corner];
+					}
+
+					const Float3 normalBefore = Cross(Subtract(before[1], before[0]), Subtract(before[2], before[0]));
+					const Float3 normalAfter  = Cross(Subtract(after[1], after[0]), Subtract(after[2], after[0]));
+					flips = Dot(normalBefore, normalAfter) <= 0.0f;
+				}
+
+				if (flips)
+				{
+					continue;
+				}
+
+				remap[collapse.From] = collapse.To;
+				quadrics[positionId[collapse.To]] += quadrics[positionId[collapse.From]];
+				maxError = std::max(maxError, collapse.Cost);
+				trianglesRemoved += removedHere;
+				collapses++;
+
+				touched[collapse.To] = 1;
+				for (u32 i = triangleOffsets[collapse.From]; i < triangleOffsets[collapse.From + 1]; i++)
+				{
+					const u32* tri = &result.Indices[size_t{ vertexTriangles[i] } * 3];
+					touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = 1;
+				}
+			}
+
+			if (collapses == 0)
+			{
+				break;
+			}
+
+			// Apply the collapses and drop the triangles that became degenerate
+			size_t writeOffset = 0;
+			for (size_t i = 0; i < result.Indices.size(); i += 3)
+			{
+				const u32 a = remap[result.Indices[i + 0]];
+				const u32 b = remap[result.Indices[i + 1]];
+				const u32 c = remap[result.Indices[i + 2]];
+				if (a == b || b == c || a == c)
+				{
+					continue;
+				}
+
+				result.Indices[writeOffset++] = a;
+				result.Indices[writeOffset++] = b;
+				result.Indices[writeOffset++] = c;
+			}
+			result.Indices.resize(writeOffset);
+		}
+
+		result.Error = static_cast<f32>(std::sqrt(maxError));
+		return result;
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <span>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	// Quadric error metric edge collapse simplifier (Garland & Heckbert)
+	// Vertices only ever collapse onto existing vertices, so simplified index buffers share the source vertex buffer
+	class MeshSimplifier
+	{
+	public:
+		static constexpr u32 NoAttribute = ~0u;
+
+		struct SimplifyOptions
+		{
+			u32 NormalOffset   = NoAttribute;  // Byte offset of a float3 normal inside the vertex
+			u32 TexCoordOffset = NoAttribute;  // Byte offset of a float2 texture coordinate inside the vertex
+			f32 NormalWeight   = 0.25f;        // Attribute deviation cost, scaled by the squared mesh radius
+			f32 TexCoordWeight = 1.0f;
+			bool LockBorders   = true;         // Keep open boundaries, UV/normal seams and non manifold edges in place
+		};
+
+		struct SimplifyResult
+		{
+			std::vector<u32> Indices;
+			f32 Error = 0.0f;  // Largest collapse error, as an object space distance
+		};
+
+	public:
+		// Collapses edges in order of increasing error until the index count reaches targetIndexCount
+		// or the next collapse would exceed targetError (object space distance)
+		// Positions are float3 at the start of each vertex, vertexStride bytes apart
+		static NODISCARD SimplifyResult Simplify(
+			std::span<const u32> indices,
+			const void* vertices,
+			const u32 vertexCount,
+			const u32 vertexStride,
+			const u32 targetIndexCount,
+			const f32 targetError,
+			const SimplifyOptions& options = {});
+	};
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Math/Math.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/String.h>
+
+namespace Prism::Gfx
+{
+	// Float attribute stream, Stride bytes between elements (never smaller than the element)
+	struct AttributeView
+	{
+		const byte* Data = nullptr;
+		u32 Count        = 0;
+		u32 Stride       = 0;
+
+		NODISCARD inline bool IsValid() const noexcept { return Data != nullptr; }
+	};
+
+	// Index stream of 1, 2 or 4 byte unsigned integers, tightly packed
+	struct IndexView
+	{
+		const byte* Data = nullptr;
+		u32 Count        = 0;
+		u32 IndexSize    = 0;
+
+		NODISCARD inline bool IsValid() const noexcept { return Data != nullptr; }
+	};
+
+	// Non owning views over the streams of one triangle list mesh read by a native loader, the counterpart of an aiMesh
+	struct MeshStreams
+	{
+		AttributeView Positions;  // float3
+		AttributeView Normals;    // float3, optional
+		AttributeView Tangents;   // float4, optional
+		AttributeView TexCoords;  // float2, optional
+		IndexView Indices;        // Optional, non indexed meshes draw their vertices in order
+		u32 MaterialIndex = 0;
+	};
+
+	// Material parameters read by a loader, the counterpart of an aiMaterial
+	struct MaterialSource
+	{
+		static constexpr u32 NoTexture = ~0u;
+
+		Elos::String Name;
+		Vector4 BaseColor    = Vector4::One;
+		Vector3 Emissive     = Vector3::Zero;
+		f32 Metallic         = 0.0f;
+		f32 Roughness        = 1.0f;
+		u32 BaseColorTexture = NoTexture;  // Index into the textures of the same import
+		u32 NormalTexture    = NoTexture;  // Tangent space normal map, not sampled yet but cooked as BC5
+	};
+}
\ No newline at end of file
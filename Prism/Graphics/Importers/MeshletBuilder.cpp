@@ -0,0 +1,222 @@
+#include "Graphics/Importers/MeshletBuilder.h"
+#include <Elos/Common/Assert.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <execution>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		constexpr f32 MinConeSpread = 0.1f;  // Below this min dot(normal, axis) the cone is too wide to ever cull
+
+		inline Vector3 LoadPosition(const void* vertices, const u32 vertexStride, const u32 index)
+		{
+			Vector3 position;
+			std::memcpy(&position, static_cast<const byte*>(vertices) + size_t{ index } * vertexStride, sizeof(Vector3));
+			return position;
+		}
+
+		// Scans [firstTriangle, lastTriangle) and appends the meshlets it closes
+		void ScanChunk(
+			std::span<const u32> indices,
+			const u32 firstTriangle,
+			const u32 lastTriangle,
+			const u32 maxVertices,
+			const u32 maxTriangles,
+			std::vector<Meshlet>& outMeshlets)
+		{
+			std::vector<u32> meshletVertices;
+			meshletVertices.reserve(maxVertices);
+
+			u32 meshletStart = firstTriangle;
+			auto closeMeshlet = [&](const u32 endTriangle)
+			{
+				if (endTriangle > meshletStart)
+				{
+					Meshlet& meshlet    = outMeshlets.emplace_back();
+					meshlet.IndexOffset = meshletStart * 3;
+					meshlet.IndexCount  = (endTriangle - meshletStart) * 3;
+				}
+				meshletVertices.clear();
+				meshletStart = endTriangle;
+			};
+
+			for (u32 triangle = firstTriangle; triangle < lastTriangle; triangle++)
+			{
+				const u32* tri = &indices[size_t{ triangle } * 3];
+
+				// Meshlets are small, a linear search beats any per vertex lookup table here
+				u32 newVertices = 0;
+				for (u32 corner = 0; corner < 3; corner++)
+				{
+					const bool isDuplicate = (corner > 0 && tri[corner] == tri[0]) || (corner > 1 && tri[corner] == tri[1]);
+					if (!isDuplicate && std::ranges::find(meshletVertices, tri[corner]) == meshletVertices.end())
+					{
+						newVertices++;
+					}
+				}
+
+				if (meshletVertices.size() + newVertices > maxVertices || triangle - meshletStart >= maxTriangles)
+				{
+					closeMeshlet(triangle);
+				}
+
+				for (u32 corner = 0; corner < 3; corner++)
+				{
+					if (std::ranges::find(meshletVertices, tri[corner]) == meshletVertices.end())
+					{
+						meshletVertices.push_back(tri[corner]);
+					}
+				}
+			}
+
+			closeMeshlet(lastTriangle);
+		}
+	}
+
+	std::vector<Meshlet> MeshletBuilder::Build(
+		std::span<const u32> indices,
+		const void* vertices,
+		MAYBE_UNUSED const u32 vertexCount,
+		const u32 vertexStride,
+		const u32 maxVertices,
+		const u32 maxTriangles,
+		const bool parallel)
+	{
+		Elos::ASSERT(maxVertices >= 3 && maxTriangles >= 1).Msg("Meshlet limits must fit at least one triangle").Throw();
+
+		const u32 triangleCount = static_cast<u32>(indices.size() / 3);
+		if (triangleCount == 0 || !vertices)
+		{
+			return {};
+		}
+
+		// Every chunk is scanned independently, then chunks are concatenated in order
+		const u32 chunkCount = (triangleCount + ChunkTriangles - 1) / ChunkTriangles;
+		std::vector<std::vector<Meshlet>> chunkMeshlets(chunkCount);
+
+		auto scanChunk = [&](const u32 chunk)
+		{
+			const u32 first = chunk * ChunkTriangles;
+			const u32 last  = std::min(first + ChunkTriangles, triangleCount);
+			chunkMeshlets[chunk].reserve((last - first + maxTriangles - 1) / maxTriangles);
+			ScanChunk(indices, first, last, maxVertices, maxTriangles, chunkMeshlets[chunk]);
+		};
+
+		std::vector<u32> chunkIndices(chunkCount);
+		std::iota(chunkIndices.begin(), chunkIndices.end(), 0u);
+
+		if (parallel && chunkCount > 1)
+		{
+			std::for_each(std::execution::par, chunkIndices.begin(), chunkIndices.end(), scanChunk);
+		}
+		else
+		{
+			std::ranges::for_each(chunkIndices, scanChunk);
+		}
+
+		std::vector<Meshlet> meshlets;
+		size_t totalMeshlets = 0;
+		for (const auto& chunk : chunkMeshlets)
+		{
+			totalMeshlets += chunk.size();
+		}
+
+		meshlets.reserve(totalMeshlets);
+		for (const auto& chunk : chunkMeshlets)
+		{
+			meshlets.insert(meshlets.end(), chunk.begin(), chunk.end());
+		}
+
+		// Bounds are the expensive part and independent per meshlet
+		auto computeBounds = [&](Meshlet& meshlet) { ComputeBounds(meshlet, indices, vertices, vertexStride); };
+		if (parallel)
+		{
+			std::for_each(std::execution::par, meshlets.begin(), meshlets.end(), computeBounds);
+		}
+		else
+		{
+			std::ranges::for_each(meshlets, computeBounds);
+		}
+
+		return meshlets;
+	}
+
+	void MeshletBuilder::ComputeBounds(Meshlet& meshlet, std::span<const u32> indices, const void* vertices, const u32 vertexStride)
+	{
+		const std::span<const u32> range = indices.subspan(meshlet.IndexOffset, meshlet.IndexCount);
+
+		// Bounding sphere centered on the AABB, good enough for clusters this small
+		Vector3 boundsMin(std::numeric_limits<f32>::max());
+		Vector3 boundsMax(std::numeric_limits<f32>::lowest());
+		for (const u32 index : range)
+		{
+			const Vector3 position = LoadPosition(vertices, vertexStride, index);
+			boundsMin = Vector3::Min(boundsMin, position);
+			boundsMax = Vector3::Max(boundsMax, position);
+		}
+
+		meshlet.Center = (boundsMin + boundsMax) * 0.5f;
+
+		f32 radiusSquared = 0.0f;
+		for (const u32 index : range)
+		{
+			radiusSquared = std::max(radiusSquared, Vector3::DistanceSquared(meshlet.Center, LoadPosition(vertices, vertexStride, index)));
+		}
+		meshlet.Radius = std::sqrt(radiusSquared);
+
+		// Normal cone: average of the unit face normals, its spread is the smallest dot with that average
+		const u32 triangleCount = meshlet.IndexCount / 3;
+		std::vector<Vector3> normals;
+		normals.reserve(triangleCount);
+
+		Vector3 axis = Vector3::Zero;
+		for (u32 triangle = 0; triangle < triangleCount; triangle++)
+		{
+			const Vector3 p0 = LoadPosition(vertices, vertexStride, range[triangle * 3 + 0]);
+			const Vector3 p1 = LoadPosition(vertices, vertexStride, range[triangle * 3 + 1]);
+			const Vector3 p2 = LoadPosition(vertices, vertexStride, range[triangle * 3 + 2]);
+
+			Vector3 normal = (p1 - p0).Cross(p2 - p0);
+			const f32 length = normal.Length();
+			if (length <= kEpsilon)
+			{
+				continue;  // Degenerate triangles never rasterize and do not constrain the cone
+			}
+
+			normal /= length;
+			normals.push_back(normal);
+			axis += normal;
+		}
+
+		meshlet.ConeAxis   = Vector3::Zero;
+		meshlet.ConeCutoff = 1.0f;
+
+		const f32 axisLength = axis.Length();
+		if (normals.empty() || axisLength <= kEpsilon)
+		{
+			return;
+		}
+
+		axis /= axisLength;
+
+		f32 minDot = 1.0f;
+		for (const Vector3& normal : normals)
+		{
+			minDot = std::min(minDot, normal.Dot(axis));
+		}
+
+		if (minDot <= MinConeSpread)
+		{
+			return;
+		}
+
+		meshlet.ConeAxis   = axis;
+		meshlet.ConeCutoff = std::sqrt(1.0f - minDot * minDot);
+	}
+}
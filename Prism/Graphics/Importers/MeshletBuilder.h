@@ -0,0 +1,34 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Graphics/Meshlet.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <span>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	// Splits triangle lists into meshlets with culling bounds
+	class MeshletBuilder
+	{
+	public:
+		static constexpr u32 DefaultMaxVertices  = 64;
+		static constexpr u32 DefaultMaxTriangles = 124;
+		static constexpr u32 ChunkTriangles      = 16 * 1024;  // Triangles scanned per task, meshlets never span two chunks
+
+	public:
+		// Greedily groups consecutive triangles, so the index buffer needs no reordering and every meshlet is a
+		// contiguous index range. Run it after OptimizeVertexCache/OptimizeOverdraw to get spatially coherent clusters
+		// Positions are float3 at the start of each vertex, vertexStride bytes apart
+		static NODISCARD std::vector<Meshlet> Build(
+			std::span<const u32> indices,
+			const void* vertices,
+			const u32 vertexCount,
+			const u32 vertexStride,
+			const u32 maxVertices  = DefaultMaxVertices,
+			const u32 maxTriangles = DefaultMaxTriangles,
+			const bool parallel    = true);
+
+		// Fills the bounding sphere and normal cone of a meshlet from its index range
+		static void ComputeBounds(Meshlet& meshlet, std::span<const u32> indices, const void* vertices, const u32 vertexStride);
+	};
+}
@@ -0,0 +1,828 @@
+#include "Graphics/Importers/ObjLoader.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <execution>
+#include <format>
+#include <numeric>
+#include <string_view>
+#include <unordered_map>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		constexpr u32 MissingIndex  = ~0u;
+		constexpr size_t WeldBlock  = 64 * 1024;  // Corners per task in the weld passes
+		constexpr u32 MaxDigits     = 19;         // Decimal digits that always fit a u64 mantissa
+
+		constexpr f64 PowersOf10[] =
+		{
+			1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		struct Corner
+		{
+			u32 Position = MissingIndex;
+			u32 TexCoord = MissingIndex;
+			u32 Normal   = MissingIndex;
+		};
+
+		struct WeldEntry
+		{
+			Corner Key;
+			u32 Slot = 0;  // Position of the corner in the group index buffer
+		};
+
+		struct GroupMarker
+		{
+			u64 Corner = 0;  // Corners of the chunk emitted before the marker
+			bool IsMaterial = false;
+			std::string_view Name;
+		};
+
+		struct Chunk
+		{
+			const char* Begin = nullptr;
+			const char* End   = nullptr;
+
+			// Element counts found by the first pass, turned into global offsets before parsing
+			u32 PositionCount = 0;
+			u32 TexCoordCount = 0;
+			u32 NormalCount   = 0;
+			u32 PositionBase  = 0;
+			u32 TexCoordBase  = 0;
+			u32 NormalBase    = 0;
+
+			std::vector<Corner> Corners;  // Triangle list
+			std::vector<GroupMarker> Markers;
+			std::vector<std::string_view> Libraries;  // mtllib file names
+			const char* ErrorLine = nullptr;
+			std::string_view Error;
+		};
+
+		struct GroupRange
+		{
+			u32 Chunk = 0;
+			u64 Begin = 0;
+			u64 End   = 0;
+		};
+
+		inline bool operator==(const Corner& lhs, const Corner& rhs) noexcept
+		{
+			return lhs.Position == rhs.Position && lhs.TexCoord == rhs.TexCoord && lhs.Normal == rhs.Normal;
+		}
+
+		inline bool operator<(const WeldEntry& lhs, const WeldEntry& rhs) noexcept
+		{
+			if (lhs.Key.Position != rhs.Key.Position) return lhs.Key.Position < rhs.Key.Position;
+			if (lhs.Key.TexCoord != rhs.Key.TexCoord) return lhs.Key.TexCoord < rhs.Key.TexCoord;
+			if (lhs.Key.Normal != rhs.Key.Normal)     return lhs.Key.Normal < rhs.Key.Normal;
+			return lhs.Slot < rhs.Slot;
+		}
+
+		// Runs fn(begin, end) over blocks of [0, count), on the worker pool when parallel is set
+		template <typename Function>
+		void ForEachBlock(const size_t count, const bool parallel, const Function& fn)
+		{
+			const size_t blockCount = (count + WeldBlock - 1) / WeldBlock;
+			if (!parallel || blockCount <= 1)
+			{
+				fn(size_t{ 0 }, count);
+				return;
+			}
+
+			std::vector<size_t> blocks(blockCount);
+			std::iota(blocks.begin(), blocks.end(), size_t{ 0 });
+			std::for_each(std::execution::par, blocks.begin(), blocks.end(), [&](const size_t block)
+			{
+				fn(block * WeldBlock, std::min(count, (block + 1) * WeldBlock));
+			});
+		}
+
+		// SWAR digit helpers, eight ASCII characters loaded as one little endian u64
+		inline bool IsEightDigits(const u64 value) noexcept
+		{
+			return (((value & 0xF0F0F0F0F0F0F0F0ull) | (((value + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+				== 0x3333333333333333ull);
+		}
+
+		inline u64 ParseEightDigits(u64 value) noexcept
+		{
+			value = (value & 0x0F0F0F0F0F0F0F0Full) * 2561 >> 8;
+			value = (value & 0x00FF00FF00FF00FFull) * 6553601 >> 16;
+			return (value & 0x0000FFFF0000FFFFull) * 42949672960001ull >> 32;
+		}
+
+		inline bool IsDigit(const char c) noexcept
+		{
+			return static_cast<unsigned char>(c - '0') < 10;
+		}
+
+		inline const char* SkipSpaces(const char* cursor, const char* end) noexcept
+		{
+			while (cursor < end && (*cursor == ' ' || *cursor == '\t'))
+			{
+				cursor++;
+			}
+			return cursor;
+		}
+
+		inline bool IsSpace(const char* cursor, const char* end) noexcept
+		{
+			return cursor < end && (*cursor == ' ' || *cursor == '\t');
+		}
+
+		inline const char* FindLineEnd(const char* cursor, const char* end) noexcept
+		{
+			const void* newline = std::memchr(cursor, '\n', static_cast<size_t>(end - cursor));
+			return newline ? static_cast<const char*>(newline) : end;
+		}
+
+		// Resolves a 1 based (or negative, relative) OBJ index against the elements defined before it
+		inline bool ParseIndex(const char*& cursor, const char* end, const u32 definedBefore, const u32 total, u32& out) noexcept
+		{
+			i64 value = 0;
+			const auto [next, ec] = std::from_chars(cursor, end, value);
+			if (ec != std::errc{})
+			{
+				return false;
+			}
+			cursor = next;
+
+			const i64 resolved = value > 0 ? value - 1 : i64{ definedBefore } + value;
+			if (value == 0 || resolved < 0 || resolved >= total)
+			{
+				return false;
+			}
+
+			out = static_cast<u32>(resolved);
+			return true;
+		}
+
+		std::string_view TrimName(const char* begin, const char* end) noexcept
+		{
+			begin = SkipSpaces(begin, end);
+			while (end > begin && std::isspace(static_cast<unsigned char>(end[-1])))
+			{
+				end--;
+			}
+			return std::string_view(begin, static_cast<size_t>(end - begin));
+		}
+
+		void CountElements(Chunk& chunk) noexcept
+		{
+			for (const char* line = chunk.Begin; line < chunk.End;)
+			{
+				const char* lineEnd = FindLineEnd(line, chunk.End);
+				const char* cursor  = SkipSpaces(line, lineEnd);
+
+				if (lineEnd - cursor > 2 && cursor[0] == 'v')
+				{
+					if (IsSpace(cursor + 1, lineEnd))
+					{
+						chunk.PositionCount++;
+					}
+					else if (cursor[1] == 't' && IsSpace(cursor + 2, lineEnd))
+					{
+						chunk.TexCoordCount++;
+					}
+					else if (cursor[1] == 'n' && IsSpace(cursor + 2, lineEnd))
+					{
+						chunk.NormalCount++;
+					}
+				}
+
+				line = lineEnd + 1;
+			}
+		}
+
+		struct Totals
+		{
+			u32 Positions = 0;
+			u32 TexCoords = 0;
+			u32 Normals   = 0;
+		};
+
+		void ParseChunk(Chunk& chunk, const Totals& totals, f32* positions, f32* texCoords, f32* normals)
+		{
+			u32 position = chunk.PositionBase;
+			u32 texCoord = chunk.TexCoordBase;
+			u32 normal   = chunk.NormalBase;
+
+			std::vector<Corner> face;
+			face.reserve(8);
+
+			const auto Fail = [&chunk](const char* line, const std::string_view reason)
+			{
+				chunk.ErrorLine = line;
+				chunk.Error     = reason;
+			};
+
+			const auto ParseFloats = [](const char*& cursor, const char* end, f32* out, const u32 count) noexcept
+			{
+				for (u32 i = 0; i < count; i++)
+				{
+					cursor = SkipSpaces(cursor, end);
+					if (!ObjLoader::ParseFloat(cursor, end, out[i]))
+					{
+						return false;
+					}
+				}
+				return true;
+			};
+
+			for (const char* line = chunk.Begin; line < chunk.End;)
+			{
+				const char* lineEnd = FindLineEnd(line, chunk.End);
+				const char* cursor  = SkipSpaces(line, lineEnd);
+				const char* next    = lineEnd + 1;
+
+				if (lineEnd - cursor < 2)
+				{
+					line = next;
+					continue;
+				}
+
+				if (cursor[0] == 'v' && IsSpace(cursor + 1, lineEnd))
+				{
+					// Extra components (vertex colors) are ignored
+					cursor += 1;
+					if (!ParseFloats(cursor, lineEnd, positions + size_t{ position } * 3, 3))
+					{
+						return Fail(line, "invalid vertex position");
+					}
+					position++;
+				}
+				else if (cursor[0] == 'v' && cursor[1] == 't' && IsSpace(cursor + 2, lineEnd))
+				{
+					cursor += 2;
+					f32* out = texCoords + size_t{ texCoord } * 2;
+					if (!ParseFloats(cursor, lineEnd, out, 1))
+					{
+						return Fail(line, "invalid texture coordinate");
+					}
+
+					// V is optional
+					cursor = SkipSpaces(cursor, lineEnd);
+					if (!ObjLoader::ParseFloat(cursor, lineEnd, out[1]))
+					{
+						out[1] = 0.0f;
+					}
+					texCoord++;
+				}
+				else if (cursor[0] == 'v' && cursor[1] == 'n' && IsSpace(cursor + 2, lineEnd))
+				{
+					cursor += 2;
+					if (!ParseFloats(cursor, lineEnd, normals + size_t{ normal } * 3, 3))
+					{
+						return Fail(line, "invalid normal");
+					}
+					normal++;
+				}
+				else if (cursor[0] == 'f' && IsSpace(cursor + 1, lineEnd))
+				{
+					face.clear();
+					cursor = SkipSpaces(cursor + 1, lineEnd);
+
+					while (cursor < lineEnd && !std::isspace(static_cast<unsigned char>(*cursor)))
+					{
+						Corner& corner = face.emplace_back();
+						if (!ParseIndex(cursor, lineEnd, position, totals.Positions, corner.Position))
+						{
+							return Fail(line, "invalid face position index");
+						}
+
+						// v, v/vt, v//vn or v/vt/vn
+						if (cursor < lineEnd && *cursor == '/')
+						{
+							cursor++;
+							if (cursor < lineEnd && *cursor != '/' &&
+								!ParseIndex(cursor, lineEnd, texCoord, totals.TexCoords, corner.TexCoord))
+							{
+								return Fail(line, "invalid face texture coordinate index");
+							}
+
+							if (cursor < lineEnd && *cursor == '/')
+							{
+								cursor++;
+								if (!ParseIndex(cursor, lineEnd, normal, totals.Normals, corner.Normal))
+								{
+									return Fail(line, "invalid face normal index");
+								}
+							}
+						}
+
+						cursor = SkipSpaces(cursor, lineEnd);
+					}
+
+					// Polygons are triangulated as fans, which is exact for the convex faces exporters write
+					for (size_t i = 2; i < face.size(); i++)
+					{
+						chunk.Corners.push_back(face[0]);
+						chunk.Corners.push_back(face[i - 1]);
+						chunk.Corners.push_back(face[i]);
+					}
+				}
+				else if ((cursor[0] == 'o' || cursor[0] == 'g') && IsSpace(cursor + 1, lineEnd))
+				{
+					chunk.Markers.push_back(GroupMarker{ .Corner = chunk.Corners.size(), .IsMaterial = false, .Name = TrimName(cursor + 1, lineEnd) });
+				}
+				else if (std::string_view(cursor, static_cast<size_t>(lineEnd - cursor)).starts_with("usemtl") && IsSpace(cursor + 6, lineEnd))
+				{
+					chunk.Markers.push_back(GroupMarker{ .Corner = chunk.Corners.size(), .IsMaterial = true, .Name = TrimName(cursor + 6, lineEnd) });
+				}
+				else if (std::string_view(cursor, static_cast<size_t>(lineEnd - cursor)).starts_with("mtllib") && IsSpace(cursor + 6, lineEnd))
+				{
+					chunk.Libraries.push_back(TrimName(cursor + 6, lineEnd));
+				}
+
+				line = next;
+			}
+		}
+
+		// Reads the colors of a .mtl file. The first definition of a material wins and missing libraries are skipped,
+		// which leaves their materials at the defaults like Assimp does
+		void ReadMaterialLibrary(const fs::path& path, std::unordered_map<Elos::String, MaterialSource>& outMaterials)
+		{
+			auto fileResult = MappedFile::Open(path);
+			if (!fileResult)
+			{
+				return;
+			}
+
+			const char* begin = reinterpret_cast<const char*>(fileResult.value().GetData().data());
+			const char* end   = begin + fileResult.value().GetSize();
+
+			MaterialSource* material = nullptr;
+			for (const char* line = begin; line < end;)
+			{
+				const char* lineEnd = FindLineEnd(line, end);
+				const char* cursor  = SkipSpaces(line, lineEnd);
+				const char* args    = cursor;
+				while (args < lineEnd && !std::isspace(static_cast<unsigned char>(*args)))
+				{
+					args++;
+				}
+
+				const std::string_view keyword(cursor, static_cast<size_t>(args - cursor));
+				const auto ReadFloats = [&](f32* out, const u32 count)
+				{
+					for (u32 i = 0; i < count; i++)
+					{
+						args = SkipSpaces(args, lineEnd);
+						if (!ObjLoader::ParseFloat(args, lineEnd, out[i]))
+						{
+							return;
+						}
+					}
+				};
+
+				if (keyword == "newmtl")
+				{
+					const Elos::String name(TrimName(args, lineEnd));
+					const auto [it, inserted] = outMaterials.try_emplace(name);
+					material = inserted ? &it->second : nullptr;
+					if (material)
+					{
+						material->Name = name;
+					}
+				}
+				else if (material)
+				{
+					f32 value = 0.0f;
+					if (keyword == "Kd")      ReadFloats(&material->BaseColor.x, 3);
+					else if (keyword == "Ke") ReadFloats(&material->Emissive.x, 3);
+					else if (keyword == "d")  ReadFloats(&material->BaseColor.w, 1);
+					else if (keyword == "Pm") ReadFloats(&material->Metallic, 1);
+					else if (keyword == "Pr") ReadFloats(&material->Roughness, 1);
+					else if (keyword == "Tr")
+					{
+						ReadFloats(&value, 1);
+						material->BaseColor.w = 1.0f - value;
+					}
+				}
+
+				line = lineEnd + 1;
+			}
+		}
+	}
+
+	MeshStreams ObjLoader::MeshGroup::AsStreams() const noexcept
+	{
+		const u32 vertexCount = static_cast<u32>(Positions.size() / 3);
+		MeshStreams streams;
+
+		streams.Positions = AttributeView{ .Data = reinterpret_cast<const byte*>(Positions.data()), .Count = vertexCount, .Stride = 3 * sizeof(f32) };
+		if (!Normals.empty())
+		{
+			streams.Normals = AttributeView{ .Data = reinterpret_cast<const byte*>(Normals.data()), .Count = vertexCount, .Stride = 3 * sizeof(f32) };
+		}
+		if (!TexCoords.empty())
+		{
+			streams.TexCoords = AttributeView{ .Data = reinterpret_cast<const byte*>(TexCoords.data()), .Count = vertexCount, .Stride = 2 * sizeof(f32) };
+		}
+		streams.Indices = IndexView{ .Data = reinterpret_cast<const byte*>(Indices.data()), .Count = static_cast<u32>(Indices.size()), .IndexSize = sizeof(u32) };
+		streams.MaterialIndex = MaterialIndex;
+
+		return streams;
+	}
+
+	bool ObjLoader::IsObjFile(const fs::path& path)
+	{
+		Elos::String extension = path.extension().string();
+		std::ranges::transform(extension, extension.begin(), [](const char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+		return extension == ".obj";
+	}
+
+	bool ObjLoader::ParseFloat(const char*& cursor, const char* end, f32& out) noexcept
+	{
+		const char* p = cursor;
+		if (p < end && (*p == '-' || *p == '+'))
+		{
+			p++;
+		}
+		const bool negative = p != cursor && *cursor == '-';
+		const char* numberStart = p;
+
+		u64 mantissa   = 0;
+		u32 digits     = 0;
+		i32 exponent   = 0;
+		bool exact     = true;
+		bool anyDigits = false;
+
+		const auto ConsumeDigits = [&](const bool isFraction)
+		{
+			while (end - p >= 8 && digits + 8 <= MaxDigits)
+			{
+				u64 chunk;
+				std::memcpy(&chunk, p, sizeof(chunk));
+				if (!IsEightDigits(chunk))
+				{
+					break;
+				}
+
+				mantissa = mantissa * 100000000ull + ParseEightDigits(chunk);
+				digits += 8;
+				exponent -= isFraction ? 8 : 0;
+				anyDigits = true;
+				p += 8;
+			}
+
+			for (; p < end && IsDigit(*p); p++)
+			{
+				anyDigits = true;
+				if (digits < MaxDigits)
+				{
+					mantissa = mantissa * 10 + static_cast<u64>(*p - '0');
+					digits++;
+					exponent -= isFraction ? 1 : 0;
+				}
+				else
+				{
+					exact = false;
+				}
+			}
+		};
+
+		ConsumeDigits(false);
+		if (p < end && *p == '.')
+		{
+			p++;
+			ConsumeDigits(true);
+		}
+
+		if (!anyDigits)
+		{
+			return false;
+		}
+
+		if (p < end && (*p == 'e' || *p == 'E'))
+		{
+			const char* exponentStart = p + 1;
+			if (exponentStart < end && *exponentStart == '+')
+			{
+				exponentStart++;
+			}
+
+			i32 value = 0;
+			const auto [next, ec] = std::from_chars(exponentStart, end, value);
+			if (ec == std::errc{})
+			{
+				exponent += value;
+				p = next;
+			}
+			else if (ec == std::errc::result_out_of_range)
+			{
+				exact = false;
+				p = next;
+			}
+		}
+
+		// Both operands are exact doubles, so the result is correctly rounded before the narrowing to float
+		if (exact && mantissa <= (u64{ 1 } << 53) && exponent >= -22 && exponent <= 22)
+		{
+			const f64 value = exponent < 0
+				? static_cast<f64>(mantissa) / PowersOf10[-exponent]
+				: static_cast<f64>(mantissa) * PowersOf10[exponent];
+			out = static_cast<f32>(negative ? -value : value);
+		}
+		else
+		{
+			const auto [next, ec] = std::from_chars(numberStart, p, out);
+			if (ec != std::errc{} && ec != std::errc::result_out_of_range)
+			{
+				return false;
+			}
+			out = negative ? -out : out;
+		}
+
+		cursor = p;
+		return true;
+	}
+
+	std::expected<ObjLoader::Document, ObjLoader::ObjError> ObjLoader::Load(const fs::path& path, const bool parallel)
+	{
+		auto fileResult = MappedFile::Open(path);
+		if (!fileResult)
+		{
+			return std::unexpected(ObjError
+			{
+				.Type      = ObjError::Type::OpenFailed,
+				.ErrorCode = fileResult.error().ErrorCode,
+				.Message   = fileResult.error().Message
+			});
+		}
+
+		const MappedFile& file = fileResult.value();
+		const char* fileBegin  = reinterpret_cast<const char*>(file.GetData().data());
+		const char* fileEnd    = fileBegin + file.GetSize();
+
+		const auto InvalidFormat = [&path](const std::string_view reason)
+		{
+			return std::unexpected(ObjError
+			{
+				.Type      = ObjError::Type::InvalidFormat,
+				.ErrorCode = E_FAIL,
+				.Message   = std::format("Invalid OBJ file {} ({})", path.string(), reason)
+			});
+		};
+
+		// Line aligned chunks
+		std::vector<Chunk> chunks;
+		for (const char* begin = fileBegin; begin < fileEnd;)
+		{
+			const char* end = begin + std::min<size_t>(ChunkSize, static_cast<size_t>(fileEnd - begin));
+			end = end < fileEnd ? std::min(FindLineEnd(end, fileEnd) + 1, fileEnd) : fileEnd;
+
+			chunks.push_back(Chunk{ .Begin = begin, .End = end });
+			begin = end;
+		}
+
+		const auto ForEachChunk = [&chunks, parallel](const auto& fn)
+		{
+			if (parallel && chunks.size() > 1)
+			{
+				std::for_each(std::execution::par, chunks.begin(), chunks.end(), fn);
+			}
+			else
+			{
+				std::ranges::for_each(chunks, fn);
+			}
+		};
+
+		// Pass 1 counts elements so every chunk knows where its vertices land and how to resolve relative indices
+		ForEachChunk([](Chunk& chunk) { CountElements(chunk); });
+
+		Totals totals;
+		for (Chunk& chunk : chunks)
+		{
+			chunk.PositionBase = totals.Positions;
+			chunk.TexCoordBase = totals.TexCoords;
+			chunk.NormalBase   = totals.Normals;
+
+			if (u64{ totals.Positions } + chunk.PositionCount >= MissingIndex ||
+				u64{ totals.TexCoords } + chunk.TexCoordCount >= MissingIndex ||
+				u64{ totals.Normals } + chunk.NormalCount >= MissingIndex)
+			{
+				return InvalidFormat("too many vertices");
+			}
+
+			totals.Positions += chunk.PositionCount;
+			totals.TexCoords += chunk.TexCoordCount;
+			totals.Normals   += chunk.NormalCount;
+		}
+
+		std::vector<f32> positions(size_t{ totals.Positions } * 3);
+		std::vector<f32> texCoords(size_t{ totals.TexCoords } * 2);
+		std::vector<f32> normals(size_t{ totals.Normals } * 3);
+
+		// Pass 2 parses floats straight into the shared arrays and collects triangulated corners per chunk
+		ForEachChunk([&](Chunk& chunk) { ParseChunk(chunk, totals, positions.data(), texCoords.data(), normals.data()); });
+
+		for (const Chunk& chunk : chunks)
+		{
+			if (chunk.ErrorLine)
+			{
+				return InvalidFormat(std::format("{} at byte {}", chunk.Error, chunk.ErrorLine - fileBegin));
+			}
+		}
+
+		// Split corners into groups, one per object/group and material pair like Assimp does
+		Document document;
+		std::vector<std::vector<GroupRange>> groupRanges;
+		std::unordered_map<Elos::String, u32> groupSlots;
+		std::unordered_map<std::string_view, u32> materialSlots;
+
+		std::string_view objectName;
+		std::string_view materialName;
+		u32 currentGroup = MissingIndex;
+
+		const auto SelectGroup = [&]()
+		{
+			Elos::String key = std::format("{}\n{}", objectName, materialName);
+			auto [it, inserted] = groupSlots.try_emplace(std::move(key), static_cast<u32>(document.Groups.size()));
+			if (inserted)
+			{
+				MeshGroup& group = document.Groups.emplace_back();
+				group.Name = materialName.empty()
+					? Elos::String(objectName)
+					: std::format("{} ({})", objectName, materialName);
+				group.MaterialIndex = materialSlots.try_emplace(materialName, static_cast<u32>(materialSlots.size())).first->second;
+				groupRanges.emplace_back();
+			}
+			currentGroup = it->second;
+		};
+
+		SelectGroup();
+		for (u32 chunkIndex = 0; chunkIndex < chunks.size(); chunkIndex++)
+		{
+			const Chunk& chunk = chunks[chunkIndex];
+			u64 rangeBegin = 0;
+
+			const auto CloseRange = [&](const u64 rangeEnd)
+			{
+				if (rangeEnd > rangeBegin)
+				{
+					groupRanges[currentGroup].push_back(GroupRange{ .Chunk = chunkIndex, .Begin = rangeBegin, .End = rangeEnd });
+				}
+				rangeBegin = rangeEnd;
+			};
+
+			for (const GroupMarker& marker : chunk.Markers)
+			{
+				CloseRange(marker.Corner);
+				(marker.IsMaterial ? materialName : objectName) = marker.Name;
+				SelectGroup();
+			}
+			CloseRange(chunk.Corners.size());
+		}
+
+		// Weld every group: sort corners by their index triplet, the first corner of each run becomes a vertex
+		for (size_t groupIndex = 0; groupIndex < document.Groups.size(); groupIndex++)
+		{
+			MeshGroup& group = document.Groups[groupIndex];
+
+			u64 cornerCount = 0;
+			for (const GroupRange& range : groupRanges[groupIndex])
+			{
+				cornerCount += range.End - range.Begin;
+			}
+
+			if (cornerCount >= MissingIndex)
+			{
+				return InvalidFormat("group has too many faces");
+			}
+
+			std::vector<WeldEntry> entries;
+			entries.reserve(cornerCount);
+
+			bool hasTexCoords = false;
+			bool hasNormals   = false;
+			for (const GroupRange& range : groupRanges[groupIndex])
+			{
+				const std::vector<Corner>& corners = chunks[range.Chunk].Corners;
+				for (u64 i = range.Begin; i < range.End; i++)
+				{
+					hasTexCoords |= corners[i].TexCoord != MissingIndex;
+					hasNormals   |= corners[i].Normal != MissingIndex;
+					entries.push_back(WeldEntry{ .Key = corners[i], .Slot = static_cast<u32>(entries.size()) });
+				}
+			}
+
+			if (entries.empty())
+			{
+				continue;
+			}
+
+			if (parallel)
+			{
+				std::sort(std::execution::par, entries.begin(), entries.end());
+			}
+			else
+			{
+				std::sort(entries.begin(), entries.end());
+			}
+
+			// Vertex id of each sorted entry, 1 based, from a prefix sum over the run starts
+			std::vector<u32> vertexIds(entries.size());
+			ForEachBlock(entries.size(), parallel, [&](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; i++)
+				{
+					vertexIds[i] = (i == 0 || !(entries[i].Key == entries[i - 1].Key)) ? 1u : 0u;
+				}
+			});
+
+			if (parallel)
+			{
+				std::inclusive_scan(std::execution::par, vertexIds.begin(), vertexIds.end(), vertexIds.begin());
+			}
+			else
+			{
+				std::inclusive_scan(vertexIds.begin(), vertexIds.end(), vertexIds.begin());
+			}
+
+			const u32 vertexCount = vertexIds.back();
+			group.Positions.resize(size_t{ vertexCount } * 3);
+			group.TexCoords.resize(hasTexCoords ? size_t{ vertexCount } * 2 : 0);
+			group.Normals.resize(hasNormals ? size_t{ vertexCount } * 3 : 0);
+			group.Indices.resize(entries.size());
+
+			ForEachBlock(entries.size(), parallel, [&](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; i++)
+				{
+					const WeldEntry& entry = entries[i];
+					const u32 vertex = vertexIds[i] - 1;
+					group.Indices[entry.Slot] = vertex;
+
+					if (i != 0 && vertexIds[i] == vertexIds[i - 1])
+					{
+						continue;  // Not the first corner of its run
+					}
+
+					std::memcpy(&group.Positions[size_t{ vertex } * 3], &positions[size_t{ entry.Key.Position } * 3], 3 * sizeof(f32));
+
+					if (hasTexCoords)
+					{
+						f32* out = &group.TexCoords[size_t{ vertex } * 2];
+						if (entry.Key.TexCoord != MissingIndex)
+						{
+							std::memcpy(out, &texCoords[size_t{ entry.Key.TexCoord } * 2], 2 * sizeof(f32));
+						}
+						else
+						{
+							out[0] = out[1] = 0.0f;
+						}
+					}
+
+					if (hasNormals)
+					{
+						f32* out = &group.Normals[size_t{ vertex } * 3];
+						if (entry.Key.Normal != MissingIndex)
+						{
+							std::memcpy(out, &normals[size_t{ entry.Key.Normal } * 3], 3 * sizeof(f32));
+						}
+						else
+						{
+							out[0] = out[1] = out[2] = 0.0f;
+						}
+					}
+				}
+			});
+		}
+
+		// Groups only named by markers never received faces
+		std::erase_if(document.Groups, [](const MeshGroup& group) { return group.Indices.empty(); });
+
+		// Materials in slot order, faces before any usemtl use the default material
+		std::unordered_map<Elos::String, MaterialSource> libraryMaterials;
+		for (const Chunk& chunk : chunks)
+		{
+			for (const std::string_view library : chunk.Libraries)
+			{
+				const fs::path& libraryPath = document.Sidecars.emplace_back(path.parent_path() / fs::path(library));
+				ReadMaterialLibrary(libraryPath, libraryMaterials);
+			}
+		}
+
+		document.Materials.resize(materialSlots.size());
+		for (const auto& [name, slot] : materialSlots)
+		{
+			const auto it = libraryMaterials.find(Elos::String(name));
+			if (it != libraryMaterials.end())
+			{
+				document.Materials[slot] = it->second;
+			}
+			else
+			{
+				document.Materials[slot].Name = name.empty() ? Elos::String("DefaultMaterial") : Elos::String(name);
+			}
+		}
+
+		return document;
+	}
+}
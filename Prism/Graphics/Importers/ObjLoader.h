@@ -0,0 +1,61 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Graphics/Importers/MeshStreams.h"
+#include "Utils/MappedFile.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/String.h>
+#include <expected>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	// Multithreaded Wavefront OBJ reader
+	// The mapped file is split into line aligned chunks that are parsed in parallel, then the position/uv/normal
+	// index triplets of every face corner are welded into unique vertices with a parallel sort
+	class ObjLoader
+	{
+	public:
+		struct ObjError
+		{
+			enum class Type
+			{
+				OpenFailed,
+				InvalidFormat
+			};
+
+			Type Type;
+			HRESULT ErrorCode;
+			Elos::String Message;
+		};
+
+		// Faces sharing an object/group and material, triangulated as fans and welded
+		struct MeshGroup
+		{
+			Elos::String Name;
+			std::vector<f32> Positions;  // float3
+			std::vector<f32> Normals;    // float3, empty when the faces reference none
+			std::vector<f32> TexCoords;  // float2, empty when the faces reference none
+			std::vector<u32> Indices;
+			u32 MaterialIndex = 0;  // Distinct usemtl names in order of first use
+
+			NODISCARD MeshStreams AsStreams() const noexcept;
+		};
+
+		struct Document
+		{
+			std::vector<MeshGroup> Groups;  // In order of first appearance
+			std::vector<MaterialSource> Materials;  // Indexed by MeshGroup::MaterialIndex, colors come from the mtllib files
+			std::vector<fs::path> Sidecars;  // Every mtllib file referenced, also the missing ones
+		};
+
+		static constexpr size_t ChunkSize = 4 * 1024 * 1024;  // Bytes parsed per task
+
+	public:
+		static NODISCARD bool IsObjFile(const fs::path& path);
+		static NODISCARD std::expected<Document, ObjError> Load(const fs::path& path, const bool parallel = true);
+
+		// Decimal float parser used for vertex data, eight digits at a time. Advances 'cursor' past the number
+		// Falls back to std::from_chars for inputs it cannot convert exactly enough (over 19 digits, huge exponents)
+		static NODISCARD bool ParseFloat(const char*& cursor, const char* end, f32& out) noexcept;
+	};
+}
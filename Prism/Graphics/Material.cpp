@@ -0,0 +1,17 @@
+#include "Graphics/Material.h"
+#include "Graphics/Renderer.h"
+
+namespace Prism::Gfx
+{
+	void Material::Bind(const Renderer& renderer) const noexcept
+	{
+		ID3D11ShaderResourceView* srvs[] = { m_baseColorTexture ? m_baseColorTexture->GetSRV() : nullptr };
+		renderer.SetShaderResourceViews(Shader::Type::Pixel, BaseColorTextureSlot, std::span{ srvs });
+
+		if (m_constantBuffer)
+		{
+			const Buffer* constantBuffers[] = { m_constantBuffer.get() };
+			renderer.SetConstantBuffers(ConstantBufferSlot, Shader::Type::Pixel, std::span{ constantBuffers });
+		}
+	}
+}
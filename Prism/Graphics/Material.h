@@ -0,0 +1,72 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Math/Math.h"
+#include "Graphics/Resources/Buffers/ConstantBuffer.h"
+#include "Graphics/Resources/Texture2D.h"
+#include <Elos/Common/String.h>
+#include <Elos/Common/FunctionMacros.h>
+#include <memory>
+
+namespace Prism::Gfx
+{
+	class Renderer;
+
+	// Surface parameters shared by every mesh drawn with them, bound once per material by Model::Render
+	class Material
+	{
+		friend class ResourceFactory;
+	public:
+		struct MaterialError
+		{
+			enum class Type
+			{
+				CreateConstantBufferFailed
+			};
+
+			Type Type;
+			HRESULT ErrorCode;
+			Elos::String Message;
+		};
+
+		// Pixel shader constants (register b2), metallic/roughness parameters like glTF
+		struct MaterialConstants
+		{
+			Vector4 BaseColor       = Vector4::One;
+			Vector4 Emissive        = Vector4::Zero;  // w unused
+			f32 Metallic            = 0.0f;
+			f32 Roughness           = 1.0f;
+			u32 HasBaseColorTexture = 0;
+			f32 Padding             = 0.0f;
+		};
+
+		struct MaterialDesc
+		{
+			Elos::String Name;
+			Vector4 BaseColor = Vector4::One;
+			Vector3 Emissive  = Vector3::Zero;
+			f32 Metallic      = 0.0f;
+			f32 Roughness     = 1.0f;
+			std::shared_ptr<Texture2D> BaseColorTexture;  // Optional, multiplied with BaseColor
+		};
+
+		static constexpr u32 ConstantBufferSlot   = 2;
+		static constexpr u32 BaseColorTextureSlot = 0;
+
+	public:
+		// Binds the constants and the base color texture, or a null view when there is none
+		void Bind(const Renderer& renderer) const noexcept;
+
+		inline NODISCARD const Elos::String& GetName() const noexcept { return m_name; }
+		inline NODISCARD const MaterialConstants& GetConstants() const noexcept { return m_constants; }
+		inline NODISCARD Texture2D* GetBaseColorTexture() const noexcept { return m_baseColorTexture.get(); }
+
+	private:
+		Material() noexcept = default;
+
+	private:
+		Elos::String                                       m_name;
+		MaterialConstants                                  m_constants;
+		std::shared_ptr<Texture2D>                         m_baseColorTexture;
+		std::shared_ptr<ConstantBuffer<MaterialConstants>> m_constantBuffer;
+	};
+}
@@ -1,16 +1,36 @@
 #include "Mesh.h"
 #include <Graphics/Renderer.h>
+#include <Graphics/Camera.h>
 #include <Elos/Common/Assert.h>
+#include <cmath>
+#include <limits>
 
 namespace Prism::Gfx
 {
+	namespace
+	{
+		// Largest axis scale of a world matrix, bounds how much it can grow object space distances
+		f32 GetMaxScale(const Matrix& world) noexcept
+		{
+			return std::max({ Vector3(world._11, world._12, world._13).Length(),
+				Vector3(world._21, world._22, world._23).Length(),
+				Vector3(world._31, world._32, world._33).Length() });
+		}
+	}
+
 	Mesh::~Mesh() noexcept
 	{
 		m_vertexBuffer.reset();
 		m_indexBuffer.reset();
+		m_meshConstants.reset();
 	}
 	
-	void Mesh::Render(const Renderer& renderer) const noexcept
+	std::shared_ptr<Mesh> Mesh::CreateInstance() const
+	{
+		return std::shared_ptr<Mesh>(new Mesh(*this));
+	}
+
+	bool Mesh::Bind(const Renderer& renderer) const noexcept
 	{
 #if PRISM_BUILD_DEBUG
 		Elos::ASSERT_NOT_NULL(GetVertexBuffer());
@@ -19,16 +39,147 @@ namespace Prism::Gfx
 
 		if (!m_vertexBuffer || !m_indexBuffer)
 		{
-			return;
+			return false;
 		}
 
 		const u32 offset = 0;
 		const VertexBuffer* vb[] = { m_vertexBuffer.get() };
 
-		renderer.SetIndexBuffer(*m_indexBuffer);
+		renderer.SetIndexBuffer(*m_indexBuffer);  // Format comes from the buffer (R16 or R32)
 		renderer.SetVertexBuffers(0, std::span{vb}, std::span(&offset, 1));
 		renderer.SetPrimitiveTopology(m_topology);
 
-		renderer.DrawIndexed(m_indexBuffer->IndexCount, 0, 0);
+		if (m_meshConstants)
+		{
+			const Buffer* constantBuffers[] = { m_meshConstants.get() };
+			renderer.SetConstantBuffers(1, Shader::Type::Vertex, std::span{ constantBuffers });
+		}
+
+		return true;
+	}
+
+	void Mesh::Render(const Renderer& renderer, const u32 lod, const bool bind) const noexcept
+	{
+		if (!bind || Bind(renderer)) LIKELY
+		{
+			const Lod& range = GetLod(lod);
+			renderer.DrawIndexed(range.IndexCount, m_startIndex + range.IndexOffset, static_cast<i32>(m_baseVertex));
+		}
+	}
+
+	void Mesh::Render(const Renderer& renderer, const MeshletCullContext& cullContext, MeshletCullStats* stats, const u32 lod, const bool bind) const noexcept
+	{
+		if (GetMeshlets().empty() || (lod > 0 && GetLodCount() > 1))
+		{
+			if (stats && !m_lods.empty())
+			{
+				stats->TrianglesTotal     += GetLod(0).IndexCount / 3;
+				stats->TrianglesSubmitted += GetLod(lod).IndexCount / 3;
+			}
+
+			Render(renderer, lod, bind);
+			return;
+		}
+
+		if (bind && !Bind(renderer))
+		{
+			return;
+		}
+
+		// Meshlets are contiguous in the index buffer, so runs of visible meshlets become a single draw
+		u32 runStart = 0;
+		u32 runCount = 0;
+		u32 visibleMeshlets = 0;
+		u64 submittedIndices = 0;
+
+		for (const Meshlet& meshlet : GetMeshlets())
+		{
+			if (!cullContext.IsVisible(meshlet))
+			{
+				continue;
+			}
+
+			visibleMeshlets++;
+			submittedIndices += meshlet.IndexCount;
+
+			if (runCount > 0 && runStart + runCount == meshlet.IndexOffset)
+			{
+				runCount += meshlet.IndexCount;
+				continue;
+			}
+
+			if (runCount > 0)
+			{
+				renderer.DrawIndexed(runCount, m_startIndex + runStart, static_cast<i32>(m_baseVertex));
+			}
+
+			runStart = meshlet.IndexOffset;
+			runCount = meshlet.IndexCount;
+		}
+
+		if (runCount > 0)
+		{
+			renderer.DrawIndexed(runCount, m_startIndex + runStart, static_cast<i32>(m_baseVertex));
+		}
+
+		if (stats)
+		{
+			stats->MeshletsTotal      += static_cast<u32>(GetMeshlets().size());
+			stats->MeshletsVisible    += visibleMeshlets;
+			stats->TrianglesTotal     += GetLod(0).IndexCount / 3;
+			stats->TrianglesSubmitted += submittedIndices / 3;
+		}
+	}
+
+	f32 Mesh::GetPixelsPerUnit(const Camera& camera, const Matrix& world, const f32 viewportHeight) const noexcept
+	{
+		if (camera.GetProjectionType() == Camera::ProjectionType::Orthographic)
+		{
+			return viewportHeight / std::max(camera.GetOrthoHeight(), kEpsilon);
+		}
+
+		// Perspective divides by the distance to the closest point of the bounds
+		const Vector3 center = Vector3::Transform(Vector3(m_bounds.Sphere.Center), world);
+		const f32 distance = Vector3::Distance(center, camera.GetPosition()) - m_bounds.Sphere.Radius * GetMaxScale(world);
+		if (distance <= camera.GetNearPlane())
+		{
+			return std::numeric_limits<f32>::infinity();
+		}
+
+		const f32 halfFovTan = std::tan(DirectX::XMConvertToRadians(camera.GetFOV()) * 0.5f);
+		return viewportHeight / (2.0f * distance * halfFovTan);
+	}
+
+	f32 Mesh::GetProjectedSize(const Camera& camera, const Matrix& world, const f32 viewportHeight) const noexcept
+	{
+		return 2.0f * m_bounds.Sphere.Radius * GetMaxScale(world) * GetPixelsPerUnit(camera, world, viewportHeight);
+	}
+
+	u32 Mesh::SelectLod(const Camera& camera, const Matrix& world, const f32 viewportHeight, const f32 maxPixelError) const noexcept
+	{
+		if (m_lods.size() <= 1)
+		{
+			return 0;
+		}
+
+		// Errors are in object space, the largest axis scale bounds how much the world transform can grow them
+		const f32 scale = GetMaxScale(world);
+		const f32 pixelsPerUnit = GetPixelsPerUnit(camera, world, viewportHeight);
+		if (std::isinf(pixelsPerUnit))
+		{
+			return 0;
+		}
+
+		u32 selected = 0;
+		for (u32 lod = 1; lod < GetLodCount(); lod++)
+		{
+			if (m_lods[lod].Error * scale * pixelsPerUnit > maxPixelError)
+			{
+				break;
+			}
+			selected = lod;
+		}
+
+		return selected;
 	}
 }
\ No newline at end of file
@@ -1,16 +1,24 @@
 #pragma once
 #include "StandardTypes.h"
+#include "Math/Bounds.h"
 #include "Graphics/DX11Types.h"
 #include "Graphics/Resources/Buffers/VertexBuffer.h"
 #include "Graphics/Resources/Buffers/IndexBuffer.h"
-#include "Graphics/Resources/Texture2D.h"
+#include "Graphics/Resources/Buffers/ConstantBuffer.h"
+#include "Graphics/VertexFormats.h"
+#include "Graphics/Meshlet.h"
+#include "Graphics/Material.h"
 #include <Elos/Common/String.h>
 #include <Elos/Common/FunctionMacros.h>
+#include <algorithm>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace Prism::Gfx
 {
 	class Renderer;
+	class Camera;
 
 	class Mesh
 	{
@@ -22,6 +30,7 @@ namespace Prism::Gfx
 			{
 				CreateVertexBufferFailed,
 				CreateIndexBufferFailed,
+				CreateConstantBufferFailed,
 			};
 
 			Type Type;
@@ -29,31 +38,102 @@ namespace Prism::Gfx
 			Elos::String Message;
 		};
 
+		// Index range of one level of detail inside the mesh's index buffer, LOD 0 is the full detail mesh
+		struct Lod
+		{
+			u32 IndexOffset = 0;
+			u32 IndexCount  = 0;
+			f32 Error       = 0.0f;  // Object space geometric deviation from LOD 0
+		};
+
 		struct MeshDesc
 		{
 			D3D11_PRIMITIVE_TOPOLOGY Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 			u32 VertexStride                  = 0;
 			bool DynamicVB                    = false;
 			bool DynamicIB                    = false;
+			bool AllowShortIndices            = true;  // Use R16_UINT indices when the vertex count fits
+			VertexFormat Format               = VertexFormat::Standard;
+			PositionDequantization Dequantization;  // Only used by quantized formats
+			std::span<const Meshlet> Meshlets;      // Optional, copied into the mesh for CPU culling
+			std::span<const Lod> Lods;              // Optional, without it the whole index buffer is LOD 0
+			Prism::Bounds Bounds;                   // Object space
+		};
+
+		// Range of a vertex/index buffer pair shared by several meshes, see ResourceFactory::CreateMeshes
+		// Indices are relative to BaseVertex, so each range may use 16 bit indices on its own
+		struct SubmeshDesc
+		{
+			u32 BaseVertex  = 0;
+			u32 VertexCount = 0;
+			u32 StartIndex  = 0;
+			u32 IndexCount  = 0;
+			PositionDequantization Dequantization;  // Only used by quantized formats
+			std::span<const Meshlet> Meshlets;      // Index offsets relative to StartIndex
+			std::span<const Lod> Lods;              // Index offsets relative to StartIndex
+			Prism::Bounds Bounds;
 		};
 
 	public:
 		~Mesh() noexcept;
 
-		void Render(const Renderer& renderer) const noexcept;
+		// 'bind' can be cleared when the previous mesh drawn has the same bindings, see SharesBindingsWith
+		void Render(const Renderer& renderer, const u32 lod = 0, const bool bind = true) const noexcept;
+
+		// Draws only the meshlets that pass frustum and normal cone culling, merging adjacent ranges into one draw
+		// Falls back to a full draw for meshes without meshlets
+		// Meshlets only cover LOD 0, coarser LODs are drawn whole
+		void Render(const Renderer& renderer, const MeshletCullContext& cullContext, MeshletCullStats* stats = nullptr, const u32 lod = 0, const bool bind = true) const noexcept;
+
+		// New mesh sharing the vertex/index buffers, constants, material and culling data of this one
+		NODISCARD std::shared_ptr<Mesh> CreateInstance() const;
+
+		inline void SetMaterial(std::shared_ptr<Material> material) noexcept { m_material = std::move(material); }
+
+		// Pixels covered by one world unit at the closest point of the bounds, infinity when the camera is inside them
+		NODISCARD f32 GetPixelsPerUnit(const Camera& camera, const Matrix& world, const f32 viewportHeight) const noexcept;
+
+		// On screen diameter of the bounding sphere in pixels
+		NODISCARD f32 GetProjectedSize(const Camera& camera, const Matrix& world, const f32 viewportHeight) const noexcept;
+
+		// Picks the coarsest LOD whose projected error stays under maxPixelError
+		NODISCARD u32 SelectLod(const Camera& camera, const Matrix& world, const f32 viewportHeight, const f32 maxPixelError) const noexcept;
 
 		inline NODISCARD D3D11_PRIMITIVE_TOPOLOGY GetTopology() const noexcept { return m_topology; }
 		inline NODISCARD VertexBuffer* GetVertexBuffer() const noexcept { return m_vertexBuffer.get(); }
 		inline NODISCARD IndexBuffer* GetIndexBuffer() const noexcept { return m_indexBuffer.get(); }
-		inline NODISCARD Texture2D* GetTexture() const noexcept { return m_texture.get(); }
+		inline NODISCARD const std::shared_ptr<Material>& GetMaterial() const noexcept { return m_material; }
+		inline NODISCARD VertexFormat GetVertexFormat() const noexcept { return m_vertexFormat; }
+		inline NODISCARD std::span<const Meshlet> GetMeshlets() const noexcept { return m_meshlets ? std::span<const Meshlet>(*m_meshlets) : std::span<const Meshlet>(); }
+		inline NODISCARD u32 GetLodCount() const noexcept { return static_cast<u32>(m_lods.size()); }
+		inline NODISCARD const Lod& GetLod(const u32 lod) const noexcept { return m_lods[std::min(lod, GetLodCount() - 1)]; }
+		inline NODISCARD const Bounds& GetBounds() const noexcept { return m_bounds; }
+		inline NODISCARD u32 GetBaseVertex() const noexcept { return m_baseVertex; }
+		inline NODISCARD u32 GetStartIndex() const noexcept { return m_startIndex; }
+		inline NODISCARD bool SharesGeometryWith(const Mesh& other) const noexcept { return m_vertexBuffer == other.m_vertexBuffer && m_indexBuffer == other.m_indexBuffer; }
+
+		// True when drawing this mesh right after 'other' needs no buffer, topology or constant rebinding
+		inline NODISCARD bool SharesBindingsWith(const Mesh& other) const noexcept
+		{
+			return SharesGeometryWith(other) && m_topology == other.m_topology && m_meshConstants == other.m_meshConstants;
+		}
 
 	private:
 		Mesh() noexcept = default;
+		Mesh(const Mesh&) = default;
+		bool Bind(const Renderer& renderer) const noexcept;
 
 	private:
 		std::shared_ptr<VertexBuffer> m_vertexBuffer;
 		std::shared_ptr<IndexBuffer>  m_indexBuffer;
-		std::shared_ptr<Texture2D>    m_texture;
-		D3D11_PRIMITIVE_TOPOLOGY      m_topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+		std::shared_ptr<Material>     m_material;  // Optional, shared with instances
+		std::shared_ptr<ConstantBuffer<MeshConstants>> m_meshConstants;  // Set for formats that decode in the vertex shader
+		D3D11_PRIMITIVE_TOPOLOGY      m_topology     = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+		VertexFormat                  m_vertexFormat = VertexFormat::Standard;
+		std::shared_ptr<const std::vector<Meshlet>> m_meshlets;  // Shared with instances
+		std::vector<Lod>              m_lods;  // Never empty once created, LOD 0 spans the full detail indices
+		Bounds                        m_bounds;  // Object space
+		u32                           m_baseVertex = 0;  // Range inside buffers shared with other meshes
+		u32                           m_startIndex = 0;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "Graphics/Meshlet.h"
+#include "Graphics/Camera.h"
+
+namespace Prism::Gfx
+{
+	MeshletCullContext MeshletCullContext::Create(const Camera& camera, const Matrix& world)
+	{
+		MeshletCullContext context;
+
+		// Gribb/Hartmann plane extraction from the object to clip matrix (row vectors, D3D depth range [0, 1])
+		const Matrix m = world * camera.GetViewProjectionMatrix();
+		const Vector4 col1(m._11, m._21, m._31, m._41);
+		const Vector4 col2(m._12, m._22, m._32, m._42);
+		const Vector4 col3(m._13, m._23, m._33, m._43);
+		const Vector4 col4(m._14, m._24, m._34, m._44);
+
+		context.FrustumPlanes[0] = col4 + col1;  // Left
+		context.FrustumPlanes[1] = col4 - col1;  // Right
+		context.FrustumPlanes[2] = col4 + col2;  // Bottom
+		context.FrustumPlanes[3] = col4 - col2;  // Top
+		context.FrustumPlanes[4] = col3;         // Near
+		context.FrustumPlanes[5] = col4 - col3;  // Far
+
+		for (Vector4& plane : context.FrustumPlanes)
+		{
+			const f32 length = Vector3(plane.x, plane.y, plane.z).Length();
+			plane = length > kEpsilon ? plane / length : plane;
+		}
+
+		const Matrix invWorld = world.Invert();
+		context.CameraPosition = Vector3::Transform(camera.GetPosition(), invWorld);
+
+		// D3D treats clockwise triangles as front facing in clip space, mirrored transforms (right handed view,
+		// negative scale) flip that relative to the object space triangle normals
+		context.FrontFaceSign = m.Determinant() < 0.0f ? -1.0f : 1.0f;
+
+		// Cone culling assumes rays from a single eye point
+		context.CullBackfaces = camera.GetProjectionBlend() <= 0.0f;
+
+		return context;
+	}
+
+	bool MeshletCullContext::IsSphereVisible(const Vector3& center, const f32 radius) const noexcept
+	{
+		for (const Vector4& plane : FrustumPlanes)
+		{
+			const f32 distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+			if (distance < -radius)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool MeshletCullContext::IsVisible(const Meshlet& meshlet) const noexcept
+	{
+		if (!IsSphereVisible(meshlet.Center, meshlet.Radius))
+		{
+			return false;
+		}
+
+		if (CullBackfaces && meshlet.ConeCutoff < 1.0f)
+		{
+			// Sphere bounded cone test, ref: https://github.com/zeux/meshoptimizer (meshopt_computeMeshletBounds)
+			const Vector3 toCenter = meshlet.Center - CameraPosition;
+			const f32 distance = toCenter.Length();
+			if (FrontFaceSign * toCenter.Dot(meshlet.ConeAxis) >= meshlet.ConeCutoff * distance + meshlet.Radius)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
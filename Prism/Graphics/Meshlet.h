@@ -0,0 +1,45 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Math/Math.h"
+#include <Elos/Common/FunctionMacros.h>
+
+namespace Prism::Gfx
+{
+	class Camera;
+
+	// Small cluster of triangles stored as a contiguous range of its mesh's index buffer
+	// Bounds are in object space. Trivially copyable so it can be stored in the mesh cache as is
+	struct Meshlet
+	{
+		u32 IndexOffset = 0;
+		u32 IndexCount  = 0;
+		Vector3 Center;         // Bounding sphere
+		f32 Radius      = 0.0f;
+		Vector3 ConeAxis;       // Normal cone of cross(p1 - p0, p2 - p0), sine of its half angle in ConeCutoff
+		f32 ConeCutoff  = 1.0f; // 1.0 disables cone culling (normals spread too much)
+	};
+
+	// View data used to cull meshlets, expressed in the object space of the mesh being drawn
+	struct MeshletCullContext
+	{
+		Vector4 FrustumPlanes[6];  // Normalized, inside is dot(plane.xyz, p) + plane.w >= 0
+		Vector3 CameraPosition;
+		f32 FrontFaceSign  = 1.0f;  // Sign of the object to clip determinant, flips which side of the cone is front facing
+		bool CullBackfaces = true;  // Needs a perspective camera
+
+		static NODISCARD MeshletCullContext Create(const Camera& camera, const Matrix& world);
+
+		NODISCARD bool IsVisible(const Meshlet& meshlet) const noexcept;
+
+		// Frustum test only, for object space spheres such as whole mesh bounds
+		NODISCARD bool IsSphereVisible(const Vector3& center, const f32 radius) const noexcept;
+	};
+
+	struct MeshletCullStats
+	{
+		u32 MeshletsTotal      = 0;
+		u32 MeshletsVisible    = 0;
+		u64 TrianglesTotal     = 0;
+		u64 TrianglesSubmitted = 0;
+	};
+}
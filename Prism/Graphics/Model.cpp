@@ -1,20 +1,35 @@
 #include "Graphics/Model.h"
 #include "Graphics/Renderer.h"
+#include "Graphics/Camera.h"
 #include "Graphics/Utils/ResourceFactory.h"
-#include "Application/Globals.h"
+#include "Graphics/Utils/TextureStreamer.h"
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
 
 namespace Prism::Gfx
 {
 	Model::Model(const MeshImporter::MeshData& meshData)
 		: m_meshes(meshData.Meshes)
 		, m_textures(meshData.Textures)
+		, m_materials(meshData.Materials)
 		, m_textureMap(meshData.TextureMap)
-	{		
+		, m_importReport(meshData.Report)
+	{
+		for (const auto& mesh : m_meshes)
+		{
+			if (mesh)
+			{
+				m_localBounds = m_localBounds.Merge(mesh->GetBounds());
+			}
+		}
+		SortDrawOrder();
 	}
 	
 	Model::~Model()
 	{
 		m_meshes.clear();
+		m_materials.clear();
 		m_textures.clear();
 	}
 	
@@ -22,28 +37,113 @@ namespace Prism::Gfx
 	{
 		if (mesh)
 		{
+			m_localBounds = m_localBounds.Merge(mesh->GetBounds());
 			m_meshes.push_back(std::move(mesh));
+			SortDrawOrder();
 		}
 	}
 	
+	VertexFormat Model::GetVertexFormat() const noexcept
+	{
+		// All meshes of an imported model share the format chosen in the import settings
+		return m_meshes.empty() || !m_meshes.front() ? VertexFormat::Standard : m_meshes.front()->GetVertexFormat();
+	}
+
+	void Model::SortDrawOrder()
+	{
+		// Materials keep the order they first appear in, so the import order still decides which group draws first
+		std::unordered_map<const Material*, u32> materialRanks;
+		std::vector<u32> ranks(m_meshes.size(), 0);
+		for (size_t i = 0; i < m_meshes.size(); i++)
+		{
+			const Material* material = m_meshes[i] ? m_meshes[i]->GetMaterial().get() : nullptr;
+			ranks[i] = materialRanks.try_emplace(material, static_cast<u32>(materialRanks.size())).first->second;
+		}
+
+		m_drawOrder.resize(m_meshes.size());
+		std::iota(m_drawOrder.begin(), m_drawOrder.end(), 0u);
+		std::ranges::stable_sort(m_drawOrder, {}, [&ranks](const u32 mesh) { return ranks[mesh]; });
+	}
+
 	void Model::Render(const Renderer& renderer) const
 	{
-		for (const auto& mesh : m_meshes)
+		// Meshes packed into shared buffers are drawn back to back without rebinding them
+		const Mesh* previous = nullptr;
+		const Material* previousMaterial = nullptr;
+		const Material* defaultMaterial = renderer.GetResourceFactory().GetDefaultMaterial().get();
+		for (const u32 index : m_drawOrder)
 		{
-			if (!m_textures.empty())
+			const auto& mesh = m_meshes[index];
+			if (mesh) LIKELY
 			{
-				auto& texture = m_textures[Globals::g_textureNumber];
-				ID3D11ShaderResourceView* srvs[] = { texture->GetSRV() };
-				renderer.SetShaderResourceViews(Shader::Type::Pixel, 0, std::span{ srvs });
+				// Meshes without a material would otherwise draw with whatever the previous mesh left bound
+				const Material* material = mesh->GetMaterial() ? mesh->GetMaterial().get() : defaultMaterial;
+				if (material != previousMaterial)
+				{
+					material->Bind(renderer);
+					previousMaterial = material;
+				}
+
+				mesh->Render(renderer, 0, !previous || !mesh->SharesBindingsWith(*previous));
+				previous = mesh.get();
 			}
+		}
+	}
+	
+	MeshletCullStats Model::Render(const Renderer& renderer, const Camera& camera) const
+	{
+		MeshletCullStats stats;
+		const Matrix world = m_transform.GetWorldMatrix();
+		const MeshletCullContext cullContext = MeshletCullContext::Create(camera, world);
+		const f32 viewportHeight = static_cast<f32>(renderer.GetWindowSize().Height);
 
+		// Meshes packed into shared buffers are drawn back to back without rebinding them
+		const Mesh* previous = nullptr;
+		const Material* previousMaterial = nullptr;
+		const Material* defaultMaterial = renderer.GetResourceFactory().GetDefaultMaterial().get();
+		for (const u32 index : m_drawOrder)
+		{
+			const auto& mesh = m_meshes[index];
 			if (mesh) LIKELY
 			{
-				mesh->Render(renderer);
+				const Material* material = mesh->GetMaterial() ? mesh->GetMaterial().get() : defaultMaterial;
+				if (material != previousMaterial)
+				{
+					material->Bind(renderer);
+					previousMaterial = material;
+				}
+
+				const u32 lod = mesh->SelectLod(camera, world, viewportHeight, m_lodPixelError);
+				mesh->Render(renderer, cullContext, &stats, lod, !previous || !mesh->SharesBindingsWith(*previous));
+				previous = mesh.get();
 			}
 		}
+
+		return stats;
 	}
 	
+	void Model::RequestTextureMips(TextureStreamer& streamer, const Camera& camera, const f32 viewportHeight) const
+	{
+		const Matrix world = m_transform.GetWorldMatrix();
+		const MeshletCullContext cullContext = MeshletCullContext::Create(camera, world);
+
+		for (const auto& mesh : m_meshes)
+		{
+			const Texture2D* texture = mesh && mesh->GetMaterial() ? mesh->GetMaterial()->GetBaseColorTexture() : nullptr;
+			if (!texture)
+			{
+				continue;
+			}
+
+			// Meshes outside the view request nothing, their textures only keep detail while the budget allows
+			const Bounds& bounds = mesh->GetBounds();
+			if (cullContext.IsSphereVisible(Vector3(bounds.Sphere.Center), bounds.Sphere.Radius))
+			{
+				streamer.RequestScreenSize(texture, mesh->GetProjectedSize(camera, world, viewportHeight));
+			}
+		}
+	}
+
 	std::expected<std::shared_ptr<Model>, MeshImporter::ImportError>
 		Model::LoadFromFile(const ResourceFactory& resourceFactory, const fs::path& filePath,
 			const MeshImporter::ImportSettings& settings)
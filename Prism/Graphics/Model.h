@@ -9,6 +9,8 @@ namespace Prism::Gfx
 {
 	class Renderer;
 	class ResourceFactory;
+	class Camera;
+	class TextureStreamer;
 
 	class Model
 	{
@@ -19,17 +21,42 @@ namespace Prism::Gfx
 
 		NODISCARD inline Transform& GetTransform() { return m_transform; }
 		NODISCARD inline auto& GetTextures() { return m_textures; }
+		NODISCARD inline auto& GetMaterials() { return m_materials; }
+		NODISCARD VertexFormat GetVertexFormat() const noexcept;
+		NODISCARD inline f32 GetLodPixelError() const noexcept { return m_lodPixelError; }
+		NODISCARD inline const ImportReport& GetImportReport() const noexcept { return m_importReport; }
+
+		// Union of the mesh bounds in model space, and the same bounds moved by the current world matrix
+		NODISCARD inline const Bounds& GetLocalBounds() const noexcept { return m_localBounds; }
+		NODISCARD inline Bounds GetWorldBounds() const noexcept { return m_localBounds.Transform(m_transform.GetWorldMatrix()); }
+		inline void SetLodPixelError(const f32 pixels) noexcept { m_lodPixelError = pixels; }
 		
 		void AddMesh(std::shared_ptr<Mesh> mesh);
+
+		// Draws meshes grouped by material, binding each material once per group
+		// Meshes without a material draw with ResourceFactory::GetDefaultMaterial
 		void Render(const Renderer& renderer) const;
 
+		// Selects a LOD per mesh from its projected error, then culls the meshlets of full detail meshes
+		MeshletCullStats Render(const Renderer& renderer, const Camera& camera) const;
+
+		// Requests texture detail for the projected size of every mesh in the view, call before TextureStreamer::Update
+		void RequestTextureMips(TextureStreamer& streamer, const Camera& camera, const f32 viewportHeight) const;
+
 		static std::expected<std::shared_ptr<Model>, MeshImporter::ImportError> LoadFromFile(
 			const ResourceFactory& resourceFactory, const fs::path& filePath, const MeshImporter::ImportSettings& settings);
 
 	private:
+		void SortDrawOrder();
+
 		Transform                               m_transform;
 		std::vector<std::shared_ptr<Mesh>>      m_meshes;
+		std::vector<u32>                        m_drawOrder;  // Mesh indices stable sorted by material first appearance
 		std::vector<std::shared_ptr<Texture2D>> m_textures;
+		std::vector<std::shared_ptr<Material>>  m_materials;
 		std::unordered_map<Elos::String, u64>   m_textureMap;
+		f32                                     m_lodPixelError = 1.0f;  // Max on screen deviation allowed by LOD selection
+		ImportReport                            m_importReport;          // Empty for models not created by an import
+		Bounds                                  m_localBounds;
 	};
 }
\ No newline at end of file
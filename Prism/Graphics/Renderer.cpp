@@ -448,9 +448,9 @@ namespace Prism::Gfx
 		SetDepthStencilState(m_defaultDepthStencilState.Get(), 0);
 	}
 
-	void Renderer::SetIndexBuffer(const IndexBuffer& buffer, const DXGI_FORMAT format, const u32 offset) const noexcept
+	void Renderer::SetIndexBuffer(const IndexBuffer& buffer, const u32 offset) const noexcept
 	{
-		m_device->GetContext()->IASetIndexBuffer(buffer.GetBuffer(), format, offset);
+		m_device->GetContext()->IASetIndexBuffer(buffer.GetBuffer(), buffer.Format, offset);
 	}
 
 	void Renderer::SetVertexBuffers(const u32 startSlot, const std::span<const VertexBuffer* const>& buffers, std::span<const u32> offsets) const noexcept
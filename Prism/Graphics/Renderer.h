@@ -29,6 +29,7 @@ namespace Prism::Gfx
 
 		bool InitImGui();
 
+		NODISCARD ResourceFactory& GetResourceFactory() { return *m_resourceFactory; }
 		NODISCARD const ResourceFactory& GetResourceFactory() const { return *m_resourceFactory; }
 		NODISCARD bool IsGraphicsDebuggerAttached() const;
 		void BeginEvent(const Elos::WString& eventName) const;
@@ -57,7 +58,7 @@ namespace Prism::Gfx
 		void SetShaderResourceViews(const Shader::Type shaderType, const u32 slot, std::span<ID3D11ShaderResourceView* const> views) const;
 		void SetSolidRenderState() const;
 		void SetWireframeRenderState() const;
-		void SetIndexBuffer(const IndexBuffer& buffer, const DXGI_FORMAT format = DXGI_FORMAT_R32_UINT, const u32 offset = 0) const noexcept;
+		void SetIndexBuffer(const IndexBuffer& buffer, const u32 offset = 0) const noexcept;
 		void SetVertexBuffers(const u32 startSlot, const std::span<const VertexBuffer* const>& buffers, std::span<const u32> offsets) const noexcept;
 		void SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY topology) const noexcept;
 
@@ -65,6 +66,7 @@ namespace Prism::Gfx
 		std::expected<void, Buffer::BufferError> UpdateConstantBuffer(ConstantBuffer<T>& constantBuffer, const T& data) const { return constantBuffer.Update(m_device->GetContext(), data); }
 
 		NODISCARD inline Core::Device* GetDevice() const noexcept { return m_device.get(); }
+		NODISCARD inline Elos::WindowSize GetWindowSize() const noexcept { return m_window.GetSize(); }
 
 	private:
 		void CreateDevice(const Core::Device::DeviceDesc& deviceDesc);
@@ -8,7 +8,10 @@ namespace Prism::Gfx
 	public:
 		explicit IndexBuffer(bool isDynamic) : Buffer(isDynamic) {}
 
+		NODISCARD inline u32 GetIndexSize() const noexcept { return Format == DXGI_FORMAT_R16_UINT ? sizeof(u16) : sizeof(u32); }
+
 	public:
-		u32 IndexCount = 0;
+		u32 IndexCount     = 0;
+		DXGI_FORMAT Format = DXGI_FORMAT_R32_UINT;  // R16_UINT or R32_UINT
 	};
 }
\ No newline at end of file
@@ -72,10 +72,39 @@ namespace Prism::Gfx
 		m_texture->GetDesc1(&desc);
 
 		D3D11_SHADER_RESOURCE_VIEW_DESC1 srvDesc{};
-		srvDesc.Format                    = desc.Format;
-		srvDesc.ViewDimension             = D3D11_SRV_DIMENSION_TEXTURE2D;
-		srvDesc.Texture2D.MostDetailedMip = 0;
-		srvDesc.Texture2D.MipLevels       = desc.MipLevels;
+		srvDesc.Format = desc.Format;
+		if (desc.MiscFlags & D3D11_RESOURCE_MISC_TEXTURECUBE)
+		{
+			if (desc.ArraySize > 6)
+			{
+				srvDesc.ViewDimension                     = D3D11_SRV_DIMENSION_TEXTURECUBEARRAY;
+				srvDesc.TextureCubeArray.MostDetailedMip  = 0;
+				srvDesc.TextureCubeArray.MipLevels        = desc.MipLevels;
+				srvDesc.TextureCubeArray.First2DArrayFace = 0;
+				srvDesc.TextureCubeArray.NumCubes         = desc.ArraySize / 6;
+			}
+			else
+			{
+				srvDesc.ViewDimension               = D3D11_SRV_DIMENSION_TEXTURECUBE;
+				srvDesc.TextureCube.MostDetailedMip = 0;
+				srvDesc.TextureCube.MipLevels       = desc.MipLevels;
+			}
+		}
+		else if (desc.ArraySize > 1)
+		{
+			srvDesc.ViewDimension                  = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+			srvDesc.Texture2DArray.MostDetailedMip = 0;
+			srvDesc.Texture2DArray.MipLevels       = desc.MipLevels;
+			srvDesc.Texture2DArray.FirstArraySlice = 0;
+			srvDesc.Texture2DArray.ArraySize       = desc.ArraySize;
+			srvDesc.Texture2DArray.PlaneSlice      = 0;
+		}
+		else
+		{
+			srvDesc.ViewDimension             = D3D11_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Texture2D.MostDetailedMip = 0;
+			srvDesc.Texture2D.MipLevels       = desc.MipLevels;
+		}
 
 		return device->CreateShaderResourceView1(m_texture.Get(), &srvDesc, &m_srv);
 	}
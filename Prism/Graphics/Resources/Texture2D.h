@@ -17,7 +17,8 @@ namespace Prism::Gfx
 			{
 				CreateTextureFailed,
 				CreateShaderResourceViewFailed,
-				InvalidDimensions
+				InvalidDimensions,
+				DecodeFailed
 			};
 
 			Type Type;
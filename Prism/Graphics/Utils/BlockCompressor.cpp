@@ -0,0 +1,802 @@
+#include "Graphics/Utils/BlockCompressor.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <execution>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		constexpr u32 ParallelBlockThreshold = 256;
+		constexpr u32 ParallelBlockRows      = 8;  // Block rows per tile
+		constexpr u32 PowerIterations        = 8;
+		constexpr u32 RefineIterations       = 2;
+
+		// Weights of the 4 bit BC7 index palette, out of 64
+		constexpr std::array<i32, 16> Bc7Weights = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+		using Texel       = std::array<u8, 4>;
+		using BlockTexels = std::array<Texel, 16>;
+
+		template <u32 N>
+		using Point = std::array<f32, N>;
+
+		class BitWriter
+		{
+		public:
+			explicit BitWriter(byte* out) noexcept : m_out(out) { std::memset(out, 0, 16); }
+
+			void Write(const u32 value, const u32 bitCount) noexcept
+			{
+				for (u32 bit = 0; bit < bitCount; bit++, m_position++)
+				{
+					if ((value >> bit) & 1u)
+					{
+						m_out[m_position >> 3] |= static_cast<byte>(1u << (m_position & 7));
+					}
+				}
+			}
+
+		private:
+			byte* m_out;
+			u32   m_position = 0;
+		};
+
+		class BitReader
+		{
+		public:
+			explicit BitReader(const byte* in) noexcept : m_in(in) {}
+
+			u32 Read(const u32 bitCount) noexcept
+			{
+				u32 value = 0;
+				for (u32 bit = 0; bit < bitCount; bit++, m_position++)
+				{
+					value |= ((static_cast<u32>(m_in[m_position >> 3]) >> (m_position & 7)) & 1u) << bit;
+				}
+				return value;
+			}
+
+		private:
+			const byte* m_in;
+			u32         m_position = 0;
+		};
+
+		BlockTexels LoadBlock(const byte* rgba, const u32 width, const u32 height, const u32 blockX, const u32 blockY) noexcept
+		{
+			BlockTexels block;
+			for (u32 y = 0; y < 4; y++)
+			{
+				const u32 sourceY = std::min(blockY * 4 + y, height - 1);
+				for (u32 x = 0; x < 4; x++)
+				{
+					const u32 sourceX = std::min(blockX * 4 + x, width - 1);
+					std::memcpy(block[y * 4 + x].data(), rgba + (size_t{ sourceY } * width + sourceX) * 4, 4);
+				}
+			}
+			return block;
+		}
+
+		void StoreBlock(const BlockTexels& block, const u32 width, const u32 height, const u32 blockX, const u32 blockY, byte* rgba) noexcept
+		{
+			for (u32 y = 0; y < 4 && blockY * 4 + y < height; y++)
+			{
+				for (u32 x = 0; x < 4 && blockX * 4 + x < width; x++)
+				{
+					std::memcpy(rgba + (size_t{ blockY * 4 + y } * width + blockX * 4 + x) * 4, block[y * 4 + x].data(), 4);
+				}
+			}
+		}
+
+		// Principal axis of the points by power iteration on their covariance, zero for a uniform block
+		template <u32 N>
+		Point<N> PrincipalAxis(const std::array<Point<N>, 16>& points, const Point<N>& mean) noexcept
+		{
+			f32 covariance[N][N]{};
+			for (const Point<N>& point : points)
+			{
+				for (u32 i = 0; i < N; i++)
+				{
+					for (u32 j = 0; j < N; j++)
+					{
+						covariance[i][j] += (point[i] - mean[i]) * (point[j] - mean[j]);
+					}
+				}
+			}
+
+			// Start from the row of the largest variance, it cannot be orthogonal to the principal axis
+			u32 start = 0;
+			for (u32 i = 1; i < N; i++)
+			{
+				start = covariance[i][i] > covariance[start][start] ? i : start;
+			}
+
+			Point<N> axis;
+			for (u32 i = 0; i < N; i++)
+			{
+				axis[i] = covariance[start][i];
+			}
+
+			for (u32 iteration = 0; iteration < PowerIterations; iteration++)
+			{
+				Point<N> next{};
+				f32 largest = 0.0f;
+				for (u32 i = 0; i < N; i++)
+				{
+					for (u32 j = 0; j < N; j++)
+					{
+						next[i] += covariance[i][j] * axis[j];
+					}
+					largest = std::max(largest, std::abs(next[i]));
+				}
+
+				if (largest == 0.0f)
+				{
+					return Point<N>{};
+				}
+
+				for (u32 i = 0; i < N; i++)
+				{
+					axis[i] = next[i] / largest;
+				}
+			}
+			return axis;
+		}
+
+		// Endpoints at the two texels furthest apart along the principal axis
+		template <u32 N>
+		void InitialEndpoints(const std::array<Point<N>, 16>& points, Point<N>& outHigh, Point<N>& outLow) noexcept
+		{
+			Point<N> mean{};
+			for (const Point<N>& point : points)
+			{
+				for (u32 i = 0; i < N; i++)
+				{
+					mean[i] += point[i] / 16.0f;
+				}
+			}
+
+			const Point<N> axis = PrincipalAxis<N>(points, mean);
+			f32 lowest  = std::numeric_limits<f32>::max();
+			f32 highest = std::numeric_limits<f32>::lowest();
+			outHigh = mean;
+			outLow  = mean;
+			for (const Point<N>& point : points)
+			{
+				f32 t = 0.0f;
+				for (u32 i = 0; i < N; i++)
+				{
+					t += (point[i] - mean[i]) * axis[i];
+				}
+
+				if (t > highest)
+				{
+					highest = t;
+					outHigh = point;
+				}
+				if (t < lowest)
+				{
+					lowest = t;
+					outLow = point;
+				}
+			}
+		}
+
+		// Least squares endpoints for fixed indices, weights[i] is how much texel i takes from the high endpoint
+		template <u32 N>
+		bool SolveEndpoints(const std::array<Point<N>, 16>& points, const std::array<f32, 16>& weights, Point<N>& outHigh, Point<N>& outLow) noexcept
+		{
+			f32 aa = 0.0f, ab = 0.0f, bb = 0.0f;
+			Point<N> ax{}, bx{};
+			for (u32 t = 0; t < 16; t++)
+			{
+				const f32 a = weights[t];
+				const f32 b = 1.0f - a;
+				aa += a * a;
+				ab += a * b;
+				bb += b * b;
+				for (u32 i = 0; i < N; i++)
+				{
+					ax[i] += a * points[t][i];
+					bx[i] += b * points[t][i];
+				}
+			}
+
+			const f32 determinant = aa * bb - ab * ab;
+			if (std::abs(determinant) < 1e-6f)
+			{
+				return false;
+			}
+
+			for (u32 i = 0; i < N; i++)
+			{
+				outHigh[i] = std::clamp((bb * ax[i] - ab * bx[i]) / determinant, 0.0f, 255.0f);
+				outLow[i]  = std::clamp((aa * bx[i] - ab * ax[i]) / determinant, 0.0f, 255.0f);
+			}
+			return true;
+		}
+
+		// BC1 color block ----------------------------------------------------------------------------------------------------
+
+		struct ColorBlock
+		{
+			u64 Error   = std::numeric_limits<u64>::max();
+			u16 Color0  = 0;
+			u16 Color1  = 0;
+			u32 Indices = 0;
+		};
+
+		inline u16 QuantizeRgb565(const Point<3>& color) noexcept
+		{
+			const u32 r = static_cast<u32>(std::clamp(std::lround(color[0] * 31.0f / 255.0f), 0l, 31l));
+			const u32 g = static_cast<u32>(std::clamp(std::lround(color[1] * 63.0f / 255.0f), 0l, 63l));
+			const u32 b = static_cast<u32>(std::clamp(std::lround(color[2] * 31.0f / 255.0f), 0l, 31l));
+			return static_cast<u16>((r << 11) | (g << 5) | b);
+		}
+
+		inline std::array<i32, 3> ExpandRgb565(const u16 color) noexcept
+		{
+			const i32 r = (color >> 11) & 31;
+			const i32 g = (color >> 5) & 63;
+			const i32 b = color & 31;
+			return { (r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2) };
+		}
+
+		// Four color mode when color0 > color1 (always for BC3), otherwise three colors and transparent black
+		std::array<Texel, 4> BuildColorPalette(const u16 color0, const u16 color1, const bool forceFourColors) noexcept
+		{
+			const std::array<i32, 3> a = ExpandRgb565(color0);
+			const std::array<i32, 3> b = ExpandRgb565(color1);
+			const bool fourColors = forceFourColors || color0 > color1;
+
+			std::array<Texel, 4> palette{};
+			for (u32 c = 0; c < 3; c++)
+			{
+				palette[0][c] = static_cast<u8>(a[c]);
+				palette[1][c] = static_cast<u8>(b[c]);
+				palette[2][c] = static_cast<u8>(fourColors ? (2 * a[c] + b[c]) / 3 : (a[c] + b[c]) / 2);
+				palette[3][c] = static_cast<u8>(fourColors ? (a[c] + 2 * b[c]) / 3 : 0);
+			}
+			palette[0][3] = palette[1][3] = palette[2][3] = 255;
+			palette[3][3] = fourColors ? 255 : 0;
+			return palette;
+		}
+
+		ColorBlock EvaluateColorBlock(const BlockTexels& block, const Point<3>& high, const Point<3>& low) noexcept
+		{
+			ColorBlock result;
+			result.Color0 = QuantizeRgb565(high);
+			result.Color1 = QuantizeRgb565(low);
+			if (result.Color0 < result.Color1)
+			{
+				std::swap(result.Color0, result.Color1);
+			}
+
+			// Equal endpoints decode in three color mode, where index 3 is transparent
+			const std::array<Texel, 4> palette = BuildColorPalette(result.Color0, result.Color1, false);
+			const u32 paletteSize = result.Color0 > result.Color1 ? 4 : 3;
+
+			result.Error = 0;
+			for (u32 t = 0; t < 16; t++)
+			{
+				u32 bestIndex = 0;
+				u32 bestError = std::numeric_limits<u32>::max();
+				for (u32 k = 0; k < paletteSize; k++)
+				{
+					u32 error = 0;
+					for (u32 c = 0; c < 3; c++)
+					{
+						const i32 d = static_cast<i32>(block[t][c]) - palette[k][c];
+						error += static_cast<u32>(d * d);
+					}
+					if (error < bestError)
+					{
+						bestError = error;
+						bestIndex = k;
+					}
+				}
+				result.Indices |= bestIndex << (t * 2);
+				result.Error   += bestError;
+			}
+			return result;
+		}
+
+		void EncodeColorBlock(const BlockTexels& block, byte* out) noexcept
+		{
+			std::array<Point<3>, 16> points;
+			for (u32 t = 0; t < 16; t++)
+			{
+				points[t] = { static_cast<f32>(block[t][0]), static_cast<f32>(block[t][1]), static_cast<f32>(block[t][2]) };
+			}
+
+			Point<3> high, low;
+			InitialEndpoints<3>(points, high, low);
+			ColorBlock best = EvaluateColorBlock(block, high, low);
+
+			static constexpr f32 HighWeights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+			for (u32 iteration = 0; iteration < RefineIterations && best.Error > 0 && best.Color0 > best.Color1; iteration++)
+			{
+				std::array<f32, 16> weights;
+				for (u32 t = 0; t < 16; t++)
+				{
+					weights[t] = HighWeights[(best.Indices >> (t * 2)) & 3u];
+				}
+
+				if (!SolveEndpoints<3>(points, weights, high, low))
+				{
+					break;
+				}
+
+				const ColorBlock candidate = EvaluateColorBlock(block, high, low);
+				if (candidate.Error >= best.Error)
+				{
+					break;
+				}
+				best = candidate;
+			}
+
+			std::memcpy(out, &best.Color0, 2);
+			std::memcpy(out + 2, &best.Color1, 2);
+			std::memcpy(out + 4, &best.Indices, 4);
+		}
+
+		void DecodeColorBlock(const byte* in, BlockTexels& block, const bool forceFourColors) noexcept
+		{
+			u16 color0, color1;
+			u32 indices;
+			std::memcpy(&color0, in, 2);
+			std::memcpy(&color1, in + 2, 2);
+			std::memcpy(&indices, in + 4, 4);
+
+			const std::array<Texel, 4> palette = BuildColorPalette(color0, color1, forceFourColors);
+			for (u32 t = 0; t < 16; t++)
+			{
+				block[t] = palette[(indices >> (t * 2)) & 3u];
+			}
+		}
+
+		// BC4 single channel block, alpha of BC3 and each channel of BC5 -------------------------------------------------------
+
+		std::array<u8, 8> BuildChannelPalette(const u8 value0, const u8 value1) noexcept
+		{
+			std::array<u8, 8> palette{ value0, value1 };
+			if (value0 > value1)
+			{
+				for (u32 i = 2; i < 8; i++)
+				{
+					palette[i] = static_cast<u8>(((8 - i) * value0 + (i - 1) * value1) / 7);
+				}
+			}
+			else
+			{
+				for (u32 i = 2; i < 6; i++)
+				{
+					palette[i] = static_cast<u8>(((6 - i) * value0 + (i - 1) * value1) / 5);
+				}
+				palette[6] = 0;
+				palette[7] = 255;
+			}
+			return palette;
+		}
+
+		u32 EvaluateChannelBlock(const std::array<u8, 16>& values, const u8 value0, const u8 value1, u64& outIndices) noexcept
+		{
+			const std::array<u8, 8> palette = BuildChannelPalette(value0, value1);
+
+			u32 totalError = 0;
+			outIndices = 0;
+			for (u32 t = 0; t < 16; t++)
+			{
+				u32 bestIndex = 0;
+				u32 bestError = std::numeric_limits<u32>::max();
+				for (u32 k = 0; k < 8; k++)
+				{
+					const i32 d = static_cast<i32>(values[t]) - palette[k];
+					if (static_cast<u32>(d * d) < bestError)
+					{
+						bestError = static_cast<u32>(d * d);
+						bestIndex = k;
+					}
+				}
+				outIndices |= u64{ bestIndex } << (t * 3);
+				totalError += bestError;
+			}
+			return totalError;
+		}
+
+		void EncodeChannelBlock(const std::array<u8, 16>& values, byte* out) noexcept
+		{
+			const auto [lowest, highest] = std::ranges::minmax(values);
+
+			// Eight interpolated values between the extremes
+			u8 value0 = highest;
+			u8 value1 = lowest;
+			u64 indices = 0;
+			u32 error = highest > lowest ? EvaluateChannelBlock(values, highest, lowest, indices) : 0;
+
+			// Six interpolated values plus exact 0 and 255, better when the block mixes extremes with a narrow range
+			if (error > 0)
+			{
+				u8 innerLow  = 255;
+				u8 innerHigh = 0;
+				for (const u8 value : values)
+				{
+					if (value != 0 && value != 255)
+					{
+						innerLow  = std::min(innerLow, value);
+						innerHigh = std::max(innerHigh, value);
+					}
+				}
+				if (innerLow > innerHigh)
+				{
+					innerLow = innerHigh = 0;
+				}
+
+				u64 innerIndices = 0;
+				const u32 innerError = EvaluateChannelBlock(values, innerLow, innerHigh, innerIndices);
+				if (innerError < error)
+				{
+					value0  = innerLow;
+					value1  = innerHigh;
+					indices = innerIndices;
+				}
+			}
+
+			out[0] = static_cast<byte>(value0);
+			out[1] = static_cast<byte>(value1);
+			for (u32 i = 0; i < 6; i++)
+			{
+				out[2 + i] = static_cast<byte>((indices >> (i * 8)) & 0xFFu);
+			}
+		}
+
+		void DecodeChannelBlock(const byte* in, BlockTexels& block, const u32 channel) noexcept
+		{
+			const std::array<u8, 8> palette = BuildChannelPalette(static_cast<u8>(in[0]), static_cast<u8>(in[1]));
+
+			u64 indices = 0;
+			for (u32 i = 0; i < 6; i++)
+			{
+				indices |= u64{ static_cast<u8>(in[2 + i]) } << (i * 8);
+			}
+
+			for (u32 t = 0; t < 16; t++)
+			{
+				block[t][channel] = palette[(indices >> (t * 3)) & 7u];
+			}
+		}
+
+		// BC7 mode 6 -----------------------------------------------------------------------------------------------------------
+
+		struct Bc7Block
+		{
+			u64 Error = std::numeric_limits<u64>::max();
+			std::array<std::array<u8, 4>, 2> Endpoints{};  // 7 bit values
+			std::array<u8, 2> PBits{};
+			std::array<u8, 16> Indices{};
+		};
+
+		inline i32 Bc7Interpolate(const i32 e0, const i32 e1, const i32 weight) noexcept
+		{
+			return ((64 - weight) * e0 + weight * e1 + 32) >> 6;
+		}
+
+		Bc7Block EvaluateBc7Block(const BlockTexels& block, const Point<4>& low, const Point<4>& high) noexcept
+		{
+			Bc7Block best;
+
+			// Each endpoint shares one low bit across its channels, try all four combinations
+			for (u32 pBits = 0; pBits < 4; pBits++)
+			{
+				Bc7Block candidate;
+				candidate.PBits = { static_cast<u8>(pBits & 1u), static_cast<u8>(pBits >> 1) };
+
+				std::array<std::array<i32, 4>, 2> decoded;
+				for (u32 c = 0; c < 4; c++)
+				{
+					for (u32 e = 0; e < 2; e++)
+					{
+						const f32 value = e == 0 ? low[c] : high[c];
+						const i32 q = std::clamp(static_cast<i32>(std::lround((value - candidate.PBits[e]) / 2.0f)), 0, 127);
+						candidate.Endpoints[e][c] = static_cast<u8>(q);
+						decoded[e][c] = (q << 1) | candidate.PBits[e];
+					}
+				}
+
+				std::array<Texel, 16> palette;
+				for (u32 k = 0; k < 16; k++)
+				{
+					for (u32 c = 0; c < 4; c++)
+					{
+						palette[k][c] = static_cast<u8>(Bc7Interpolate(decoded[0][c], decoded[1][c], Bc7Weights[k]));
+					}
+				}
+
+				// Project onto the endpoint segment, then settle on the closest of the neighboring palette entries
+				std::array<i32, 4> direction;
+				i32 lengthSquared = 0;
+				for (u32 c = 0; c < 4; c++)
+				{
+					direction[c] = decoded[1][c] - decoded[0][c];
+					lengthSquared += direction[c] * direction[c];
+				}
+
+				candidate.Error = 0;
+				for (u32 t = 0; t < 16; t++)
+				{
+					i32 projection = 0;
+					for (u32 c = 0; c < 4; c++)
+					{
+						projection += (static_cast<i32>(block[t][c]) - decoded[0][c]) * direction[c];
+					}
+
+					const i32 guess = lengthSquared > 0
+						? std::clamp(static_cast<i32>(std::lround(15.0f * static_cast<f32>(projection) / static_cast<f32>(lengthSquared))), 0, 15)
+						: 0;
+
+					u32 bestError = std::numeric_limits<u32>::max();
+					for (i32 k = std::max(guess - 1, 0); k <= std::min(guess + 1, 15); k++)
+					{
+						u32 error = 0;
+						for (u32 c = 0; c < 4; c++)
+						{
+							const i32 d = static_cast<i32>(block[t][c]) - palette[k][c];
+							error += static_cast<u32>(d * d);
+						}
+						if (error < bestError)
+						{
+							bestError = error;
+							candidate.Indices[t] = static_cast<u8>(k);
+						}
+					}
+					candidate.Error += bestError;
+				}
+
+				if (candidate.Error < best.Error)
+				{
+					best = candidate;
+				}
+			}
+			return best;
+		}
+
+		void EncodeBc7Block(const BlockTexels& block, byte* out) noexcept
+		{
+			std::array<Point<4>, 16> points;
+			for (u32 t = 0; t < 16; t++)
+			{
+				for (u32 c = 0; c < 4; c++)
+				{
+					points[t][c] = static_cast<f32>(block[t][c]);
+				}
+			}
+
+			Point<4> high, low;
+			InitialEndpoints<4>(points, high, low);
+			Bc7Block best = EvaluateBc7Block(block, low, high);
+
+			for (u32 iteration = 0; iteration < RefineIterations && best.Error > 0; iteration++)
+			{
+				std::array<f32, 16> weights;
+				for (u32 t = 0; t < 16; t++)
+				{
+					weights[t] = static_cast<f32>(Bc7Weights[best.Indices[t]]) / 64.0f;
+				}
+
+				if (!SolveEndpoints<4>(points, weights, high, low))
+				{
+					break;
+				}
+
+				const Bc7Block candidate = EvaluateBc7Block(block, low, high);
+				if (candidate.Error >= best.Error)
+				{
+					break;
+				}
+				best = candidate;
+			}
+
+			// The anchor index drops its top bit, so texel 0 must use the lower half of the palette
+			if (best.Indices[0] >= 8)
+			{
+				std::swap(best.Endpoints[0], best.Endpoints[1]);
+				std::swap(best.PBits[0], best.PBits[1]);
+				for (u8& index : best.Indices)
+				{
+					index = static_cast<u8>(15 - index);
+				}
+			}
+
+			BitWriter writer(out);
+			writer.Write(1u << 6, 7);
+			for (u32 c = 0; c < 4; c++)
+			{
+				writer.Write(best.Endpoints[0][c], 7);
+				writer.Write(best.Endpoints[1][c], 7);
+			}
+			writer.Write(best.PBits[0], 1);
+			writer.Write(best.PBits[1], 1);
+			writer.Write(best.Indices[0], 3);
+			for (u32 t = 1; t < 16; t++)
+			{
+				writer.Write(best.Indices[t], 4);
+			}
+		}
+
+		void DecodeBc7Block(const byte* in, BlockTexels& block) noexcept
+		{
+			BitReader reader(in);
+			if (reader.Read(7) != (1u << 6))
+			{
+				block = {};
+				return;
+			}
+
+			std::array<std::array<i32, 4>, 2> decoded;
+			for (u32 c = 0; c < 4; c++)
+			{
+				decoded[0][c] = static_cast<i32>(reader.Read(7)) << 1;
+				decoded[1][c] = static_cast<i32>(reader.Read(7)) << 1;
+			}
+
+			const u32 p0 = reader.Read(1);
+			const u32 p1 = reader.Read(1);
+			for (u32 c = 0; c < 4; c++)
+			{
+				decoded[0][c] |= static_cast<i32>(p0);
+				decoded[1][c] |= static_cast<i32>(p1);
+			}
+
+			for (u32 t = 0; t < 16; t++)
+			{
+				const u32 index = reader.Read(t == 0 ? 3 : 4);
+				for (u32 c = 0; c < 4; c++)
+				{
+					block[t][c] = static_cast<u8>(Bc7Interpolate(decoded[0][c], decoded[1][c], Bc7Weights[index]));
+				}
+			}
+		}
+
+		std::array<u8, 16> ExtractChannel(const BlockTexels& block, const u32 channel) noexcept
+		{
+			std::array<u8, 16> values;
+			for (u32 t = 0; t < 16; t++)
+			{
+				values[t] = block[t][channel];
+			}
+			return values;
+		}
+
+		void EncodeBlock(const BlockTexels& block, const BlockFormat format, byte* out) noexcept
+		{
+			switch (format)
+			{
+			case BlockFormat::BC1:
+				EncodeColorBlock(block, out);
+				break;
+			case BlockFormat::BC3:
+				EncodeChannelBlock(ExtractChannel(block, 3), out);
+				EncodeColorBlock(block, out + 8);
+				break;
+			case BlockFormat::BC5:
+				EncodeChannelBlock(ExtractChannel(block, 0), out);
+				EncodeChannelBlock(ExtractChannel(block, 1), out + 8);
+				break;
+			case BlockFormat::BC7:
+				EncodeBc7Block(block, out);
+				break;
+			}
+		}
+
+		void DecodeBlock(const byte* in, const BlockFormat format, BlockTexels& block) noexcept
+		{
+			switch (format)
+			{
+			case BlockFormat::BC1:
+				DecodeColorBlock(in, block, false);
+				break;
+			case BlockFormat::BC3:
+				DecodeColorBlock(in + 8, block, true);
+				DecodeChannelBlock(in, block, 3);
+				break;
+			case BlockFormat::BC5:
+				block.fill(Texel{ 0, 0, 0, 255 });
+				DecodeChannelBlock(in, block, 0);
+				DecodeChannelBlock(in + 8, block, 1);
+				break;
+			case BlockFormat::BC7:
+				DecodeBc7Block(in, block);
+				break;
+			}
+		}
+	}
+
+	DXGI_FORMAT GetDxgiFormat(const BlockFormat format) noexcept
+	{
+		switch (format)
+		{
+		case BlockFormat::BC1: return DXGI_FORMAT_BC1_UNORM;
+		case BlockFormat::BC3: return DXGI_FORMAT_BC3_UNORM;
+		case BlockFormat::BC5: return DXGI_FORMAT_BC5_UNORM;
+		case BlockFormat::BC7: return DXGI_FORMAT_BC7_UNORM;
+		}
+		return DXGI_FORMAT_UNKNOWN;
+	}
+
+	void CompressImage(const byte* rgba, const u32 width, const u32 height, const BlockFormat format, byte* blocks, const bool parallel)
+	{
+		const u32 blocksX    = (width + 3) / 4;
+		const u32 blocksY    = (height + 3) / 4;
+		const u32 blockBytes = format == BlockFormat::BC1 ? 8 : 16;
+
+		const auto encodeRows = [&](const u32 firstRow, const u32 rowCount)
+		{
+			for (u32 blockY = firstRow; blockY < firstRow + rowCount; blockY++)
+			{
+				for (u32 blockX = 0; blockX < blocksX; blockX++)
+				{
+					const BlockTexels block = LoadBlock(rgba, width, height, blockX, blockY);
+					EncodeBlock(block, format, blocks + (size_t{ blockY } * blocksX + blockX) * blockBytes);
+				}
+			}
+		};
+
+		if (!parallel || blocksX * blocksY < ParallelBlockThreshold)
+		{
+			encodeRows(0, blocksY);
+			return;
+		}
+
+		// Blocks are independent, each tile writes its own run of the output
+		std::vector<u32> tiles((blocksY + ParallelBlockRows - 1) / ParallelBlockRows);
+		std::iota(tiles.begin(), tiles.end(), 0u);
+		std::for_each(std::execution::par, tiles.begin(), tiles.end(), [&](const u32 tile)
+		{
+			const u32 firstRow = tile * ParallelBlockRows;
+			encodeRows(firstRow, std::min(ParallelBlockRows, blocksY - firstRow));
+		});
+	}
+
+	void DecompressImage(const byte* blocks, const u32 width, const u32 height, const BlockFormat format, byte* rgba)
+	{
+		const u32 blocksX    = (width + 3) / 4;
+		const u32 blocksY    = (height + 3) / 4;
+		const u32 blockBytes = format == BlockFormat::BC1 ? 8 : 16;
+
+		for (u32 blockY = 0; blockY < blocksY; blockY++)
+		{
+			for (u32 blockX = 0; blockX < blocksX; blockX++)
+			{
+				BlockTexels block;
+				DecodeBlock(blocks + (size_t{ blockY } * blocksX + blockX) * blockBytes, format, block);
+				StoreBlock(block, width, height, blockX, blockY, rgba);
+			}
+		}
+	}
+
+	f64 ComputePsnr(const byte* reference, const byte* test, const u32 width, const u32 height, const u32 channelCount) noexcept
+	{
+		u64 squaredError = 0;
+		for (size_t texel = 0; texel < size_t{ width } * height; texel++)
+		{
+			for (u32 c = 0; c < channelCount; c++)
+			{
+				const i32 d = static_cast<i32>(reference[texel * 4 + c]) - static_cast<i32>(test[texel * 4 + c]);
+				squaredError += static_cast<u64>(d * d);
+			}
+		}
+
+		if (squaredError == 0)
+		{
+			return std::numeric_limits<f64>::infinity();
+		}
+
+		const f64 meanSquaredError = static_cast<f64>(squaredError) / (static_cast<f64>(width) * height * channelCount);
+		return 10.0 * std::log10(255.0 * 255.0 / meanSquaredError);
+	}
+}
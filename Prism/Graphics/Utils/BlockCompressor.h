@@ -0,0 +1,37 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Graphics/Utils/TextureFormat.h"
+#include <Elos/Common/FunctionMacros.h>
+
+namespace Prism::Gfx
+{
+	enum class BlockFormat : u32
+	{
+		BC1,  // Opaque RGB, 4 bpp
+		BC3,  // RGB plus interpolated alpha, 8 bpp
+		BC5,  // Two independent channels (tangent space normal XY), 8 bpp
+		BC7   // RGBA, 8 bpp, higher quality than BC1/BC3 at a higher encode cost
+	};
+
+	// Format chosen for cooked textures, normal maps always use BC5 unless compression is off
+	enum class TextureCompression : u32
+	{
+		None,        // Keep RGBA8
+		Standard,    // BC1 for opaque color textures, BC3 when any texel has alpha
+		HighQuality  // BC7 for every color texture
+	};
+
+	NODISCARD DXGI_FORMAT GetDxgiFormat(const BlockFormat format) noexcept;
+
+	// Encodes a tightly packed RGBA8 image into 4x4 blocks, edge blocks repeat the last row and column
+	// Images with at least 256 blocks are split into tiles of block rows across the worker pool
+	// BC7 only emits mode 6 (one subset, RGBA endpoints with p-bits, 4 bit indices)
+	void CompressImage(const byte* rgba, const u32 width, const u32 height, const BlockFormat format, byte* blocks, const bool parallel = true);
+
+	// Decodes blocks back to RGBA8, BC5 fills blue with 0 and alpha with 255
+	// BC7 blocks in modes other than 6 decode to transparent black
+	void DecompressImage(const byte* blocks, const u32 width, const u32 height, const BlockFormat format, byte* rgba);
+
+	// Peak signal to noise ratio in dB over the first channelCount channels of two RGBA8 images, infinity when identical
+	NODISCARD f64 ComputePsnr(const byte* reference, const byte* test, const u32 width, const u32 height, const u32 channelCount = 4) noexcept;
+}
@@ -0,0 +1,87 @@
+#include "Graphics/Utils/ImageDecoder.h"
+#include <wincodec.h>
+#include <format>
+
+namespace Prism::Gfx
+{
+	std::expected<DecodedImage, Texture2D::TextureError> DecodeImage(std::span<const byte> encoded)
+	{
+		const auto DecodeFailed = [](const HRESULT hr, Elos::StringView step)
+		{
+			return std::unexpected(Texture2D::TextureError
+			{
+				.Type      = Texture2D::TextureError::Type::DecodeFailed,
+				.ErrorCode = hr,
+				.Message   = std::format("Failed to decode image ({})", step)
+			});
+		};
+
+		ComPtr<IWICImagingFactory> factory;
+		HRESULT hr = CoCreateInstance(CLSID_WICImagingFactory2, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&factory));
+		if (FAILED(hr))
+		{
+			return DecodeFailed(hr, "create WIC factory");
+		}
+
+		ComPtr<IWICStream> stream;
+		hr = factory->CreateStream(&stream);
+		if (SUCCEEDED(hr))
+		{
+			hr = stream->InitializeFromMemory(
+				const_cast<BYTE*>(reinterpret_cast<const BYTE*>(encoded.data())),
+				static_cast<DWORD>(encoded.size()));
+		}
+		if (FAILED(hr))
+		{
+			return DecodeFailed(hr, "create stream");
+		}
+
+		ComPtr<IWICBitmapDecoder> decoder;
+		hr = factory->CreateDecoderFromStream(stream.Get(), nullptr, WICDecodeMetadataCacheOnDemand, &decoder);
+		if (FAILED(hr))
+		{
+			return DecodeFailed(hr, "unknown container");
+		}
+
+		ComPtr<IWICBitmapFrameDecode> frame;
+		hr = decoder->GetFrame(0, &frame);
+		if (FAILED(hr))
+		{
+			return DecodeFailed(hr, "read frame");
+		}
+
+		DecodedImage image;
+		hr = frame->GetSize(&image.Width, &image.Height);
+		if (FAILED(hr) || image.Width == 0 || image.Height == 0)
+		{
+			return DecodeFailed(FAILED(hr) ? hr : E_FAIL, "empty frame");
+		}
+
+		ComPtr<IWICFormatConverter> converter;
+		hr = factory->CreateFormatConverter(&converter);
+		if (SUCCEEDED(hr))
+		{
+			hr = converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone, nullptr, 0.0, WICBitmapPaletteTypeMedianCut);
+		}
+		if (FAILED(hr))
+		{
+			return DecodeFailed(hr, "convert to RGBA8");
+		}
+
+		const u32 rowPitch  = image.Width * 4;
+		const u64 imageSize = u64{ rowPitch } * image.Height;
+		if (imageSize > UINT32_MAX)
+		{
+			return DecodeFailed(E_INVALIDARG, "image too large");
+		}
+
+		image.Texels.resize(imageSize);
+		hr = converter->CopyPixels(nullptr, rowPitch, static_cast<UINT>(imageSize), reinterpret_cast<BYTE*>(image.Texels.data()));
+		if (FAILED(hr))
+		{
+			return DecodeFailed(hr, "copy pixels");
+		}
+
+		return image;
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Graphics/Resources/Texture2D.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <expected>
+#include <span>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	struct DecodedImage
+	{
+		u32 Width  = 0;
+		u32 Height = 0;
+		std::vector<byte> Texels;  // Tightly packed RGBA8
+	};
+
+	// Decodes an encoded image (png, jpg, bmp...) on the CPU through WIC, converting any pixel format to RGBA8
+	// Unlike ResourceFactory::CreateTextureFromWIC nothing is uploaded, so the texels can be processed and cooked first
+	NODISCARD std::expected<DecodedImage, Texture2D::TextureError> DecodeImage(std::span<const byte> encoded);
+}
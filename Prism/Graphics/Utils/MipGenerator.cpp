@@ -0,0 +1,259 @@
+#include "Graphics/Utils/MipGenerator.h"
+#include <DirectXMath.h>
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		using namespace DirectX;
+
+		constexpr size_t ParallelTexelThreshold = 64 * 1024;
+		constexpr u32 ParallelRows              = 16;    // Destination rows per task
+		constexpr f32 KaiserRadius              = 3.0f;  // In destination texels
+		constexpr f32 KaiserAlpha               = 4.0f;
+
+		// Source texels and weights feeding each destination texel along one axis, MaxTaps per texel
+		// Unused taps keep a zero weight so the inner loops stay branch free
+		struct FilterTaps
+		{
+			u32 MaxTaps = 0;
+			std::vector<u32> Indices;
+			std::vector<f32> Weights;
+		};
+
+		const std::array<f32, 256> SrgbToLinear = []
+		{
+			std::array<f32, 256> table{};
+			for (u32 i = 0; i < 256; i++)
+			{
+				const f32 c = static_cast<f32>(i) / 255.0f;
+				table[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+			}
+			return table;
+		}();
+
+		f32 BesselI0(const f32 x) noexcept
+		{
+			f32 sum  = 1.0f;
+			f32 term = 1.0f;
+			for (u32 k = 1; k < 32 && term > 1e-7f * sum; k++)
+			{
+				const f32 half = x / (2.0f * static_cast<f32>(k));
+				term *= half * half;
+				sum  += term;
+			}
+			return sum;
+		}
+
+		f32 KaiserWeight(const f32 x) noexcept
+		{
+			if (std::abs(x) >= KaiserRadius)
+			{
+				return 0.0f;
+			}
+
+			const f32 px   = XM_PI * x;
+			const f32 sinc = std::abs(x) < 1e-6f ? 1.0f : std::sin(px) / px;
+			const f32 t    = x / KaiserRadius;
+			return sinc * BesselI0(KaiserAlpha * std::sqrt(1.0f - t * t)) / BesselI0(KaiserAlpha);
+		}
+
+		FilterTaps BuildTaps(const u32 sourceSize, const u32 destinationSize, const MipFilter filter)
+		{
+			// Footprints are laid out in source texels, edges clamp to the border texel
+			const f32 scale  = static_cast<f32>(sourceSize) / static_cast<f32>(destinationSize);
+			const f32 radius = (filter == MipFilter::Box ? 0.5f : KaiserRadius) * scale;
+
+			FilterTaps taps;
+			taps.MaxTaps = static_cast<u32>(std::ceil(2.0f * radius)) + 1;
+			taps.Indices.resize(size_t{ destinationSize } * taps.MaxTaps, 0);
+			taps.Weights.resize(size_t{ destinationSize } * taps.MaxTaps, 0.0f);
+
+			for (u32 d = 0; d < destinationSize; d++)
+			{
+				const f32 center = (static_cast<f32>(d) + 0.5f) * scale;
+				const i32 first  = static_cast<i32>(std::floor(center - radius));
+				const i32 last   = static_cast<i32>(std::ceil(center + radius));
+
+				u32* indices = taps.Indices.data() + size_t{ d } * taps.MaxTaps;
+				f32* weights = taps.Weights.data() + size_t{ d } * taps.MaxTaps;
+				u32 count    = 0;
+				f32 total    = 0.0f;
+
+				for (i32 i = first; i < last && count < taps.MaxTaps; i++)
+				{
+					const f32 position = static_cast<f32>(i);
+					const f32 weight   = filter == MipFilter::Box
+						? std::max(0.0f, std::min(position + 1.0f, center + radius) - std::max(position, center - radius))
+						: KaiserWeight((position + 0.5f - center) / scale);
+
+					if (weight != 0.0f)
+					{
+						indices[count] = static_cast<u32>(std::clamp(i, 0, static_cast<i32>(sourceSize) - 1));
+						weights[count] = weight;
+						total += weight;
+						count++;
+					}
+				}
+
+				for (u32 k = 0; k < count; k++)
+				{
+					weights[k] /= total;
+				}
+			}
+
+			return taps;
+		}
+
+		template <bool IsSrgb>
+		inline XMVECTOR DecodeTexel(const byte* texel) noexcept
+		{
+			if constexpr (IsSrgb)
+			{
+				return XMVectorSet(
+					SrgbToLinear[static_cast<u8>(texel[0])],
+					SrgbToLinear[static_cast<u8>(texel[1])],
+					SrgbToLinear[static_cast<u8>(texel[2])],
+					static_cast<f32>(static_cast<u8>(texel[3])) / 255.0f);
+			}
+			else
+			{
+				return PackedVector::XMLoadUByteN4(reinterpret_cast<const PackedVector::XMUBYTEN4*>(texel));
+			}
+		}
+
+		template <bool IsSrgb>
+		inline void EncodeTexel(const FXMVECTOR color, byte* texel) noexcept
+		{
+			// Kaiser lobes can overshoot, saturate before going back to 8 bits
+			XMVECTOR value = XMVectorSaturate(color);
+			if constexpr (IsSrgb)
+			{
+				value = XMColorRGBToSRGB(value);
+			}
+			value = XMVectorRound(XMVectorScale(value, 255.0f));
+			PackedVector::XMStoreUByte4(reinterpret_cast<PackedVector::XMUBYTE4*>(texel), value);
+		}
+
+		// Filters rows [firstRow, firstRow + rowCount) of the destination level, vertical pass into a scratch row then horizontal
+		template <bool IsSrgb>
+		void FilterRows(
+			const byte* source,
+			const MipLevel& sourceLevel,
+			byte* destination,
+			const MipLevel& destinationLevel,
+			const FilterTaps& horizontal,
+			const FilterTaps& vertical,
+			const u32 firstRow,
+			const u32 rowCount)
+		{
+			std::vector<XMVECTOR> column(sourceLevel.Width);
+
+			for (u32 y = firstRow; y < firstRow + rowCount; y++)
+			{
+				std::ranges::fill(column, XMVectorZero());
+
+				const size_t verticalBase = size_t{ y } * vertical.MaxTaps;
+				for (u32 k = 0; k < vertical.MaxTaps; k++)
+				{
+					const f32 weight = vertical.Weights[verticalBase + k];
+					if (weight == 0.0f)
+					{
+						continue;
+					}
+
+					const byte* row = source + size_t{ vertical.Indices[verticalBase + k] } * sourceLevel.GetRowPitch();
+					const XMVECTOR w = XMVectorReplicate(weight);
+					for (u32 x = 0; x < sourceLevel.Width; x++)
+					{
+						column[x] = XMVectorMultiplyAdd(DecodeTexel<IsSrgb>(row + size_t{ x } * 4), w, column[x]);
+					}
+				}
+
+				byte* out = destination + size_t{ y } * destinationLevel.GetRowPitch();
+				for (u32 x = 0; x < destinationLevel.Width; x++)
+				{
+					const size_t horizontalBase = size_t{ x } * horizontal.MaxTaps;
+					XMVECTOR sum = XMVectorZero();
+					for (u32 k = 0; k < horizontal.MaxTaps; k++)
+					{
+						sum = XMVectorMultiplyAdd(
+							column[horizontal.Indices[horizontalBase + k]],
+							XMVectorReplicate(horizontal.Weights[horizontalBase + k]),
+							sum);
+					}
+					EncodeTexel<IsSrgb>(sum, out + size_t{ x } * 4);
+				}
+			}
+		}
+	}
+
+	u32 GetMipLevelCount(const u32 width, const u32 height) noexcept
+	{
+		return static_cast<u32>(std::bit_width(std::max({ width, height, 1u })));
+	}
+
+	MipLevel GetMipLevel(const u32 width, const u32 height, const u32 level) noexcept
+	{
+		MipLevel mip{ .Offset = 0, .Width = width, .Height = height };
+		for (u32 i = 0; i < level; i++)
+		{
+			mip.Offset += mip.GetSize();
+			mip.Width   = std::max(1u, mip.Width / 2);
+			mip.Height  = std::max(1u, mip.Height / 2);
+		}
+		return mip;
+	}
+
+	u64 GetMipChainSize(const u32 width, const u32 height, const u32 mipLevels) noexcept
+	{
+		return GetMipLevel(width, height, mipLevels).Offset;
+	}
+
+	void GenerateMips(
+		byte* chain,
+		const u32 width,
+		const u32 height,
+		const u32 mipLevels,
+		const MipFilter filter,
+		const bool isSrgb,
+		const bool parallel)
+	{
+		const auto filterRows = isSrgb ? &FilterRows<true> : &FilterRows<false>;
+
+		for (u32 level = 1; level < mipLevels; level++)
+		{
+			const MipLevel sourceLevel      = GetMipLevel(width, height, level - 1);
+			const MipLevel destinationLevel = GetMipLevel(width, height, level);
+			const FilterTaps horizontal     = BuildTaps(sourceLevel.Width, destinationLevel.Width, filter);
+			const FilterTaps vertical       = BuildTaps(sourceLevel.Height, destinationLevel.Height, filter);
+
+			const byte* source = chain + sourceLevel.Offset;
+			byte* destination  = chain + destinationLevel.Offset;
+
+			if (!parallel || size_t{ destinationLevel.Width } * destinationLevel.Height < ParallelTexelThreshold)
+			{
+				filterRows(source, sourceLevel, destination, destinationLevel, horizontal, vertical, 0, destinationLevel.Height);
+				continue;
+			}
+
+			// Each band owns its destination rows and only reads the previous level
+			std::vector<u32> bands((destinationLevel.Height + ParallelRows - 1) / ParallelRows);
+			std::iota(bands.begin(), bands.end(), 0u);
+			std::for_each(std::execution::par, bands.begin(), bands.end(), [&](const u32 band)
+			{
+				const u32 firstRow = band * ParallelRows;
+				const u32 rowCount = std::min(ParallelRows, destinationLevel.Height - firstRow);
+				filterRows(source, sourceLevel, destination, destinationLevel, horizontal, vertical, firstRow, rowCount);
+			});
+		}
+	}
+}
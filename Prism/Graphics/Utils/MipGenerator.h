@@ -0,0 +1,40 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+
+namespace Prism::Gfx
+{
+	enum class MipFilter : u32
+	{
+		Box,    // Area average, cheap and blurs slightly less than bilinear
+		Kaiser  // Windowed sinc, sharper minification at the cost of wider footprints
+	};
+
+	// A level inside a tightly packed RGBA8 mip chain, levels are stored back to back from level 0
+	struct MipLevel
+	{
+		u64 Offset = 0;
+		u32 Width  = 0;
+		u32 Height = 0;
+
+		NODISCARD inline u32 GetRowPitch() const noexcept { return Width * 4; }
+		NODISCARD inline u64 GetSize() const noexcept { return u64{ Width } * Height * 4; }
+	};
+
+	// Full chain length down to 1x1
+	NODISCARD u32 GetMipLevelCount(const u32 width, const u32 height) noexcept;
+	NODISCARD MipLevel GetMipLevel(const u32 width, const u32 height, const u32 level) noexcept;
+	NODISCARD u64 GetMipChainSize(const u32 width, const u32 height, const u32 mipLevels) noexcept;
+
+	// Fills levels 1 to mipLevels - 1 of an RGBA8 chain whose level 0 is already in place, each level filtered from the previous one
+	// sRGB texels are filtered in linear space, alpha is always linear. Levels with at least 64K texels are split into row bands
+	// across the worker pool
+	void GenerateMips(
+		byte* chain,
+		const u32 width,
+		const u32 height,
+		const u32 mipLevels,
+		const MipFilter filter,
+		const bool isSrgb,
+		const bool parallel = true);
+}
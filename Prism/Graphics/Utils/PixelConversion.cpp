@@ -0,0 +1,113 @@
+#include "Graphics/Utils/PixelConversion.h"
+#include <algorithm>
+#include <cstring>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+#if defined(__AVX__) || defined(__SSSE3__)
+	#include <tmmintrin.h>
+	#define PRISM_PIXEL_SSSE3 1
+	#define PRISM_PIXEL_SSE2 1
+#elif defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+	#include <emmintrin.h>
+	#define PRISM_PIXEL_SSSE3 0
+	#define PRISM_PIXEL_SSE2 1
+#else
+	#define PRISM_PIXEL_SSSE3 0
+	#define PRISM_PIXEL_SSE2 0
+#endif
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		constexpr size_t ParallelTexelThreshold = 1024 * 1024;
+		constexpr u32 ParallelRows              = 64;  // Rows per task
+
+		inline u32 SwapRedBlue(const u32 texel) noexcept
+		{
+			return (texel & 0xFF00FF00u) | ((texel & 0x000000FFu) << 16) | ((texel & 0x00FF0000u) >> 16);
+		}
+
+		void ConvertTexels(const byte* source, byte* destination, const size_t texelCount) noexcept
+		{
+			size_t i = 0;
+
+#if PRISM_PIXEL_SSE2
+	#if PRISM_PIXEL_SSSE3
+			const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+	#else
+			const __m128i keepMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+			const __m128i lowMask  = _mm_set1_epi32(0x000000FF);
+	#endif
+			// 16 texels per iteration to keep four independent loads in flight
+			for (; i + 16 <= texelCount; i += 16)
+			{
+				__m128i texels[4];
+				for (u32 j = 0; j < 4; j++)
+				{
+					texels[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + (i + j * 4) * 4));
+				}
+
+				for (u32 j = 0; j < 4; j++)
+				{
+	#if PRISM_PIXEL_SSSE3
+					const __m128i swapped = _mm_shuffle_epi8(texels[j], shuffle);
+	#else
+					const __m128i blue    = _mm_slli_epi32(_mm_and_si128(texels[j], lowMask), 16);
+					const __m128i red     = _mm_and_si128(_mm_srli_epi32(texels[j], 16), lowMask);
+					const __m128i swapped = _mm_or_si128(_mm_and_si128(texels[j], keepMask), _mm_or_si128(blue, red));
+	#endif
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + (i + j * 4) * 4), swapped);
+				}
+			}
+
+			for (; i + 4 <= texelCount; i += 4)
+			{
+				const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+	#if PRISM_PIXEL_SSSE3
+				const __m128i swapped = _mm_shuffle_epi8(texels, shuffle);
+	#else
+				const __m128i blue    = _mm_slli_epi32(_mm_and_si128(texels, lowMask), 16);
+				const __m128i red     = _mm_and_si128(_mm_srli_epi32(texels, 16), lowMask);
+				const __m128i swapped = _mm_or_si128(_mm_and_si128(texels, keepMask), _mm_or_si128(blue, red));
+	#endif
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i * 4), swapped);
+			}
+#endif
+
+			for (; i < texelCount; i++)
+			{
+				u32 texel;
+				std::memcpy(&texel, source + i * 4, sizeof(u32));
+				texel = SwapRedBlue(texel);
+				std::memcpy(destination + i * 4, &texel, sizeof(u32));
+			}
+		}
+	}
+
+	void ConvertBgra8ToRgba8(const void* source, void* destination, const u32 width, const u32 height, const bool parallel) noexcept
+	{
+		const byte* src = static_cast<const byte*>(source);
+		byte* dst       = static_cast<byte*>(destination);
+		const size_t rowTexels = width;
+
+		if (!parallel || rowTexels * height < ParallelTexelThreshold)
+		{
+			ConvertTexels(src, dst, rowTexels * height);
+			return;
+		}
+
+		// Rows are tightly packed, so each band is one contiguous run
+		std::vector<u32> bands((height + ParallelRows - 1) / ParallelRows);
+		std::iota(bands.begin(), bands.end(), 0u);
+		std::for_each(std::execution::par, bands.begin(), bands.end(), [&](const u32 band)
+		{
+			const u32 firstRow = band * ParallelRows;
+			const u32 rowCount = std::min(ParallelRows, height - firstRow);
+			const size_t offset = size_t{ firstRow } * rowTexels * 4;
+			ConvertTexels(src + offset, dst + offset, size_t{ rowCount } * rowTexels);
+		});
+	}
+}
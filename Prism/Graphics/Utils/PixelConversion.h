@@ -0,0 +1,10 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+
+namespace Prism::Gfx
+{
+	// Swaps the red and blue channels of tightly packed 8 bit BGRA texels into RGBA
+	// Source and destination may alias. Images with at least 1M texels are split into row bands across the worker pool
+	void ConvertBgra8ToRgba8(const void* source, void* destination, const u32 width, const u32 height, const bool parallel = true) noexcept;
+}
@@ -0,0 +1,189 @@
+#include "Graphics/Utils/ResidencyPlanner.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <queue>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		// Next level to bring in for a texture, ordered so the texture furthest from its request comes first
+		// and the cheaper level breaks ties
+		struct Candidate
+		{
+			u32 Gap   = 0;
+			u64 Cost  = 0;
+			u32 Index = 0;
+
+			bool operator<(const Candidate& other) const noexcept
+			{
+				if (Gap != other.Gap)
+				{
+					return Gap < other.Gap;
+				}
+				if (Cost != other.Cost)
+				{
+					return Cost > other.Cost;
+				}
+				return Index > other.Index;
+			}
+		};
+
+		u64 GetLevelBytes(const TextureResidency& texture, const u32 level) noexcept
+		{
+			return GetSubresourceLayout(texture.Format, texture.Width, texture.Height, level).Size;
+		}
+	}
+
+	ResidencyPlanner::ResidencyPlanner(const Settings& settings) noexcept
+		: m_settings(settings)
+	{
+	}
+
+	u32 ResidencyPlanner::GetTailMip(const TextureResidency& texture) const noexcept
+	{
+		const u32 lastMip = std::max(texture.MipLevels, 1u) - 1;
+		for (u32 mip = 0; mip < lastMip; mip++)
+		{
+			if (std::max(1u, texture.Width >> mip) <= m_settings.TailSize && std::max(1u, texture.Height >> mip) <= m_settings.TailSize)
+			{
+				return mip;
+			}
+		}
+		return lastMip;
+	}
+
+	u32 ResidencyPlanner::GetMipForScreenSize(const TextureResidency& texture, const f32 projectedSize) const noexcept
+	{
+		const u32 tailMip = GetTailMip(texture);
+		if (!(projectedSize > 0.0f))
+		{
+			return tailMip;
+		}
+
+		const f32 texels = static_cast<f32>(std::max(texture.Width, texture.Height));
+		const f32 mip    = std::floor(std::log2(texels / projectedSize) + m_settings.MipBias);
+		if (!(mip > 0.0f))
+		{
+			return 0;  // Also covers an infinite projected size, the camera is inside the surface bounds
+		}
+		return std::min(tailMip, static_cast<u32>(std::min(mip, 32.0f)));
+	}
+
+	ResidencyPlanner::Plan ResidencyPlanner::PlanResidency(std::span<const TextureResidency> textures) const
+	{
+		Plan plan;
+		plan.TargetMips.resize(textures.size());
+
+		// Tails come first and are never evicted, even when they alone do not fit
+		std::vector<u32> requested(textures.size());
+		u64 used = 0;
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			const u32 tailMip  = GetTailMip(textures[i]);
+			plan.TargetMips[i] = tailMip;
+			requested[i]       = std::min(textures[i].RequestedMip, tailMip);
+			used += GetResidentBytes(textures[i], tailMip);
+		}
+		plan.IsOverBudget = used > m_settings.BudgetBytes;
+
+		const auto MakeCandidate = [&](const u32 index)
+		{
+			return Candidate
+			{
+				.Gap   = plan.TargetMips[index] - requested[index],
+				.Cost  = GetLevelBytes(textures[index], plan.TargetMips[index] - 1),
+				.Index = index
+			};
+		};
+
+		std::priority_queue<Candidate> candidates;
+		for (u32 i = 0; i < textures.size(); i++)
+		{
+			if (plan.TargetMips[i] > requested[i])
+			{
+				candidates.push(MakeCandidate(i));
+			}
+		}
+
+		// Requested levels, one level per step. The first upload of a plan always passes the upload limit so a top
+		// level larger than the limit still streams in. A texture that does not fit waits for the next plan
+		u64 uploaded = 0;
+		while (!candidates.empty())
+		{
+			const Candidate candidate = candidates.top();
+			candidates.pop();
+
+			const u32 index    = candidate.Index;
+			const u32 level    = plan.TargetMips[index] - 1;
+			const u64 upload   = level < textures[index].ResidentMip ? candidate.Cost : 0;
+			const bool fits    = used + candidate.Cost <= m_settings.BudgetBytes;
+			const bool inLimit = upload == 0 || uploaded == 0 || uploaded + upload <= m_settings.MaxUploadBytes;
+			if (!fits || !inLimit)
+			{
+				continue;
+			}
+
+			plan.TargetMips[index] = level;
+			used     += candidate.Cost;
+			uploaded += upload;
+			if (level > requested[index])
+			{
+				candidates.push(MakeCandidate(index));
+			}
+		}
+
+		// Detail still resident beyond the requests costs nothing to keep until the budget needs it,
+		// textures asking for the most detail keep theirs first
+		std::vector<u32> order(textures.size());
+		std::iota(order.begin(), order.end(), 0u);
+		std::ranges::stable_sort(order, {}, [&requested](const u32 index) { return requested[index]; });
+		for (const u32 index : order)
+		{
+			while (plan.TargetMips[index] > textures[index].ResidentMip)
+			{
+				const u64 cost = GetLevelBytes(textures[index], plan.TargetMips[index] - 1);
+				if (used + cost > m_settings.BudgetBytes)
+				{
+					break;
+				}
+				plan.TargetMips[index]--;
+				used += cost;
+			}
+		}
+
+		for (size_t i = 0; i < textures.size(); i++)
+		{
+			const u64 current = GetResidentBytes(textures[i], textures[i].ResidentMip);
+			const u64 target  = GetResidentBytes(textures[i], plan.TargetMips[i]);
+			if (target > current)
+			{
+				plan.UploadBytes += target - current;
+			}
+			else
+			{
+				plan.EvictedBytes += current - target;
+			}
+
+			if (plan.TargetMips[i] > requested[i])
+			{
+				plan.DeferredCount++;
+			}
+		}
+		plan.ResidentBytes = used;
+
+		return plan;
+	}
+
+	u64 ResidencyPlanner::GetResidentBytes(const TextureResidency& texture, const u32 topMip) noexcept
+	{
+		if (topMip >= texture.MipLevels)
+		{
+			return 0;
+		}
+
+		return GetChainSize(texture.Format, texture.Width, texture.Height, texture.MipLevels) -
+			GetSubresourceLayout(texture.Format, texture.Width, texture.Height, topMip).Offset;
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Graphics/Utils/TextureFormat.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <span>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	// Residency of one streamed texture, a texture with top level m holds levels m to MipLevels - 1
+	struct TextureResidency
+	{
+		u32 Width          = 0;
+		u32 Height         = 0;
+		u32 MipLevels      = 1;
+		DXGI_FORMAT Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		u32 ResidentMip    = 0;  // Current top level
+		u32 RequestedMip   = 0;  // Most detailed level worth having this frame, MipLevels when nothing drew the texture
+	};
+
+	// Decides which mips of every streamed texture stay in video memory. Pure CPU bookkeeping with no device,
+	// so budgets can be simulated by feeding it residencies and applying its targets back
+	class ResidencyPlanner
+	{
+	public:
+		struct Settings
+		{
+			u64 BudgetBytes    = 512ull << 20;  // Video memory for all streamed textures together
+			u64 MaxUploadBytes = 16ull << 20;   // New mip bytes per plan, larger requests finish over the next plans
+			u32 TailSize       = 64;            // Levels whose sides are all at most this many texels are always resident
+			f32 MipBias        = 0.0f;          // Added to screen size requests, positive values stream less detail
+		};
+
+		struct Plan
+		{
+			std::vector<u32> TargetMips;  // New top level of each texture, in input order
+			u64 ResidentBytes = 0;        // Video memory of every texture once the targets are applied
+			u64 UploadBytes   = 0;        // Bytes of levels that become resident
+			u64 EvictedBytes  = 0;        // Bytes of levels that stop being resident
+			u32 DeferredCount = 0;        // Textures left short of their request by the budget or the upload limit
+			bool IsOverBudget = false;    // The always resident tails alone exceed the budget
+		};
+
+	public:
+		ResidencyPlanner() noexcept = default;
+		explicit ResidencyPlanner(const Settings& settings) noexcept;
+
+		NODISCARD inline const Settings& GetSettings() const noexcept { return m_settings; }
+		inline void SetSettings(const Settings& settings) noexcept { m_settings = settings; }
+
+		// Tails are always resident, requests and targets never go above them
+		NODISCARD u32 GetTailMip(const TextureResidency& texture) const noexcept;
+
+		// Level whose texels map about one to one to screen pixels on a surface projectedSize pixels across, assuming
+		// its UVs span the texture once. Tiled UVs need more detail than this estimate, which MipBias can make up for
+		NODISCARD u32 GetMipForScreenSize(const TextureResidency& texture, const f32 projectedSize) const noexcept;
+
+		// Takes requested levels first, the textures furthest from their request one level at a time so the budget is
+		// spread evenly. Leftover budget then keeps detail that is already resident but no longer requested, so
+		// textures are only evicted under memory pressure
+		NODISCARD Plan PlanResidency(std::span<const TextureResidency> textures) const;
+
+		// Bytes of levels topMip to MipLevels - 1
+		NODISCARD static u64 GetResidentBytes(const TextureResidency& texture, const u32 topMip) noexcept;
+
+	private:
+		Settings m_settings;
+	};
+}
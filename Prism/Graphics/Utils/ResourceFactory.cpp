@@ -1,14 +1,26 @@
 #include "ResourceFactory.h"
+#include "Graphics/Utils/TextureContainer.h"
 #include <d3d11shader.h>
 #include <d3dcompiler.h>
 #include <Elos/Common/Assert.h>
 #include <directxtk/WICTextureLoader.h>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 namespace Prism::Gfx
 {
 	ResourceFactory::ResourceFactory(const Core::Device* device)
 		: m_device(device)
+		, m_textureCache(std::make_unique<TextureCache>())
+		, m_textureStreamer(std::make_unique<TextureStreamer>(*this))
 	{
+		auto materialResult = CreateMaterial(Material::MaterialDesc{ .Name = "Default" });
+		if (!materialResult)
+		{
+			Elos::ASSERT(SUCCEEDED(materialResult.error().ErrorCode)).Msg("{} (Error Code: {:#x})", materialResult.error().Message, materialResult.error().ErrorCode).Throw();
+		}
+		m_defaultMaterial = std::move(materialResult.value());
 	}
 
 	std::expected<std::shared_ptr<VertexBuffer>, Buffer::BufferError> ResourceFactory::CreateVertexBuffer(
@@ -49,12 +61,25 @@ namespace Prism::Gfx
 
 	std::expected<std::shared_ptr<IndexBuffer>, Buffer::BufferError> ResourceFactory::CreateIndexBuffer(
 		std::span<const u32> indices, bool isDynamic) const 
+	{
+		return CreateIndexBuffer(indices.data(), static_cast<u32>(indices.size()), DXGI_FORMAT_R32_UINT, isDynamic);
+	}
+
+	std::expected<std::shared_ptr<IndexBuffer>, Buffer::BufferError> ResourceFactory::CreateIndexBuffer(
+		std::span<const u16> indices, bool isDynamic) const 
+	{
+		return CreateIndexBuffer(indices.data(), static_cast<u32>(indices.size()), DXGI_FORMAT_R16_UINT, isDynamic);
+	}
+
+	std::expected<std::shared_ptr<IndexBuffer>, Buffer::BufferError> ResourceFactory::CreateIndexBuffer(
+		const void* indexData, const u32 indexCount, const DXGI_FORMAT format, bool isDynamic) const 
 	{
 		std::shared_ptr<IndexBuffer> buffer(new IndexBuffer(isDynamic));
+		buffer->Format = format;
 
 		const D3D11_BUFFER_DESC desc
 		{
-			.ByteWidth           = static_cast<UINT>(indices.size_bytes()),
+			.ByteWidth           = indexCount * buffer->GetIndexSize(),
 			.Usage               = isDynamic ? D3D11_USAGE_DYNAMIC : D3D11_USAGE_DEFAULT,
 			.BindFlags           = D3D11_BIND_INDEX_BUFFER,
 			.CPUAccessFlags      = isDynamic ? D3D11_CPU_ACCESS_WRITE : 0u,
@@ -64,7 +89,7 @@ namespace Prism::Gfx
 
 		const D3D11_SUBRESOURCE_DATA initData
 		{
-			.pSysMem          = indices.data(),
+			.pSysMem          = indexData,
 			.SysMemPitch      = 0,
 			.SysMemSlicePitch = 0
 		};
@@ -80,14 +105,40 @@ namespace Prism::Gfx
 			});
 		}
 
+		buffer->IndexCount = indexCount;
 		return buffer;
 	}
 	
 	std::expected<std::shared_ptr<Mesh>, Mesh::MeshError> ResourceFactory::CreateMesh(
 		const void* vertices, u32 vertexCount, std::span<const u32> indices, const Mesh::MeshDesc& desc) const 
 	{
-		std::shared_ptr<Mesh> mesh(new Mesh());
+		const Mesh::SubmeshDesc submesh
+		{
+			.BaseVertex     = 0,
+			.VertexCount    = vertexCount,
+			.StartIndex     = 0,
+			.IndexCount     = static_cast<u32>(indices.size()),
+			.Dequantization = desc.Dequantization,
+			.Meshlets       = desc.Meshlets,
+			.Lods           = desc.Lods,
+			.Bounds         = desc.Bounds
+		};
 
+		auto meshesResult = CreateMeshes(vertices, vertexCount, indices, desc, std::span(&submesh, 1));
+		if (!meshesResult)
+		{
+			return std::unexpected(meshesResult.error());
+		}
+		return std::move(meshesResult.value().front());
+	}
+
+	std::expected<std::vector<std::shared_ptr<Mesh>>, Mesh::MeshError> ResourceFactory::CreateMeshes(
+		const void* vertices,
+		u32 vertexCount,
+		std::span<const u32> indices,
+		const Mesh::MeshDesc& desc,
+		std::span<const Mesh::SubmeshDesc> submeshes) const
+	{
 		auto vbResult = CreateVertexBuffer(vertices, vertexCount, desc.VertexStride, desc.DynamicVB);
 		if (!vbResult)
 		{
@@ -99,7 +150,25 @@ namespace Prism::Gfx
 			});
 		}
 
-		auto ibResult = CreateIndexBuffer(indices, desc.DynamicIB);
+		// Narrow to 16 bit indices when every vertex is addressable from its range's base vertex
+		// 0xFFFF is excluded since it is the strip cut value
+		const bool useShortIndices = desc.AllowShortIndices && std::ranges::all_of(submeshes, [](const Mesh::SubmeshDesc& submesh)
+		{
+			return submesh.VertexCount <= std::numeric_limits<u16>::max();
+		});
+
+		std::expected<std::shared_ptr<IndexBuffer>, Buffer::BufferError> ibResult;
+		if (useShortIndices)
+		{
+			std::vector<u16> shortIndices(indices.size());
+			std::ranges::transform(indices, shortIndices.begin(), [](const u32 index) { return static_cast<u16>(index); });
+			ibResult = CreateIndexBuffer(std::span<const u16>(shortIndices), desc.DynamicIB);
+		}
+		else
+		{
+			ibResult = CreateIndexBuffer(indices, desc.DynamicIB);
+		}
+
 		if (!ibResult)
 		{
 			return std::unexpected(Mesh::MeshError
@@ -110,19 +179,121 @@ namespace Prism::Gfx
 			});
 		}
 
-		mesh->m_vertexBuffer = std::move(vbResult.value());
-		mesh->m_indexBuffer  = std::move(ibResult.value());
+		std::shared_ptr<VertexBuffer> vertexBuffer = std::move(vbResult.value());
+		std::shared_ptr<IndexBuffer> indexBuffer   = std::move(ibResult.value());
 
 #if PRISM_BUILD_DEBUG  // Sanity checks. Should never fail
-		Elos::ASSERT_NOT_NULL(mesh->GetVertexBuffer()).Throw();
-		Elos::ASSERT_NOT_NULL(mesh->GetIndexBuffer()).Throw();
+		Elos::ASSERT_NOT_NULL(vertexBuffer.get()).Throw();
+		Elos::ASSERT_NOT_NULL(indexBuffer.get()).Throw();
 #endif
-		mesh->m_topology                  = desc.Topology;
-		mesh->m_vertexBuffer->Stride      = desc.VertexStride;
-		mesh->m_vertexBuffer->VertexCount = vertexCount;
-		mesh->m_indexBuffer->IndexCount   = static_cast<u32>(indices.size());
 
-		return mesh;
+		vertexBuffer->Stride      = desc.VertexStride;
+		vertexBuffer->VertexCount = vertexCount;
+		indexBuffer->IndexCount   = static_cast<u32>(indices.size());
+
+		std::vector<std::shared_ptr<Mesh>> meshes;
+		meshes.reserve(submeshes.size());
+
+		for (const Mesh::SubmeshDesc& submesh : submeshes)
+		{
+			std::shared_ptr<Mesh> mesh(new Mesh());
+			mesh->m_vertexBuffer = vertexBuffer;
+			mesh->m_indexBuffer  = indexBuffer;
+
+			if (desc.Format == VertexFormat::Compact)
+			{
+				auto cbResult = CreateConstantBuffer<MeshConstants>();
+				if (!cbResult)
+				{
+					return std::unexpected(Mesh::MeshError
+					{
+						.Type      = Mesh::MeshError::Type::CreateConstantBufferFailed,
+						.ErrorCode = cbResult.error().ErrorCode,
+						.Message   = "Failed to create mesh constant buffer"
+					});
+				}
+
+				const MeshConstants constants
+				{
+					.PositionScale  = Vector4(submesh.Dequantization.Scale.x, submesh.Dequantization.Scale.y, submesh.Dequantization.Scale.z, 0.0f),
+					.PositionOffset = Vector4(submesh.Dequantization.Offset.x, submesh.Dequantization.Offset.y, submesh.Dequantization.Offset.z, 0.0f)
+				};
+
+				if (auto updateResult = cbResult.value()->Update(m_device->GetContext(), constants); !updateResult)
+				{
+					return std::unexpected(Mesh::MeshError
+					{
+						.Type      = Mesh::MeshError::Type::CreateConstantBufferFailed,
+						.ErrorCode = updateResult.error().ErrorCode,
+						.Message   = "Failed to upload mesh constants"
+					});
+				}
+
+				mesh->m_meshConstants = std::move(cbResult.value());
+			}
+
+			mesh->m_topology                  = desc.Topology;
+			mesh->m_vertexFormat              = desc.Format;
+			if (!submesh.Meshlets.empty())
+			{
+				mesh->m_meshlets = std::make_shared<const std::vector<Meshlet>>(submesh.Meshlets.begin(), submesh.Meshlets.end());
+			}
+			mesh->m_bounds                    = submesh.Bounds;
+			mesh->m_baseVertex                = submesh.BaseVertex;
+			mesh->m_startIndex                = submesh.StartIndex;
+
+			if (submesh.Lods.empty())
+			{
+				mesh->m_lods.push_back(Mesh::Lod{ .IndexOffset = 0, .IndexCount = submesh.IndexCount, .Error = 0.0f });
+			}
+			else
+			{
+				mesh->m_lods.assign(submesh.Lods.begin(), submesh.Lods.end());
+			}
+
+			meshes.push_back(std::move(mesh));
+		}
+
+		return meshes;
+	}
+
+	std::expected<std::shared_ptr<Material>, Material::MaterialError> ResourceFactory::CreateMaterial(const Material::MaterialDesc& desc) const
+	{
+		std::shared_ptr<Material> material(new Material());
+		material->m_name             = desc.Name;
+		material->m_baseColorTexture = desc.BaseColorTexture;
+		material->m_constants        = Material::MaterialConstants
+		{
+			.BaseColor           = desc.BaseColor,
+			.Emissive            = Vector4(desc.Emissive.x, desc.Emissive.y, desc.Emissive.z, 0.0f),
+			.Metallic            = desc.Metallic,
+			.Roughness           = desc.Roughness,
+			.HasBaseColorTexture = desc.BaseColorTexture ? 1u : 0u
+		};
+
+		auto cbResult = CreateConstantBuffer<Material::MaterialConstants>();
+		if (!cbResult)
+		{
+			return std::unexpected(Material::MaterialError
+			{
+				.Type      = Material::MaterialError::Type::CreateConstantBufferFailed,
+				.ErrorCode = cbResult.error().ErrorCode,
+				.Message   = "Failed to create material constant buffer"
+			});
+		}
+
+		if (auto updateResult = cbResult.value()->Update(m_device->GetContext(), material->m_constants); !updateResult)
+		{
+			return std::unexpected(Material::MaterialError
+			{
+				.Type      = Material::MaterialError::Type::CreateConstantBufferFailed,
+				.ErrorCode = updateResult.error().ErrorCode,
+				.Message   = "Failed to upload material constants"
+			});
+		}
+
+		material->m_constantBuffer = std::move(cbResult.value());
+		return material;
 	}
 	
 	std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> ResourceFactory::CreateTexture2D(const Texture2D::Texture2DDesc& desc, const void* pixelData, const u32 rowPitch) const
@@ -150,6 +321,134 @@ namespace Prism::Gfx
 		return texture;
 	}
 
+	std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> ResourceFactory::CreateTexture2D(
+		const Texture2D::Texture2DDesc& desc,
+		std::span<const D3D11_SUBRESOURCE_DATA> subresources) const
+	{
+		if (subresources.size() != size_t{ desc.MipLevels } * desc.ArraySize)
+		{
+			return std::unexpected(Texture2D::TextureError
+			{
+				.Type      = Texture2D::TextureError::Type::InvalidDimensions,
+				.ErrorCode = E_INVALIDARG,
+				.Message   = "Texture subresource count does not match its mip levels and array size"
+			});
+		}
+
+		std::shared_ptr<Texture2D> texture = std::make_shared<Texture2D>();
+
+		HRESULT hr = texture->InitFromData(m_device->GetDevice(), desc, subresources.data());
+		if (FAILED(hr))
+		{
+			return std::unexpected(Texture2D::TextureError
+			{
+				.Type      = Texture2D::TextureError::Type::CreateTextureFailed,
+				.ErrorCode = hr,
+				.Message   = "Failed to create texture"
+			});
+		}
+
+		return texture;
+	}
+
+	std::expected<void, Texture2D::TextureError> ResourceFactory::RecreateMipChain(
+		Texture2D& texture,
+		const Texture2D::Texture2DDesc& desc,
+		std::span<const D3D11_SUBRESOURCE_DATA> topLevels) const
+	{
+		D3D11_TEXTURE2D_DESC1 current{};
+		texture.m_texture->GetDesc1(&current);
+
+		const u32 uploadLevels = static_cast<u32>(topLevels.size());
+		if (uploadLevels > desc.MipLevels ||
+			desc.MipLevels - uploadLevels > current.MipLevels ||
+			desc.ArraySize != 1 ||
+			current.ArraySize != 1 ||
+			desc.Format != current.Format)
+		{
+			return std::unexpected(Texture2D::TextureError
+			{
+				.Type      = Texture2D::TextureError::Type::InvalidDimensions,
+				.ErrorCode = E_INVALIDARG,
+				.Message   = "Mip chain does not match the texture it replaces"
+			});
+		}
+
+		Texture2D created;
+		HRESULT hr = created.InitFromData(m_device->GetDevice(), desc);
+		if (FAILED(hr))
+		{
+			return std::unexpected(Texture2D::TextureError
+			{
+				.Type      = Texture2D::TextureError::Type::CreateTextureFailed,
+				.ErrorCode = hr,
+				.Message   = "Failed to create texture"
+			});
+		}
+
+		// Both chains end at the same level, level n of the new chain is level n + (current - new level count) of the old one
+		DX11::IDeviceContext* context = m_device->GetContext();
+		for (u32 level = 0; level < desc.MipLevels; level++)
+		{
+			if (level < uploadLevels)
+			{
+				context->UpdateSubresource(created.m_texture.Get(), level, nullptr, topLevels[level].pSysMem, topLevels[level].SysMemPitch, 0);
+			}
+			else
+			{
+				const u32 sourceLevel = level + current.MipLevels - desc.MipLevels;
+				context->CopySubresourceRegion(created.m_texture.Get(), level, 0, 0, 0, texture.m_texture.Get(), sourceLevel, nullptr);
+			}
+		}
+
+		std::swap(texture.m_texture, created.m_texture);
+		std::swap(texture.m_srv, created.m_srv);
+		std::swap(texture.m_dimensions, created.m_dimensions);
+		std::swap(texture.m_format, created.m_format);
+		return {};
+	}
+
+	std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> ResourceFactory::CreateTextureFromContainer(std::span<const byte> data) const
+	{
+		auto imageResult = TextureContainer::Parse(data);
+		if (!imageResult)
+		{
+			return std::unexpected(Texture2D::TextureError
+			{
+				.Type      = Texture2D::TextureError::Type::DecodeFailed,
+				.ErrorCode = imageResult.error().ErrorCode,
+				.Message   = imageResult.error().Message
+			});
+		}
+
+		const TextureContainer::Image& image = imageResult.value();
+
+		Texture2D::Texture2DDesc desc;
+		desc.Width          = image.Width;
+		desc.Height         = image.Height;
+		desc.Format         = image.Format;
+		desc.MipLevels      = image.MipLevels;
+		desc.ArraySize      = image.ArraySize;
+		desc.Usage          = D3D11_USAGE_DEFAULT;
+		desc.BindFlags      = D3D11_BIND_SHADER_RESOURCE;
+		desc.CPUAccessFlags = 0;
+		desc.MiscFlags      = image.IsCubeMap ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0;
+
+		std::vector<D3D11_SUBRESOURCE_DATA> subresources;
+		subresources.reserve(image.Subresources.size());
+		for (const TextureContainer::Subresource& subresource : image.Subresources)
+		{
+			subresources.push_back(D3D11_SUBRESOURCE_DATA
+			{
+				.pSysMem          = subresource.Data.data(),
+				.SysMemPitch      = subresource.RowPitch,
+				.SysMemSlicePitch = 0
+			});
+		}
+
+		return CreateTexture2D(desc, subresources);
+	}
+
 	std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> ResourceFactory::CreateTextureFromWIC(const byte* data, u32 dataSize) const
 	{
 		ComPtr<ID3D11Resource> resource;
@@ -212,6 +511,42 @@ namespace Prism::Gfx
 		return texture;
 	}
 
+	std::expected<void, Shader::ShaderError> ResourceFactory::CreateInputLayoutFromDesc(Shader::VertexShaderData* vsData, std::span<const D3D11_INPUT_ELEMENT_DESC> inputLayout) const
+	{
+#if PRISM_BUILD_DEBUG
+		Elos::ASSERT_NOT_NULL(vsData).Throw();
+#endif
+
+		if (!vsData || !vsData->Shader || vsData->ByteCode.empty() || inputLayout.empty())
+		{
+			return std::unexpected(Shader::ShaderError
+			{
+				.Type = Shader::ShaderError::Type::CreationFailed,
+				.ErrorCode = E_FAIL,
+				.Message = "Failed to create input layout from description"
+			});
+		}
+
+		HRESULT hr = m_device->GetDevice()->CreateInputLayout(
+			inputLayout.data(),
+			static_cast<u32>(inputLayout.size()),
+			vsData->ByteCode.data(),
+			vsData->ByteCode.size(),
+			&vsData->Layout);
+
+		if (FAILED(hr))
+		{
+			return std::unexpected(Shader::ShaderError
+			{
+				.Type = Shader::ShaderError::Type::CreationFailed,
+				.ErrorCode = hr,
+				.Message = "Failed to create input layout from description"
+			});
+		}
+
+		return {};
+	}
+
 	std::expected<void, Shader::ShaderError> ResourceFactory::CreateInputLayoutFromVS(Shader::VertexShaderData* vsData) const
 	{
 		// Ref: https://learn.microsoft.com/en-us/windows/win32/api/d3d11shader/nn-d3d11shader-id3d11shaderreflection
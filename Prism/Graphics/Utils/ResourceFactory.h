@@ -6,6 +6,9 @@
 #include "Graphics/Resources/Shaders/Shader.h"
 #include "Graphics/Resources/RenderTarget.h"
 #include "Graphics/Mesh.h"
+#include "Graphics/Material.h"
+#include "Graphics/Utils/TextureCache.h"
+#include "Graphics/Utils/TextureStreamer.h"
 
 namespace Prism::Gfx
 {
@@ -17,6 +20,7 @@ namespace Prism::Gfx
 
 		NODISCARD std::expected<std::shared_ptr<VertexBuffer>, Buffer::BufferError> CreateVertexBuffer(const void* vertexData, const u32 vertexCount, const u32 sizeOfVertexType, bool isDynamic = false) const;
 		NODISCARD std::expected<std::shared_ptr<IndexBuffer>, Buffer::BufferError> CreateIndexBuffer(std::span<const u32> indices, bool isDynamic = false) const;
+		NODISCARD std::expected<std::shared_ptr<IndexBuffer>, Buffer::BufferError> CreateIndexBuffer(std::span<const u16> indices, bool isDynamic = false) const;
 		
 		template <ConstantBufferType T>
 		NODISCARD std::expected<std::shared_ptr<ConstantBuffer<T>>, Buffer::BufferError> CreateConstantBuffer() const;
@@ -33,17 +37,64 @@ namespace Prism::Gfx
 			std::span<const u32> indices,
 			const Mesh::MeshDesc& desc = Mesh::MeshDesc{}) const;
 
+		// One mesh per submesh, all drawing from a single vertex/index buffer pair built from the given data
+		// Buffer wide settings (topology, stride, format, dynamic, short indices) come from desc, its per mesh fields are ignored
+		NODISCARD std::expected<std::vector<std::shared_ptr<Mesh>>, Mesh::MeshError> CreateMeshes(
+			const void* vertices,
+			u32 vertexCount,
+			std::span<const u32> indices,
+			const Mesh::MeshDesc& desc,
+			std::span<const Mesh::SubmeshDesc> submeshes) const;
+
+		NODISCARD std::expected<std::shared_ptr<Material>, Material::MaterialError> CreateMaterial(const Material::MaterialDesc& desc) const;
+
+		// Vertex shaders use the given input layout when provided, otherwise it is reflected from the bytecode
 		template <Shader::Type T>
-		NODISCARD std::expected<std::shared_ptr<Shader>, Shader::ShaderError> CreateShader(const fs::path& path) const;
+		NODISCARD std::expected<std::shared_ptr<Shader>, Shader::ShaderError> CreateShader(const fs::path& path, std::span<const D3D11_INPUT_ELEMENT_DESC> inputLayout = {}) const;
 
 		NODISCARD std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> CreateTexture2D(const Texture2D::Texture2DDesc& desc, const void* pixelData = nullptr, const u32 rowPitch = 0) const;
+
+		// Initializes every subresource (mip levels of each array slice, slice major) from the given data
+		NODISCARD std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> CreateTexture2D(
+			const Texture2D::Texture2DDesc& desc,
+			std::span<const D3D11_SUBRESOURCE_DATA> subresources) const;
 		NODISCARD std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> CreateTextureFromWIC(const byte* data, u32 dataSize) const;
 
+		// Replaces the resource and view behind an existing single slice texture with a mip chain ending at the same
+		// smallest level, holders of the texture see the new view the next time they read it. The first topLevels.size()
+		// levels are uploaded from the given data, the others are copied on the GPU from the matching levels of the
+		// current chain, so growing or trimming a chain only uploads the levels it gains
+		// The texture is left untouched on failure
+		NODISCARD std::expected<void, Texture2D::TextureError> RecreateMipChain(
+			Texture2D& texture,
+			const Texture2D::Texture2DDesc& desc,
+			std::span<const D3D11_SUBRESOURCE_DATA> topLevels) const;
+
+		// Uploads a DDS or KTX2 file as stored, every mip level and array slice (cube faces included) straight from the file data
+		NODISCARD std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> CreateTextureFromContainer(std::span<const byte> data) const;
+
+		// Textures created on this device that importers share across models, see MeshImporter::ImportSettings::TextureCache
+		NODISCARD inline TextureCache& GetTextureCache() { return *m_textureCache; }
+		NODISCARD inline const TextureCache& GetTextureCache() const { return *m_textureCache; }
+
+		// White untextured material, Model::Render binds it for meshes that have no material of their own
+		NODISCARD inline const std::shared_ptr<Material>& GetDefaultMaterial() const { return m_defaultMaterial; }
+
+		// Mip streaming of the textures it creates, see MeshImporter::ImportSettings::Streamer
+		NODISCARD inline TextureStreamer& GetTextureStreamer() { return *m_textureStreamer; }
+		NODISCARD inline const TextureStreamer& GetTextureStreamer() const { return *m_textureStreamer; }
+
 	private:
+		NODISCARD std::expected<std::shared_ptr<IndexBuffer>, Buffer::BufferError> CreateIndexBuffer(
+			const void* indexData, const u32 indexCount, const DXGI_FORMAT format, bool isDynamic) const;
 		NODISCARD std::expected<void, Shader::ShaderError> CreateInputLayoutFromVS(Shader::VertexShaderData* vsData) const;
+		NODISCARD std::expected<void, Shader::ShaderError> CreateInputLayoutFromDesc(Shader::VertexShaderData* vsData, std::span<const D3D11_INPUT_ELEMENT_DESC> inputLayout) const;
 
 	private:
 		const Core::Device* m_device;
+		std::unique_ptr<TextureCache> m_textureCache;
+		std::unique_ptr<TextureStreamer> m_textureStreamer;
+		std::shared_ptr<Material> m_defaultMaterial;
 	};
 
 	template <typename VertexType>
@@ -87,7 +138,7 @@ namespace Prism::Gfx
 	}
 
 	template <Shader::Type T>
-	std::expected<std::shared_ptr<Shader>, Shader::ShaderError> ResourceFactory::CreateShader(const fs::path& path) const
+	std::expected<std::shared_ptr<Shader>, Shader::ShaderError> ResourceFactory::CreateShader(const fs::path& path, MAYBE_UNUSED std::span<const D3D11_INPUT_ELEMENT_DESC> inputLayout) const
 	{
 		std::shared_ptr<Shader> shader = std::make_shared<Shader>(T, path);
 
@@ -127,8 +178,12 @@ namespace Prism::Gfx
 					"Failed to create vertex shader"));
 			}
 
-			// Create input layout from compiled vertex shader
-			if (auto createILResult = CreateInputLayoutFromVS(&vsData); !createILResult)
+			// Create input layout from the given description or from the compiled vertex shader
+			auto createILResult = inputLayout.empty()
+				? CreateInputLayoutFromVS(&vsData)
+				: CreateInputLayoutFromDesc(&vsData, inputLayout);
+
+			if (!createILResult)
 			{
 				return std::unexpected(createILResult.error());
 			}
@@ -0,0 +1,81 @@
+#include "Graphics/Utils/TextureCache.h"
+#include "Graphics/Resources/Texture2D.h"
+#include "Graphics/Utils/TextureFormat.h"
+#include <algorithm>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		u64 GetTextureBytes(const Texture2D& texture)
+		{
+			D3D11_TEXTURE2D_DESC1 desc{};
+			texture.GetTexture()->GetDesc1(&desc);
+			return GetChainSize(desc.Format, desc.Width, desc.Height, desc.MipLevels) * desc.ArraySize;
+		}
+	}
+
+	std::shared_ptr<Texture2D> TextureCache::Find(const u64 key, const u64 sourceBytes)
+	{
+		std::scoped_lock lock(m_mutex);
+
+		if (auto it = m_entries.find(key); it != m_entries.end() && it->second.SourceBytes == sourceBytes)
+		{
+			if (std::shared_ptr<Texture2D> texture = it->second.Texture.lock())
+			{
+				m_stats.Hits++;
+				m_stats.BytesSaved += sourceBytes + it->second.UploadBytes;
+				return texture;
+			}
+		}
+
+		m_stats.Misses++;
+		return nullptr;
+	}
+
+	void TextureCache::Insert(const u64 key, const u64 sourceBytes, const std::shared_ptr<Texture2D>& texture)
+	{
+		const u64 uploadBytes = texture ? GetTextureBytes(*texture) : 0;
+
+		std::scoped_lock lock(m_mutex);
+
+		m_entries[key] = Entry{ .Texture = texture, .SourceBytes = sourceBytes, .UploadBytes = uploadBytes };
+		if (m_entries.size() >= m_pruneThreshold)
+		{
+			PruneExpired();
+		}
+	}
+
+	TextureCache::Stats TextureCache::GetStats() const
+	{
+		std::scoped_lock lock(m_mutex);
+		return m_stats;
+	}
+
+	size_t TextureCache::GetLiveCount() const
+	{
+		std::scoped_lock lock(m_mutex);
+		return static_cast<size_t>(std::ranges::count_if(m_entries, [](const auto& entry) { return !entry.second.Texture.expired(); }));
+	}
+
+	void TextureCache::ResetStats()
+	{
+		std::scoped_lock lock(m_mutex);
+		m_stats = Stats{};
+	}
+
+	void TextureCache::Clear()
+	{
+		std::scoped_lock lock(m_mutex);
+		m_entries.clear();
+		m_pruneThreshold = 64;
+	}
+
+	void TextureCache::PruneExpired()
+	{
+		std::erase_if(m_entries, [](const auto& entry) { return entry.second.Texture.expired(); });
+
+		// Doubling keeps pruning amortized constant per insert while many textures are alive
+		m_pruneThreshold = std::max<size_t>(64, m_entries.size() * 2);
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Prism::Gfx
+{
+	class Texture2D;
+
+	// Textures created from identical source images, keyed by an XXH64 of the source and of how it was cooked, so models
+	// sharing an image share one Texture2D. Lookups happen before any decode, a hit skips both the cook and the upload
+	// Entries are weak: a texture is released with the last model using it and the next import creates it again
+	// Lookups are thread safe, two imports missing on the same key at once both create the texture and the last insert wins
+	class TextureCache
+	{
+	public:
+		struct Stats
+		{
+			u64 Hits       = 0;
+			u64 Misses     = 0;
+			u64 BytesSaved = 0;  // Source bytes not decoded again plus texture bytes not uploaded again, over every hit
+		};
+
+	public:
+		TextureCache() = default;
+		TextureCache(const TextureCache&) = delete;
+		TextureCache& operator=(const TextureCache&) = delete;
+
+		// Counts a hit or a miss, sourceBytes guards against hash collisions between data of different sizes
+		NODISCARD std::shared_ptr<Texture2D> Find(const u64 key, const u64 sourceBytes);
+		void Insert(const u64 key, const u64 sourceBytes, const std::shared_ptr<Texture2D>& texture);
+
+		NODISCARD Stats GetStats() const;
+		NODISCARD size_t GetLiveCount() const;
+		void ResetStats();
+		void Clear();
+
+	private:
+		struct Entry
+		{
+			std::weak_ptr<Texture2D> Texture;
+			u64 SourceBytes = 0;
+			u64 UploadBytes = 0;  // Video memory of the texture when it was created
+		};
+
+		void PruneExpired();
+
+	private:
+		mutable std::mutex m_mutex;
+		std::unordered_map<u64, Entry> m_entries;
+		size_t m_pruneThreshold = 64;  // Expired entries are dropped when the map reaches this size
+		Stats m_stats;
+	};
+}
@@ -0,0 +1,476 @@
+#include "Graphics/Utils/TextureContainer.h"
+#include "Graphics/Utils/MipGenerator.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <format>
+#include <string_view>
+
+namespace Prism::Gfx
+{
+	namespace
+	{
+		constexpr u32 MakeFourCC(const char a, const char b, const char c, const char d) noexcept
+		{
+			return static_cast<u32>(static_cast<u8>(a))
+				| (static_cast<u32>(static_cast<u8>(b)) << 8)
+				| (static_cast<u32>(static_cast<u8>(c)) << 16)
+				| (static_cast<u32>(static_cast<u8>(d)) << 24);
+		}
+
+		constexpr u32 DdsMagic                = MakeFourCC('D', 'D', 'S', ' ');
+		constexpr u32 DdsFourCCDx10           = MakeFourCC('D', 'X', '1', '0');
+		constexpr u32 DdsPixelFormatAlpha     = 0x00000002;
+		constexpr u32 DdsPixelFormatFourCC    = 0x00000004;
+		constexpr u32 DdsPixelFormatRgb       = 0x00000040;
+		constexpr u32 DdsPixelFormatLuminance = 0x00020000;
+		constexpr u32 DdsFlagDepth            = 0x00800000;
+		constexpr u32 DdsCaps2CubeMap         = 0x00000200;
+		constexpr u32 DdsCaps2AllFaces        = 0x0000FC00;
+		constexpr u32 DdsCaps2Volume          = 0x00200000;
+		constexpr u32 DdsDimensionTexture2D   = 3;
+		constexpr u32 DdsMiscTextureCube      = 0x00000004;
+
+		constexpr std::array<u8, 12> Ktx2Identifier{ 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+		// D3D11 resource limits, kept here so parsing does not need the D3D headers
+		constexpr u32 MaxDimension = 16384;  // D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION
+		constexpr u32 MaxArraySize = 2048;   // D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION
+
+		struct DdsPixelFormat
+		{
+			u32 Size;
+			u32 Flags;
+			u32 FourCC;
+			u32 RgbBitCount;
+			u32 RBitMask;
+			u32 GBitMask;
+			u32 BBitMask;
+			u32 ABitMask;
+		};
+
+		struct DdsHeader
+		{
+			u32 Size;
+			u32 Flags;
+			u32 Height;
+			u32 Width;
+			u32 PitchOrLinearSize;
+			u32 Depth;
+			u32 MipMapCount;
+			u32 Reserved1[11];
+			DdsPixelFormat PixelFormat;
+			u32 Caps;
+			u32 Caps2;
+			u32 Caps3;
+			u32 Caps4;
+			u32 Reserved2;
+		};
+		static_assert(sizeof(DdsHeader) == 124);
+
+		struct DdsHeaderDx10
+		{
+			u32 DxgiFormat;
+			u32 ResourceDimension;
+			u32 MiscFlag;
+			u32 ArraySize;
+			u32 MiscFlags2;
+		};
+
+		struct Ktx2Header
+		{
+			u8  Identifier[12];
+			u32 VkFormat;
+			u32 TypeSize;
+			u32 PixelWidth;
+			u32 PixelHeight;
+			u32 PixelDepth;
+			u32 LayerCount;
+			u32 FaceCount;
+			u32 LevelCount;
+			u32 SupercompressionScheme;
+			u32 DfdByteOffset;
+			u32 DfdByteLength;
+			u32 KvdByteOffset;
+			u32 KvdByteLength;
+			u64 SgdByteOffset;
+			u64 SgdByteLength;
+		};
+		static_assert(sizeof(Ktx2Header) == 80);
+
+		struct Ktx2LevelIndex
+		{
+			u64 ByteOffset;
+			u64 ByteLength;
+			u64 UncompressedByteLength;
+		};
+
+		using ContainerError = TextureContainer::ContainerError;
+
+		std::unexpected<ContainerError> MakeError(const ContainerError::Type type, const std::string_view container, const std::string_view reason)
+		{
+			return std::unexpected(ContainerError
+			{
+				.Type      = type,
+				.ErrorCode = type == ContainerError::Type::Truncated ? E_INVALIDARG : E_FAIL,
+				.Message   = std::format("{} {} texture ({})",
+					type == ContainerError::Type::Truncated ? "Truncated"
+					: type == ContainerError::Type::Unsupported || type == ContainerError::Type::UnsupportedFormat ? "Unsupported"
+					: "Invalid",
+					container,
+					reason)
+			});
+		}
+
+		template <typename T>
+		bool Read(std::span<const byte> data, const u64 offset, T& value) noexcept
+		{
+			if (offset > data.size() || data.size() - offset < sizeof(T))
+			{
+				return false;
+			}
+
+			std::memcpy(&value, data.data() + offset, sizeof(T));
+			return true;
+		}
+
+		DXGI_FORMAT GetDdsLegacyFormat(const DdsPixelFormat& pf) noexcept
+		{
+			const auto HasMasks = [&pf](const u32 r, const u32 g, const u32 b, const u32 a)
+			{
+				return pf.RBitMask == r && pf.GBitMask == g && pf.BBitMask == b && pf.ABitMask == a;
+			};
+
+			if (pf.Flags & DdsPixelFormatFourCC)
+			{
+				switch (pf.FourCC)
+				{
+				case MakeFourCC('D', 'X', 'T', '1'): return DXGI_FORMAT_BC1_UNORM;
+				case MakeFourCC('D', 'X', 'T', '2'):
+				case MakeFourCC('D', 'X', 'T', '3'): return DXGI_FORMAT_BC2_UNORM;
+				case MakeFourCC('D', 'X', 'T', '4'):
+				case MakeFourCC('D', 'X', 'T', '5'): return DXGI_FORMAT_BC3_UNORM;
+				case MakeFourCC('A', 'T', 'I', '1'):
+				case MakeFourCC('B', 'C', '4', 'U'): return DXGI_FORMAT_BC4_UNORM;
+				case MakeFourCC('B', 'C', '4', 'S'): return DXGI_FORMAT_BC4_SNORM;
+				case MakeFourCC('A', 'T', 'I', '2'):
+				case MakeFourCC('B', 'C', '5', 'U'): return DXGI_FORMAT_BC5_UNORM;
+				case MakeFourCC('B', 'C', '5', 'S'): return DXGI_FORMAT_BC5_SNORM;
+
+				// Legacy D3DFORMAT values stored in place of a four character code
+				case 36:  return DXGI_FORMAT_R16G16B16A16_UNORM;
+				case 110: return DXGI_FORMAT_R16G16B16A16_SNORM;
+				case 111: return DXGI_FORMAT_R16_FLOAT;
+				case 112: return DXGI_FORMAT_R16G16_FLOAT;
+				case 113: return DXGI_FORMAT_R16G16B16A16_FLOAT;
+				case 114: return DXGI_FORMAT_R32_FLOAT;
+				case 115: return DXGI_FORMAT_R32G32_FLOAT;
+				case 116: return DXGI_FORMAT_R32G32B32A32_FLOAT;
+				default:  return DXGI_FORMAT_UNKNOWN;
+				}
+			}
+
+			if (pf.Flags & DdsPixelFormatRgb)
+			{
+				switch (pf.RgbBitCount)
+				{
+				case 32:
+					if (HasMasks(0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000)) return DXGI_FORMAT_R8G8B8A8_UNORM;
+					if (HasMasks(0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000)) return DXGI_FORMAT_B8G8R8A8_UNORM;
+					if (HasMasks(0x00FF0000, 0x0000FF00, 0x000000FF, 0x00000000)) return DXGI_FORMAT_B8G8R8X8_UNORM;
+					if (HasMasks(0x3FF00000, 0x000FFC00, 0x000003FF, 0xC0000000)) return DXGI_FORMAT_R10G10B10A2_UNORM;
+					if (HasMasks(0x0000FFFF, 0xFFFF0000, 0x00000000, 0x00000000)) return DXGI_FORMAT_R16G16_UNORM;
+					if (HasMasks(0xFFFFFFFF, 0x00000000, 0x00000000, 0x00000000)) return DXGI_FORMAT_R32_FLOAT;
+					break;
+				case 16:
+					if (HasMasks(0xF800, 0x07E0, 0x001F, 0x0000)) return DXGI_FORMAT_B5G6R5_UNORM;
+					if (HasMasks(0x7C00, 0x03E0, 0x001F, 0x8000)) return DXGI_FORMAT_B5G5R5A1_UNORM;
+					if (HasMasks(0x0F00, 0x00F0, 0x000F, 0xF000)) return DXGI_FORMAT_B4G4R4A4_UNORM;
+					break;
+				}
+			}
+			else if (pf.Flags & DdsPixelFormatLuminance)
+			{
+				if (pf.RgbBitCount == 8 && HasMasks(0xFF, 0, 0, 0))          return DXGI_FORMAT_R8_UNORM;
+				if (pf.RgbBitCount == 16 && HasMasks(0xFFFF, 0, 0, 0))       return DXGI_FORMAT_R16_UNORM;
+				if (pf.RgbBitCount == 16 && HasMasks(0x00FF, 0, 0, 0xFF00))  return DXGI_FORMAT_R8G8_UNORM;
+			}
+			else if (pf.Flags & DdsPixelFormatAlpha)
+			{
+				if (pf.RgbBitCount == 8) return DXGI_FORMAT_A8_UNORM;
+			}
+
+			return DXGI_FORMAT_UNKNOWN;
+		}
+
+		DXGI_FORMAT GetKtx2Format(const u32 vkFormat) noexcept
+		{
+			switch (vkFormat)
+			{
+			case 9:   return DXGI_FORMAT_R8_UNORM;                // VK_FORMAT_R8_UNORM
+			case 16:  return DXGI_FORMAT_R8G8_UNORM;              // VK_FORMAT_R8G8_UNORM
+			case 37:  return DXGI_FORMAT_R8G8B8A8_UNORM;          // VK_FORMAT_R8G8B8A8_UNORM
+			case 43:  return DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;     // VK_FORMAT_R8G8B8A8_SRGB
+			case 44:  return DXGI_FORMAT_B8G8R8A8_UNORM;          // VK_FORMAT_B8G8R8A8_UNORM
+			case 50:  return DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;     // VK_FORMAT_B8G8R8A8_SRGB
+			case 64:  return DXGI_FORMAT_R10G10B10A2_UNORM;       // VK_FORMAT_A2B10G10R10_UNORM_PACK32
+			case 70:  return DXGI_FORMAT_R16_UNORM;               // VK_FORMAT_R16_UNORM
+			case 76:  return DXGI_FORMAT_R16_FLOAT;               // VK_FORMAT_R16_SFLOAT
+			case 83:  return DXGI_FORMAT_R16G16_FLOAT;            // VK_FORMAT_R16G16_SFLOAT
+			case 91:  return DXGI_FORMAT_R16G16B16A16_UNORM;      // VK_FORMAT_R16G16B16A16_UNORM
+			case 97:  return DXGI_FORMAT_R16G16B16A16_FLOAT;      // VK_FORMAT_R16G16B16A16_SFLOAT
+			case 100: return DXGI_FORMAT_R32_FLOAT;               // VK_FORMAT_R32_SFLOAT
+			case 103: return DXGI_FORMAT_R32G32_FLOAT;            // VK_FORMAT_R32G32_SFLOAT
+			case 109: return DXGI_FORMAT_R32G32B32A32_FLOAT;      // VK_FORMAT_R32G32B32A32_SFLOAT
+			case 122: return DXGI_FORMAT_R11G11B10_FLOAT;         // VK_FORMAT_B10G11R11_UFLOAT_PACK32
+			case 123: return DXGI_FORMAT_R9G9B9E5_SHAREDEXP;      // VK_FORMAT_E5B9G9R9_UFLOAT_PACK32
+			case 131:                                             // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+			case 133: return DXGI_FORMAT_BC1_UNORM;               // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+			case 132:                                             // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+			case 134: return DXGI_FORMAT_BC1_UNORM_SRGB;          // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+			case 135: return DXGI_FORMAT_BC2_UNORM;               // VK_FORMAT_BC2_UNORM_BLOCK
+			case 136: return DXGI_FORMAT_BC2_UNORM_SRGB;          // VK_FORMAT_BC2_SRGB_BLOCK
+			case 137: return DXGI_FORMAT_BC3_UNORM;               // VK_FORMAT_BC3_UNORM_BLOCK
+			case 138: return DXGI_FORMAT_BC3_UNORM_SRGB;          // VK_FORMAT_BC3_SRGB_BLOCK
+			case 139: return DXGI_FORMAT_BC4_UNORM;               // VK_FORMAT_BC4_UNORM_BLOCK
+			case 140: return DXGI_FORMAT_BC4_SNORM;               // VK_FORMAT_BC4_SNORM_BLOCK
+			case 141: return DXGI_FORMAT_BC5_UNORM;               // VK_FORMAT_BC5_UNORM_BLOCK
+			case 142: return DXGI_FORMAT_BC5_SNORM;               // VK_FORMAT_BC5_SNORM_BLOCK
+			case 143: return DXGI_FORMAT_BC6H_UF16;               // VK_FORMAT_BC6H_UFLOAT_BLOCK
+			case 144: return DXGI_FORMAT_BC6H_SF16;               // VK_FORMAT_BC6H_SFLOAT_BLOCK
+			case 145: return DXGI_FORMAT_BC7_UNORM;               // VK_FORMAT_BC7_UNORM_BLOCK
+			case 146: return DXGI_FORMAT_BC7_UNORM_SRGB;          // VK_FORMAT_BC7_SRGB_BLOCK
+			default:  return DXGI_FORMAT_UNKNOWN;
+			}
+		}
+	}
+
+	bool TextureContainer::IsDds(std::span<const byte> data) noexcept
+	{
+		u32 magic = 0;
+		return Read(data, 0, magic) && magic == DdsMagic;
+	}
+
+	bool TextureContainer::IsKtx2(std::span<const byte> data) noexcept
+	{
+		return data.size() >= Ktx2Identifier.size() && std::memcmp(data.data(), Ktx2Identifier.data(), Ktx2Identifier.size()) == 0;
+	}
+
+	bool TextureContainer::IsContainer(std::span<const byte> data) noexcept
+	{
+		return IsDds(data) || IsKtx2(data);
+	}
+
+	std::expected<TextureContainer::Image, TextureContainer::ContainerError> TextureContainer::Parse(std::span<const byte> data)
+	{
+		if (IsDds(data))
+		{
+			return ParseDds(data);
+		}
+
+		if (IsKtx2(data))
+		{
+			return ParseKtx2(data);
+		}
+
+		return MakeError(ContainerError::Type::UnknownContainer, "container", "expected a DDS or KTX2 signature");
+	}
+
+	std::expected<TextureContainer::Image, TextureContainer::ContainerError> TextureContainer::ParseDds(std::span<const byte> data)
+	{
+		DdsHeader header{};
+		if (!Read(data, sizeof(u32), header))
+		{
+			return MakeError(ContainerError::Type::Truncated, "DDS", "header");
+		}
+
+		if (header.Size != sizeof(DdsHeader) || header.PixelFormat.Size != sizeof(DdsPixelFormat))
+		{
+			return MakeError(ContainerError::Type::InvalidHeader, "DDS", "header size");
+		}
+
+		Image image;
+		image.Width     = header.Width;
+		image.Height    = header.Height;
+		image.MipLevels = std::max(1u, header.MipMapCount);  // Many writers leave DDSD_MIPMAPCOUNT unset, trust the count
+
+		u64 dataOffset = sizeof(u32) + sizeof(DdsHeader);
+		if ((header.PixelFormat.Flags & DdsPixelFormatFourCC) && header.PixelFormat.FourCC == DdsFourCCDx10)
+		{
+			DdsHeaderDx10 extension{};
+			if (!Read(data, dataOffset, extension))
+			{
+				return MakeError(ContainerError::Type::Truncated, "DDS", "DX10 header");
+			}
+			dataOffset += sizeof(DdsHeaderDx10);
+
+			if (extension.ResourceDimension != DdsDimensionTexture2D)
+			{
+				return MakeError(ContainerError::Type::Unsupported, "DDS", "only 2D textures are loaded");
+			}
+
+			if (extension.ArraySize > MaxArraySize)
+			{
+				return MakeError(ContainerError::Type::InvalidHeader, "DDS", std::format("array size {}", extension.ArraySize));
+			}
+
+			image.Format    = static_cast<DXGI_FORMAT>(extension.DxgiFormat);
+			image.IsCubeMap = (extension.MiscFlag & DdsMiscTextureCube) != 0;
+			image.ArraySize = extension.ArraySize * (image.IsCubeMap ? 6 : 1);
+		}
+		else
+		{
+			if ((header.Caps2 & DdsCaps2Volume) || ((header.Flags & DdsFlagDepth) && header.Depth > 1))
+			{
+				return MakeError(ContainerError::Type::Unsupported, "DDS", "volume texture");
+			}
+
+			if (header.Caps2 & DdsCaps2CubeMap)
+			{
+				// D3D10+ has no partial cube maps
+				if ((header.Caps2 & DdsCaps2AllFaces) != DdsCaps2AllFaces)
+				{
+					return MakeError(ContainerError::Type::Unsupported, "DDS", "cube map without all six faces");
+				}
+				image.IsCubeMap = true;
+				image.ArraySize = 6;
+			}
+
+			image.Format = GetDdsLegacyFormat(header.PixelFormat);
+		}
+
+		if (auto result = ValidateImage(image, "DDS"); !result)
+		{
+			return std::unexpected(result.error());
+		}
+
+		// Slices are stored one after the other, each with its whole mip chain
+		image.Subresources.reserve(size_t{ image.MipLevels } * image.ArraySize);
+		for (u32 slice = 0; slice < image.ArraySize; slice++)
+		{
+			for (u32 level = 0; level < image.MipLevels; level++)
+			{
+				const SubresourceLayout layout = GetSubresourceLayout(image.Format, image.Width, image.Height, level);
+				if (dataOffset > data.size() || data.size() - dataOffset < layout.Size)
+				{
+					return MakeError(ContainerError::Type::Truncated, "DDS", std::format("slice {} level {}", slice, level));
+				}
+
+				image.Subresources.push_back(Subresource
+				{
+					.Data     = data.subspan(dataOffset, layout.Size),
+					.Width    = layout.Width,
+					.Height   = layout.Height,
+					.RowPitch = layout.RowPitch
+				});
+				dataOffset += layout.Size;
+			}
+		}
+
+		return image;
+	}
+
+	std::expected<TextureContainer::Image, TextureContainer::ContainerError> TextureContainer::ParseKtx2(std::span<const byte> data)
+	{
+		Ktx2Header header{};
+		if (!Read(data, 0, header))
+		{
+			return MakeError(ContainerError::Type::Truncated, "KTX2", "header");
+		}
+
+		if (header.SupercompressionScheme != 0)
+		{
+			return MakeError(ContainerError::Type::Unsupported, "KTX2", std::format("supercompression scheme {}", header.SupercompressionScheme));
+		}
+
+		if (header.PixelDepth > 1)
+		{
+			return MakeError(ContainerError::Type::Unsupported, "KTX2", "volume texture");
+		}
+
+		if (header.FaceCount != 1 && header.FaceCount != 6)
+		{
+			return MakeError(ContainerError::Type::InvalidHeader, "KTX2", std::format("{} faces", header.FaceCount));
+		}
+
+		if (header.LayerCount > MaxArraySize)
+		{
+			return MakeError(ContainerError::Type::InvalidHeader, "KTX2", std::format("{} layers", header.LayerCount));
+		}
+
+		Image image;
+		image.Width     = header.PixelWidth;
+		image.Height    = header.PixelHeight;
+		image.MipLevels = std::max(1u, header.LevelCount);  // 0 asks the loader to generate mips, only the base level is stored
+		image.IsCubeMap = header.FaceCount == 6;
+		image.ArraySize = std::max(1u, header.LayerCount) * header.FaceCount;
+		image.Format    = GetKtx2Format(header.VkFormat);
+
+		if (auto result = ValidateImage(image, "KTX2"); !result)
+		{
+			return std::unexpected(result.error());
+		}
+
+		// Each level holds every layer then face of that level, the level index follows the header
+		image.Subresources.resize(size_t{ image.MipLevels } * image.ArraySize);
+		for (u32 level = 0; level < image.MipLevels; level++)
+		{
+			Ktx2LevelIndex index{};
+			if (!Read(data, sizeof(Ktx2Header) + u64{ level } * sizeof(Ktx2LevelIndex), index))
+			{
+				return MakeError(ContainerError::Type::Truncated, "KTX2", "level index");
+			}
+
+			const SubresourceLayout layout = GetSubresourceLayout(image.Format, image.Width, image.Height, level);
+			if (index.ByteOffset > data.size() ||
+				index.ByteLength > data.size() - index.ByteOffset ||
+				index.ByteLength < layout.Size * image.ArraySize)
+			{
+				return MakeError(ContainerError::Type::Truncated, "KTX2", std::format("level {}", level));
+			}
+
+			for (u32 slice = 0; slice < image.ArraySize; slice++)
+			{
+				image.Subresources[size_t{ slice } * image.MipLevels + level] = Subresource
+				{
+					.Data     = data.subspan(index.ByteOffset + layout.Size * slice, layout.Size),
+					.Width    = layout.Width,
+					.Height   = layout.Height,
+					.RowPitch = layout.RowPitch
+				};
+			}
+		}
+
+		return image;
+	}
+
+	std::expected<void, TextureContainer::ContainerError> TextureContainer::ValidateImage(const Image& image, std::string_view container)
+	{
+		if (GetBitsPerPixel(image.Format) == 0)
+		{
+			return MakeError(ContainerError::Type::UnsupportedFormat, container, std::format("format {}", static_cast<u32>(image.Format)));
+		}
+
+		if (image.Width == 0 || image.Height == 0 || image.Width > MaxDimension || image.Height > MaxDimension)
+		{
+			return MakeError(ContainerError::Type::InvalidHeader, container, std::format("{}x{}", image.Width, image.Height));
+		}
+
+		if (image.MipLevels > GetMipLevelCount(image.Width, image.Height))
+		{
+			return MakeError(ContainerError::Type::InvalidHeader, container, std::format("{} mip levels", image.MipLevels));
+		}
+
+		if (image.ArraySize == 0 || image.ArraySize > MaxArraySize)
+		{
+			return MakeError(ContainerError::Type::InvalidHeader, container, std::format("array size {}", image.ArraySize));
+		}
+
+		if (image.IsCubeMap && image.Width != image.Height)
+		{
+			return MakeError(ContainerError::Type::InvalidHeader, container, "cube faces are not square");
+		}
+
+		return {};
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Graphics/Utils/TextureFormat.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/String.h>
+#include <Windows.h>
+#include <expected>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	// Reads DDS and KTX2 files that already hold GPU ready texels (block compressed or plain, with their mip chain)
+	// Nothing is decoded or copied, every subresource is a view into the given data so it can go straight to
+	// ResourceFactory::CreateTexture2D. Parsing needs no device, the data must outlive the returned image
+	class TextureContainer
+	{
+	public:
+		struct ContainerError
+		{
+			enum class Type
+			{
+				UnknownContainer,
+				InvalidHeader,
+				Truncated,
+				UnsupportedFormat,
+				Unsupported  // Valid file using features the loader does not read (volume textures, supercompression)
+			};
+
+			Type Type;
+			HRESULT ErrorCode;
+			Elos::String Message;
+		};
+
+		struct Subresource
+		{
+			std::span<const byte> Data;
+			u32 Width    = 0;
+			u32 Height   = 0;
+			u32 RowPitch = 0;  // Bytes per row of texels, or per row of 4x4 blocks
+		};
+
+		struct Image
+		{
+			u32 Width          = 0;
+			u32 Height         = 0;
+			u32 MipLevels      = 1;
+			u32 ArraySize      = 1;  // Counts faces, a cube map has 6 slices and a cube array 6 per cube
+			DXGI_FORMAT Format = DXGI_FORMAT_UNKNOWN;
+			bool IsCubeMap     = false;
+
+			// MipLevels * ArraySize entries, slice major (all levels of slice 0 first) like D3D11 subresource indices
+			std::vector<Subresource> Subresources;
+		};
+
+	public:
+		NODISCARD static bool IsDds(std::span<const byte> data) noexcept;
+		NODISCARD static bool IsKtx2(std::span<const byte> data) noexcept;
+		NODISCARD static bool IsContainer(std::span<const byte> data) noexcept;
+
+		NODISCARD static std::expected<Image, ContainerError> Parse(std::span<const byte> data);
+
+	private:
+		NODISCARD static std::expected<Image, ContainerError> ParseDds(std::span<const byte> data);
+		NODISCARD static std::expected<Image, ContainerError> ParseKtx2(std::span<const byte> data);
+		NODISCARD static std::expected<void, ContainerError> ValidateImage(const Image& image, std::string_view container);
+	};
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <dxgiformat.h>
+
+namespace Prism::Gfx
+{
+	// Where a level sits in a chain whose levels are stored back to back from level 0, rows tightly packed
+	struct SubresourceLayout
+	{
+		u64 Offset    = 0;
+		u32 Width     = 0;
+		u32 Height    = 0;
+		u32 RowPitch  = 0;  // Bytes per row of texels, or per row of 4x4 blocks
+		u64 Size      = 0;
+	};
+
+	NODISCARD bool IsBlockCompressed(const DXGI_FORMAT format) noexcept;
+
+	// 0 for formats the texture loaders do not handle (planar, video, packed 4:2:2...)
+	NODISCARD u32 GetBitsPerPixel(const DXGI_FORMAT format) noexcept;
+
+	NODISCARD SubresourceLayout GetSubresourceLayout(const DXGI_FORMAT format, const u32 width, const u32 height, const u32 level) noexcept;
+	NODISCARD u64 GetChainSize(const DXGI_FORMAT format, const u32 width, const u32 height, const u32 mipLevels) noexcept;
+}
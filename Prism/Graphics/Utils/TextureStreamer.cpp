@@ -0,0 +1,182 @@
+#include "Graphics/Utils/TextureStreamer.h"
+#include "Graphics/Utils/ResourceFactory.h"
+#include "Utils/Log.h"
+#include <algorithm>
+
+namespace Prism::Gfx
+{
+	TextureStreamer::TextureStreamer(const ResourceFactory& resourceFactory) noexcept
+		: m_resourceFactory(resourceFactory)
+	{
+	}
+
+	std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> TextureStreamer::CreateTexture(
+		const u32 width,
+		const u32 height,
+		const u32 mipLevels,
+		const DXGI_FORMAT format,
+		std::span<const byte> chain)
+	{
+		if (mipLevels == 0 || chain.size() < GetChainSize(format, width, height, mipLevels))
+		{
+			return std::unexpected(Texture2D::TextureError
+			{
+				.Type      = Texture2D::TextureError::Type::InvalidDimensions,
+				.ErrorCode = E_INVALIDARG,
+				.Message   = "Texture data is smaller than its mip chain"
+			});
+		}
+
+		const TextureResidency residency
+		{
+			.Width        = width,
+			.Height       = height,
+			.MipLevels    = mipLevels,
+			.Format       = format,
+			.ResidentMip  = 0,
+			.RequestedMip = mipLevels
+		};
+		const u32 tailMip = m_planner.GetTailMip(residency);
+
+		// D3D11 needs the top level of a block compressed texture to be made of whole blocks, whichever level that is
+		bool canStream = tailMip > 0;
+		for (u32 mip = 0; mip <= tailMip && canStream && IsBlockCompressed(format); mip++)
+		{
+			canStream = std::max(1u, width >> mip) % 4 == 0 && std::max(1u, height >> mip) % 4 == 0;
+		}
+
+		std::vector<D3D11_SUBRESOURCE_DATA> subresources;
+		const u32 topMip = canStream ? tailMip : 0;
+		auto textureResult = m_resourceFactory.CreateTexture2D(GetResidentDesc(residency, topMip, mipLevels, chain, subresources), subresources);
+		if (!textureResult || !canStream)
+		{
+			return textureResult;
+		}
+
+		StreamedTexture& streamed = m_textures.emplace_back();
+		streamed.Texture               = textureResult.value();
+		streamed.Residency             = residency;
+		streamed.Residency.ResidentMip = topMip;
+		streamed.Chain.assign(chain.begin(), chain.begin() + GetChainSize(format, width, height, mipLevels));
+
+		// An expired texture may have left its address to this one, its entry is dropped on the next update
+		m_indices[textureResult.value().get()] = static_cast<u32>(m_textures.size() - 1);
+
+		return textureResult;
+	}
+
+	void TextureStreamer::RequestScreenSize(const Texture2D* texture, const f32 projectedSize)
+	{
+		if (auto it = m_indices.find(texture); it != m_indices.end())
+		{
+			TextureResidency& residency = m_textures[it->second].Residency;
+			residency.RequestedMip = std::min(residency.RequestedMip, m_planner.GetMipForScreenSize(residency, projectedSize));
+		}
+	}
+
+	void TextureStreamer::Update()
+	{
+		// Drop textures released by every model, their chains go with them
+		const size_t textureCount = m_textures.size();
+		std::erase_if(m_textures, [](const StreamedTexture& texture) { return texture.Texture.expired(); });
+		if (m_textures.size() != textureCount)
+		{
+			m_indices.clear();
+			for (u32 i = 0; i < m_textures.size(); i++)
+			{
+				m_indices[m_textures[i].Texture.lock().get()] = i;
+			}
+		}
+
+		std::vector<TextureResidency> residencies;
+		residencies.reserve(m_textures.size());
+		for (const StreamedTexture& texture : m_textures)
+		{
+			residencies.push_back(texture.Residency);
+		}
+
+		const ResidencyPlanner::Plan plan = m_planner.PlanResidency(residencies);
+
+		m_stats = Stats
+		{
+			.TextureCount  = static_cast<u32>(m_textures.size()),
+			.ResidentBytes = 0,
+			.FullBytes     = 0,
+			.UploadBytes   = 0,
+			.EvictedBytes  = 0,
+			.DeferredCount = plan.DeferredCount,
+			.IsOverBudget  = plan.IsOverBudget
+		};
+
+		std::vector<D3D11_SUBRESOURCE_DATA> subresources;
+		for (size_t i = 0; i < m_textures.size(); i++)
+		{
+			StreamedTexture& streamed   = m_textures[i];
+			TextureResidency& residency = streamed.Residency;
+			const u32 targetMip         = plan.TargetMips[i];
+			const u64 residentBytes     = ResidencyPlanner::GetResidentBytes(residency, residency.ResidentMip);
+
+			// Recreating the texture drops the evicted levels, materials see the new view the next time they bind
+			// Only the levels that become resident are uploaded, the kept ones are copied from the old texture on the GPU
+			if (targetMip != residency.ResidentMip)
+			{
+				const std::shared_ptr<Texture2D> texture = streamed.Texture.lock();
+				const u32 uploadEnd = std::max(targetMip, residency.ResidentMip);
+				const Texture2D::Texture2DDesc desc = GetResidentDesc(residency, targetMip, uploadEnd, streamed.Chain, subresources);
+				if (auto result = m_resourceFactory.RecreateMipChain(*texture, desc, subresources); result)
+				{
+					const u64 targetBytes = ResidencyPlanner::GetResidentBytes(residency, targetMip);
+					if (targetMip < residency.ResidentMip)
+					{
+						m_stats.UploadBytes += targetBytes - residentBytes;
+					}
+					else
+					{
+						m_stats.EvictedBytes += residentBytes - targetBytes;
+					}
+					residency.ResidentMip = targetMip;
+				}
+				else
+				{
+					Log::Warn("Failed to stream texture to mip {}: {}", targetMip, result.error().Message);
+				}
+			}
+
+			m_stats.ResidentBytes += ResidencyPlanner::GetResidentBytes(residency, residency.ResidentMip);
+			m_stats.FullBytes     += ResidencyPlanner::GetResidentBytes(residency, 0);
+			residency.RequestedMip = residency.MipLevels;
+		}
+	}
+
+	Texture2D::Texture2DDesc TextureStreamer::GetResidentDesc(
+		const TextureResidency& residency,
+		const u32 topMip,
+		const u32 dataEnd,
+		std::span<const byte> chain,
+		std::vector<D3D11_SUBRESOURCE_DATA>& subresources)
+	{
+		subresources.clear();
+		for (u32 level = topMip; level < dataEnd; level++)
+		{
+			const SubresourceLayout layout = GetSubresourceLayout(residency.Format, residency.Width, residency.Height, level);
+			subresources.push_back(D3D11_SUBRESOURCE_DATA
+			{
+				.pSysMem          = chain.data() + layout.Offset,
+				.SysMemPitch      = layout.RowPitch,
+				.SysMemSlicePitch = 0
+			});
+		}
+
+		Texture2D::Texture2DDesc desc;
+		desc.Width          = std::max(1u, residency.Width >> topMip);
+		desc.Height         = std::max(1u, residency.Height >> topMip);
+		desc.Format         = residency.Format;
+		desc.Usage          = D3D11_USAGE_DEFAULT;
+		desc.BindFlags      = D3D11_BIND_SHADER_RESOURCE;
+		desc.CPUAccessFlags = 0;
+		desc.MiscFlags      = 0;
+		desc.MipLevels      = residency.MipLevels - topMip;
+		desc.ArraySize      = 1;
+		return desc;
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Graphics/Resources/Texture2D.h"
+#include "Graphics/Utils/ResidencyPlanner.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <expected>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Prism::Gfx
+{
+	class ResourceFactory;
+
+	// Streams the mips of its textures in and out of video memory under the planner budget
+	// Textures start with only their tail levels, every frame the scene requests detail from the projected size of the
+	// meshes using them (Model::RequestTextureMips) and Update recreates the textures whose resident range changed,
+	// uploading only the levels that become resident and copying the kept ones on the GPU
+	// The full chain of every texture stays in system memory so levels come back without reading the source again
+	class TextureStreamer
+	{
+	public:
+		struct Stats
+		{
+			u32 TextureCount  = 0;
+			u64 ResidentBytes = 0;
+			u64 FullBytes     = 0;  // Video memory of every texture with all its levels resident
+			u64 UploadBytes   = 0;  // Last update
+			u64 EvictedBytes  = 0;  // Last update
+			u32 DeferredCount = 0;  // Last update
+			bool IsOverBudget = false;
+		};
+
+	public:
+		explicit TextureStreamer(const ResourceFactory& resourceFactory) noexcept;
+		TextureStreamer(const TextureStreamer&) = delete;
+		TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+		// Creates a texture from a mip chain laid out as GetSubresourceLayout describes, holding only its tail levels
+		// Block compressed chains whose streamed levels are not made of whole blocks are created fully resident instead
+		NODISCARD std::expected<std::shared_ptr<Texture2D>, Texture2D::TextureError> CreateTexture(
+			const u32 width,
+			const u32 height,
+			const u32 mipLevels,
+			const DXGI_FORMAT format,
+			std::span<const byte> chain);
+
+		// Asks for enough detail to cover projectedSize pixels, the largest request of a frame wins
+		// Textures the streamer did not create are ignored
+		void RequestScreenSize(const Texture2D* texture, const f32 projectedSize);
+
+		// Plans residency from the requests made since the last update, applies it and clears the requests
+		// Textures no model references anymore are dropped first
+		void Update();
+
+		NODISCARD inline const ResidencyPlanner::Settings& GetSettings() const noexcept { return m_planner.GetSettings(); }
+		inline void SetSettings(const ResidencyPlanner::Settings& settings) noexcept { m_planner.SetSettings(settings); }
+		NODISCARD inline const Stats& GetStats() const noexcept { return m_stats; }
+
+	private:
+		struct StreamedTexture
+		{
+			std::weak_ptr<Texture2D> Texture;
+			TextureResidency Residency;
+			std::vector<byte> Chain;
+		};
+
+		// Builds the description of levels topMip to MipLevels - 1 and the data of levels topMip to dataEnd - 1
+		static Texture2D::Texture2DDesc GetResidentDesc(
+			const TextureResidency& residency,
+			const u32 topMip,
+			const u32 dataEnd,
+			std::span<const byte> chain,
+			std::vector<D3D11_SUBRESOURCE_DATA>& subresources);
+
+	private:
+		const ResourceFactory&                    m_resourceFactory;
+		ResidencyPlanner                          m_planner;
+		std::vector<StreamedTexture>              m_textures;
+		std::unordered_map<const Texture2D*, u32> m_indices;
+		Stats                                     m_stats;
+	};
+}
@@ -0,0 +1,282 @@
+#include "Graphics/VertexFormats.h"
+#include <DirectXPackedVector.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+	#include <emmintrin.h>
+	#define PRISM_VERTEX_SSE 1
+#else
+	#define PRISM_VERTEX_SSE 0
+#endif
+
+namespace Prism::Gfx
+{
+	const D3D11_INPUT_ELEMENT_DESC VertexCompact::InputElements[VertexCompact::InputElementCount] =
+	{
+		{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, 0,  D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "NORMAL",   0, DXGI_FORMAT_R16G16_SNORM,       0, 8,  D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TANGENT",  0, DXGI_FORMAT_R16G16_SNORM,       0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,       0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+	};
+
+	namespace
+	{
+		inline i16 ToSnorm16(const f32 value)
+		{
+			return static_cast<i16>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+		}
+
+		inline u16 ToUnorm16(const f32 value)
+		{
+			return static_cast<u16>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+		}
+
+		// Ref: https://knarkowicz.wordpress.com/2014/04/16/octahedron-normal-vector-encoding/
+		void EncodeOctahedral(const f32 x, const f32 y, const f32 z, i16 out[2])
+		{
+			const f32 length = std::abs(x) + std::abs(y) + std::abs(z);
+			if (length <= 0.0f)
+			{
+				out[0] = 0;
+				out[1] = 0;
+				return;
+			}
+
+			f32 u = x / length;
+			f32 v = y / length;
+			if (z < 0.0f)
+			{
+				const f32 wrappedU = (1.0f - std::abs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+				const f32 wrappedV = (1.0f - std::abs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+				u = wrappedU;
+				v = wrappedV;
+			}
+
+			out[0] = ToSnorm16(u);
+			out[1] = ToSnorm16(v);
+		}
+
+		using StandardVertex = DirectX::VertexPositionNormalTangentColorTexture;
+
+		// Float offsets of each attribute inside the 13 float standard vertex
+		constexpr u32 StandardFloats   = sizeof(StandardVertex) / sizeof(f32);
+		constexpr u32 NormalFloat      = offsetof(StandardVertex, normal) / sizeof(f32);
+		constexpr u32 TangentFloat     = offsetof(StandardVertex, tangent) / sizeof(f32);
+		constexpr u32 TexCoordFloat    = offsetof(StandardVertex, textureCoordinate) / sizeof(f32);
+		constexpr u32 InterleaveChunk  = 64 * 1024;  // Vertices per parallel task
+		static_assert(StandardFloats == 13 && NormalFloat == 3 && TangentFloat == 6 && TexCoordFloat == 11,
+			"InterleaveRange assumes the DirectXTK position/normal/tangent/color/uv layout");
+
+		inline const f32* GetElement(const f32* stream, const u32 stride, const u32 index) noexcept
+		{
+			return reinterpret_cast<const f32*>(reinterpret_cast<const byte*>(stream) + size_t{ index } * stride);
+		}
+
+		template <bool HasNormals, bool HasTangents, bool HasTexCoords>
+		void InterleaveRange(const VertexStreams& streams, StandardVertex* out, u32 first, const u32 last)
+		{
+			f32* dst = reinterpret_cast<f32*>(out);
+
+#if PRISM_VERTEX_SSE
+			// Each 16 byte store also writes the first float of the next attribute, the following store overwrites it.
+			// Stores go front to back and the last one ends exactly at the vertex end. Loads may read up to 8 bytes past
+			// the element, which stays inside the stream for every vertex but the last one, left to the scalar path
+			const __m128 zero = _mm_setzero_ps();
+			const u32 simdLast = std::min(last, streams.VertexCount - 1);
+
+			for (; first < simdLast; first++)
+			{
+				f32* vertex = dst + size_t{ first } * StandardFloats;
+
+				_mm_storeu_ps(vertex, _mm_loadu_ps(GetElement(streams.Positions, streams.PositionStride, first)));
+				_mm_storeu_ps(vertex + NormalFloat, HasNormals ? _mm_loadu_ps(GetElement(streams.Normals, streams.NormalStride, first)) : zero);
+				_mm_storeu_ps(vertex + TangentFloat, HasTangents ? _mm_loadu_ps(GetElement(streams.Tangents, streams.TangentStride, first)) : zero);
+
+				// [tangent.w, color, u, v]
+				const __m128 tail = HasTexCoords
+					? _mm_movelh_ps(zero, _mm_loadu_ps(GetElement(streams.TexCoords, streams.TexCoordStride, first)))
+					: zero;
+				_mm_storeu_ps(vertex + TangentFloat + 3, tail);
+			}
+#endif
+
+			for (; first < last; first++)
+			{
+				f32* vertex = dst + size_t{ first } * StandardFloats;
+
+				std::memset(vertex, 0, sizeof(StandardVertex));
+				std::memcpy(vertex, GetElement(streams.Positions, streams.PositionStride, first), 3 * sizeof(f32));
+				if constexpr (HasNormals)   { std::memcpy(vertex + NormalFloat, GetElement(streams.Normals, streams.NormalStride, first), 3 * sizeof(f32)); }
+				if constexpr (HasTangents)  { std::memcpy(vertex + TangentFloat, GetElement(streams.Tangents, streams.TangentStride, first), 3 * sizeof(f32)); }
+				if constexpr (HasTexCoords) { std::memcpy(vertex + TexCoordFloat, GetElement(streams.TexCoords, streams.TexCoordStride, first), 2 * sizeof(f32)); }
+			}
+		}
+
+		using InterleaveFunction = void(*)(const VertexStreams&, StandardVertex*, u32, const u32);
+
+		template <bool HasNormals, bool HasTangents>
+		InterleaveFunction SelectInterleave(const bool hasTexCoords)
+		{
+			return hasTexCoords ? &InterleaveRange<HasNormals, HasTangents, true> : &InterleaveRange<HasNormals, HasTangents, false>;
+		}
+	}
+
+	u32 GetVertexStride(const VertexFormat format) noexcept
+	{
+		switch (format)
+		{
+		case VertexFormat::Compact: return sizeof(VertexCompact);
+		case VertexFormat::Standard:
+		default:                    return sizeof(DirectX::VertexPositionNormalTangentColorTexture);
+		}
+	}
+
+	void InterleaveVertices(
+		const VertexStreams& streams,
+		std::span<DirectX::VertexPositionNormalTangentColorTexture> out,
+		const bool parallel)
+	{
+		const u32 vertexCount = std::min(streams.VertexCount, static_cast<u32>(out.size()));
+		if (vertexCount == 0 || !streams.Positions)
+		{
+			return;
+		}
+
+		InterleaveFunction interleave = nullptr;
+		if (streams.Normals)
+		{
+			interleave = streams.Tangents ? SelectInterleave<true, true>(streams.TexCoords) : SelectInterleave<true, false>(streams.TexCoords);
+		}
+		else
+		{
+			interleave = streams.Tangents ? SelectInterleave<false, true>(streams.TexCoords) : SelectInterleave<false, false>(streams.TexCoords);
+		}
+
+		// The kernel is only allowed to over read inside the stream, so it needs the real stream length
+		VertexStreams clamped = streams;
+		clamped.VertexCount = vertexCount;
+
+		if (!parallel || vertexCount <= InterleaveChunk)
+		{
+			interleave(clamped, out.data(), 0, vertexCount);
+			return;
+		}
+
+		std::vector<u32> chunks((vertexCount + InterleaveChunk - 1) / InterleaveChunk);
+		std::iota(chunks.begin(), chunks.end(), 0u);
+		std::for_each(std::execution::par, chunks.begin(), chunks.end(), [&](const u32 chunk)
+		{
+			const u32 first = chunk * InterleaveChunk;
+			interleave(clamped, out.data(), first, std::min(first + InterleaveChunk, vertexCount));
+		});
+	}
+
+	void TransformVertices(
+		std::span<DirectX::VertexPositionNormalTangentColorTexture> vertices,
+		const Matrix& transform,
+		const bool parallel)
+	{
+		constexpr size_t Stride = sizeof(StandardVertex);
+
+		const DirectX::XMMATRIX positionMatrix = transform;
+		const DirectX::XMMATRIX normalMatrix   = DirectX::XMMatrixTranspose(DirectX::XMMatrixInverse(nullptr, positionMatrix));
+
+		const auto TransformRange = [&](const size_t first, const size_t last)
+		{
+			StandardVertex* range = vertices.data() + first;
+			const size_t count    = last - first;
+			auto* tangents        = reinterpret_cast<DirectX::XMFLOAT3*>(&range->tangent);
+
+			DirectX::XMVector3TransformCoordStream(&range->position, Stride, &range->position, Stride, count, positionMatrix);
+			DirectX::XMVector3TransformNormalStream(&range->normal, Stride, &range->normal, Stride, count, normalMatrix);
+			DirectX::XMVector3TransformNormalStream(tangents, Stride, tangents, Stride, count, positionMatrix);
+
+			// Zero length normals and tangents (missing attributes) stay zero
+			for (StandardVertex* vertex = range; vertex != range + count; vertex++)
+			{
+				DirectX::XMStoreFloat3(&vertex->normal, DirectX::XMVector3Normalize(DirectX::XMLoadFloat3(&vertex->normal)));
+				auto* tangent = reinterpret_cast<DirectX::XMFLOAT3*>(&vertex->tangent);
+				DirectX::XMStoreFloat3(tangent, DirectX::XMVector3Normalize(DirectX::XMLoadFloat3(tangent)));
+			}
+		};
+
+		if (!parallel || vertices.size() <= InterleaveChunk)
+		{
+			TransformRange(0, vertices.size());
+			return;
+		}
+
+		std::vector<u32> chunks((vertices.size() + InterleaveChunk - 1) / InterleaveChunk);
+		std::iota(chunks.begin(), chunks.end(), 0u);
+		std::for_each(std::execution::par, chunks.begin(), chunks.end(), [&](const u32 chunk)
+		{
+			const size_t first = size_t{ chunk } * InterleaveChunk;
+			TransformRange(first, std::min(first + InterleaveChunk, vertices.size()));
+		});
+	}
+
+	std::span<const D3D11_INPUT_ELEMENT_DESC> GetInputLayout(const VertexFormat format) noexcept
+	{
+		switch (format)
+		{
+		case VertexFormat::Compact: return VertexCompact::InputElements;
+		case VertexFormat::Standard:
+		default:                    return {};
+		}
+	}
+
+	PositionDequantization PackCompactVertices(
+		std::span<const DirectX::VertexPositionNormalTangentColorTexture> vertices,
+		std::span<VertexCompact> out)
+	{
+		PositionDequantization dequantization;
+		if (vertices.empty() || out.size() < vertices.size())
+		{
+			return dequantization;
+		}
+
+		Vector3 minBounds = Vector3(vertices[0].position);
+		Vector3 maxBounds = minBounds;
+		for (const auto& vertex : vertices)
+		{
+			const Vector3 position(vertex.position);
+			minBounds = Vector3::Min(minBounds, position);
+			maxBounds = Vector3::Max(maxBounds, position);
+		}
+
+		const Vector3 extent = maxBounds - minBounds;
+		const Vector3 invExtent(
+			extent.x > 0.0f ? 1.0f / extent.x : 0.0f,
+			extent.y > 0.0f ? 1.0f / extent.y : 0.0f,
+			extent.z > 0.0f ? 1.0f / extent.z : 0.0f);
+
+		dequantization.Scale  = extent / 65535.0f;
+		dequantization.Offset = minBounds;
+
+		for (size_t i = 0; i < vertices.size(); i++)
+		{
+			const auto& source = vertices[i];
+			VertexCompact& packed = out[i];
+
+			const Vector3 normalized = (Vector3(source.position) - minBounds) * invExtent;
+			packed.Position[0] = ToUnorm16(normalized.x);
+			packed.Position[1] = ToUnorm16(normalized.y);
+			packed.Position[2] = ToUnorm16(normalized.z);
+			packed.Position[3] = 0;
+
+			EncodeOctahedral(source.normal.x, source.normal.y, source.normal.z, packed.Normal);
+			EncodeOctahedral(source.tangent.x, source.tangent.y, source.tangent.z, packed.Tangent);
+
+			packed.TexCoord[0] = DirectX::PackedVector::XMConvertFloatToHalf(source.textureCoordinate.x);
+			packed.TexCoord[1] = DirectX::PackedVector::XMConvertFloatToHalf(source.textureCoordinate.y);
+		}
+
+		return dequantization;
+	}
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "StandardTypes.h"
+#include "Math/Math.h"
+#include "Graphics/DX11Types.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <VertexTypes.h>
+#include <span>
+
+namespace Prism::Gfx
+{
+	enum class VertexFormat : u32
+	{
+		Standard,  // DirectX::VertexPositionNormalTangentColorTexture
+		Compact    // VertexCompact
+	};
+
+	// 20 byte vertex used by VertexFormat::Compact
+	// Positions are unorm16 inside the mesh bounds, normals/tangents are octahedral snorm16 and UVs are halfs
+	struct VertexCompact
+	{
+		u16 Position[4];  // xyz quantized, w unused
+		i16 Normal[2];
+		i16 Tangent[2];
+		u16 TexCoord[2];
+
+		static constexpr u32 InputElementCount = 4;
+		static const D3D11_INPUT_ELEMENT_DESC InputElements[InputElementCount];
+	};
+	static_assert(sizeof(VertexCompact) == 20, "Compact vertex layout must stay tightly packed");
+
+	// Maps quantized positions back to object space: position = Offset + quantized * Scale
+	struct PositionDequantization
+	{
+		Vector3 Scale  = Vector3::One;
+		Vector3 Offset = Vector3::Zero;
+	};
+
+	// Per mesh vertex shader constants (register b1) for formats that need decoding
+	struct MeshConstants
+	{
+		Vector4 PositionScale;
+		Vector4 PositionOffset;
+	};
+
+	// Separate attribute streams, null when missing. Strides are in bytes and default to the aiVector3D layout
+	// Positions/normals are float3, tangents use xyz and texture coordinates xy. Strides must cover the element
+	struct VertexStreams
+	{
+		const f32* Positions = nullptr;
+		const f32* Normals   = nullptr;
+		const f32* Tangents  = nullptr;
+		const f32* TexCoords = nullptr;
+		u32 PositionStride   = 3 * sizeof(f32);
+		u32 NormalStride     = 3 * sizeof(f32);
+		u32 TangentStride    = 3 * sizeof(f32);
+		u32 TexCoordStride   = 3 * sizeof(f32);
+		u32 VertexCount      = 0;
+	};
+
+	NODISCARD u32 GetVertexStride(const VertexFormat format) noexcept;
+
+	// Interleaves the streams into standard vertices with SSE, missing attributes, tangent w and color are zero
+	// Attribute presence is resolved once per call. Large inputs are split across the worker pool when parallel is set
+	// 'out' must hold VertexCount vertices
+	void InterleaveVertices(
+		const VertexStreams& streams,
+		std::span<DirectX::VertexPositionNormalTangentColorTexture> out,
+		const bool parallel = false);
+
+	// Applies an affine transform in place with DirectXMath's SIMD stream kernels. Normals go through the inverse
+	// transpose and tangents through the transform itself, both are renormalized. Large inputs are split across the
+	// worker pool when parallel is set
+	void TransformVertices(
+		std::span<DirectX::VertexPositionNormalTangentColorTexture> vertices,
+		const Matrix& transform,
+		const bool parallel = false);
+
+	// Explicit input layout for formats whose encoding cannot be inferred from shader reflection
+	// Returns an empty span for VertexFormat::Standard, which keeps using the reflected layout
+	NODISCARD std::span<const D3D11_INPUT_ELEMENT_DESC> GetInputLayout(const VertexFormat format) noexcept;
+
+	// Quantizes standard vertices into the compact layout. 'out' must be as large as 'vertices'
+	PositionDequantization PackCompactVertices(
+		std::span<const DirectX::VertexPositionNormalTangentColorTexture> vertices,
+		std::span<VertexCompact> out);
+}
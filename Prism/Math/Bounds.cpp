@@ -0,0 +1,176 @@
+#include "Math/Bounds.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+	#include <xmmintrin.h>
+	#define PRISM_BOUNDS_SSE 1
+#else
+	#define PRISM_BOUNDS_SSE 0
+#endif
+
+namespace Prism
+{
+	namespace
+	{
+		inline Vector3 LoadPosition(const byte* positions, const u32 stride, const u32 index) noexcept
+		{
+			Vector3 position;
+			std::memcpy(&position, positions + size_t{ index } * stride, sizeof(Vector3));
+			return position;
+		}
+
+		void ReduceMinMaxScalar(const byte* positions, const u32 first, const u32 last, const u32 stride, Vector3& inOutMin, Vector3& inOutMax) noexcept
+		{
+			for (u32 i = first; i < last; i++)
+			{
+				const Vector3 position = LoadPosition(positions, stride, i);
+				inOutMin = Vector3::Min(inOutMin, position);
+				inOutMax = Vector3::Max(inOutMax, position);
+			}
+		}
+
+		f32 ReduceMaxDistanceSquaredScalar(const byte* positions, const u32 first, const u32 last, const u32 stride, const Vector3& center) noexcept
+		{
+			f32 result = 0.0f;
+			for (u32 i = first; i < last; i++)
+			{
+				result = std::max(result, Vector3::DistanceSquared(center, LoadPosition(positions, stride, i)));
+			}
+			return result;
+		}
+
+#if PRISM_BOUNDS_SSE
+		// One position per register, lane 3 holds whatever follows the position and is ignored
+		// Reading 16 bytes needs stride >= 16, the last position is left to the scalar path so nothing past the data is read
+		// Two accumulator pairs hide the min/max latency
+		void ReduceMinMax(const byte* positions, const u32 count, const u32 stride, Vector3& outMin, Vector3& outMax) noexcept
+		{
+			outMin = LoadPosition(positions, stride, 0);
+			outMax = outMin;
+
+			const u32 vectorCount = stride >= 4 * sizeof(f32) ? count - 1 : 0;
+			if (vectorCount >= 2)
+			{
+				__m128 min0 = _mm_loadu_ps(reinterpret_cast<const f32*>(positions));
+				__m128 max0 = min0;
+				__m128 min1 = min0;
+				__m128 max1 = min0;
+
+				u32 i = 0;
+				for (; i + 2 <= vectorCount; i += 2)
+				{
+					const __m128 a = _mm_loadu_ps(reinterpret_cast<const f32*>(positions + size_t{ i } * stride));
+					const __m128 b = _mm_loadu_ps(reinterpret_cast<const f32*>(positions + size_t{ i + 1 } * stride));
+					min0 = _mm_min_ps(min0, a);
+					max0 = _mm_max_ps(max0, a);
+					min1 = _mm_min_ps(min1, b);
+					max1 = _mm_max_ps(max1, b);
+				}
+
+				alignas(16) f32 minLanes[4];
+				alignas(16) f32 maxLanes[4];
+				_mm_store_ps(minLanes, _mm_min_ps(min0, min1));
+				_mm_store_ps(maxLanes, _mm_max_ps(max0, max1));
+				outMin = Vector3(minLanes[0], minLanes[1], minLanes[2]);
+				outMax = Vector3(maxLanes[0], maxLanes[1], maxLanes[2]);
+
+				ReduceMinMaxScalar(positions, i, count, stride, outMin, outMax);
+				return;
+			}
+
+			ReduceMinMaxScalar(positions, 1, count, stride, outMin, outMax);
+		}
+
+		// Four positions per iteration, transposed so x, y and z each fill a register
+		f32 ReduceMaxDistanceSquared(const byte* positions, const u32 count, const u32 stride, const Vector3& center) noexcept
+		{
+			const u32 vectorCount = stride >= 4 * sizeof(f32) && count > 0 ? count - 1 : 0;
+			const __m128 cx = _mm_set1_ps(center.x);
+			const __m128 cy = _mm_set1_ps(center.y);
+			const __m128 cz = _mm_set1_ps(center.z);
+			__m128 maxDistance = _mm_setzero_ps();
+
+			u32 i = 0;
+			for (; i + 4 <= vectorCount; i += 4)
+			{
+				__m128 p0 = _mm_loadu_ps(reinterpret_cast<const f32*>(positions + size_t{ i + 0 } * stride));
+				__m128 p1 = _mm_loadu_ps(reinterpret_cast<const f32*>(positions + size_t{ i + 1 } * stride));
+				__m128 p2 = _mm_loadu_ps(reinterpret_cast<const f32*>(positions + size_t{ i + 2 } * stride));
+				__m128 p3 = _mm_loadu_ps(reinterpret_cast<const f32*>(positions + size_t{ i + 3 } * stride));
+				_MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+				const __m128 dx = _mm_sub_ps(p0, cx);
+				const __m128 dy = _mm_sub_ps(p1, cy);
+				const __m128 dz = _mm_sub_ps(p2, cz);
+				const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+				maxDistance = _mm_max_ps(maxDistance, distance);
+			}
+
+			alignas(16) f32 lanes[4];
+			_mm_store_ps(lanes, maxDistance);
+			const f32 vectorMax = std::max({ lanes[0], lanes[1], lanes[2], lanes[3] });
+			return std::max(vectorMax, ReduceMaxDistanceSquaredScalar(positions, i, count, stride, center));
+		}
+#else
+		void ReduceMinMax(const byte* positions, const u32 count, const u32 stride, Vector3& outMin, Vector3& outMax) noexcept
+		{
+			outMin = LoadPosition(positions, stride, 0);
+			outMax = outMin;
+			ReduceMinMaxScalar(positions, 1, count, stride, outMin, outMax);
+		}
+
+		f32 ReduceMaxDistanceSquared(const byte* positions, const u32 count, const u32 stride, const Vector3& center) noexcept
+		{
+			return ReduceMaxDistanceSquaredScalar(positions, 0, count, stride, center);
+		}
+#endif
+	}
+
+	Bounds Bounds::FromPositions(const void* positions, const u32 count, const u32 stride) noexcept
+	{
+		Bounds bounds;
+		if (!positions || count == 0)
+		{
+			return bounds;
+		}
+
+		const byte* data = static_cast<const byte*>(positions);
+
+		Vector3 boundsMin;
+		Vector3 boundsMax;
+		ReduceMinMax(data, count, stride, boundsMin, boundsMax);
+
+		const Vector3 center = (boundsMin + boundsMax) * 0.5f;
+		bounds.Box    = DirectX::BoundingBox(center, (boundsMax - boundsMin) * 0.5f);
+		bounds.Sphere = DirectX::BoundingSphere(center, std::sqrt(ReduceMaxDistanceSquared(data, count, stride, center)));
+		return bounds;
+	}
+
+	Bounds Bounds::Merge(const Bounds& other) const noexcept
+	{
+		if (other.IsEmpty())
+		{
+			return *this;
+		}
+
+		if (IsEmpty())
+		{
+			return other;
+		}
+
+		Bounds merged;
+		DirectX::BoundingBox::CreateMerged(merged.Box, Box, other.Box);
+		DirectX::BoundingSphere::CreateMerged(merged.Sphere, Sphere, other.Sphere);
+		return merged;
+	}
+
+	Bounds Bounds::Transform(const Matrix& world) const noexcept
+	{
+		Bounds transformed;
+		Box.Transform(transformed.Box, world);
+		Sphere.Transform(transformed.Sphere, world);
+		return transformed;
+	}
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "Math/Math.h"
+#include <Elos/Common/FunctionMacros.h>
+
+namespace Prism
+{
+	// Axis aligned box and bounding sphere of the same geometry. Both stay zero sized at the origin when empty
+	struct Bounds
+	{
+		DirectX::BoundingBox Box{ Vector3::Zero, Vector3::Zero };
+		DirectX::BoundingSphere Sphere{ Vector3::Zero, 0.0f };
+
+		// Bounds of 'count' float3 positions, 'stride' bytes apart. The box comes from an SSE min/max reduction,
+		// the sphere is centered on the box with the largest distance to a position as radius
+		static NODISCARD Bounds FromPositions(const void* positions, const u32 count, const u32 stride) noexcept;
+
+		// Smallest bounds enclosing both, an empty side is ignored
+		NODISCARD Bounds Merge(const Bounds& other) const noexcept;
+
+		// Box of the transformed box corners and the sphere scaled by the largest axis scale
+		NODISCARD Bounds Transform(const Matrix& world) const noexcept;
+
+		NODISCARD inline bool IsEmpty() const noexcept { return Sphere.Radius <= 0.0f && Vector3(Box.Extents) == Vector3::Zero; }
+		NODISCARD inline Vector3 GetMin() const noexcept { return Vector3(Box.Center) - Vector3(Box.Extents); }
+		NODISCARD inline Vector3 GetMax() const noexcept { return Vector3(Box.Center) + Vector3(Box.Extents); }
+	};
+}
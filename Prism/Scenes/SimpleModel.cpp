@@ -1,6 +1,5 @@
 #include "SimpleModel.h"
 #include "Application/AppEvents.h"
-#include "Application/Globals.h"
 #include "Graphics/Renderer.h"
 #include "Graphics/Utils/ResourceFactory.h"
 #include "Utils/Log.h"
@@ -35,6 +34,10 @@ namespace Prism
 		};
 
 		std::ignore = m_renderer->UpdateConstantBuffer(*m_wvpCBuffer, wvp);
+
+		Gfx::TextureStreamer& textureStreamer = m_renderer->GetResourceFactory().GetTextureStreamer();
+		m_model->RequestTextureMips(textureStreamer, *m_camera, static_cast<f32>(m_renderer->GetWindowSize().Height));
+		textureStreamer.Update();
 	}
 	
 	void SimpleModelScene::Render()
@@ -68,7 +71,7 @@ namespace Prism
 			// Draw the model
 			m_renderer->BeginEvent(L"Draw model");
 			{
-				m_model->Render(*m_renderer);
+				m_cullStats = m_model->Render(*m_renderer, *m_camera);
 			}
 			m_renderer->EndEvent();
 		}
@@ -93,7 +96,42 @@ namespace Prism
 				transform.UpdateWorldMatrix();
 			}
 			
-			ImGui::DragInt("Texture", &Globals::g_textureNumber, 1, 0, m_model->GetTextures().size() - 1);
+			ImGui::Text("Materials: %zu, Textures: %zu", m_model->GetMaterials().size(), m_model->GetTextures().size());
+
+			const Gfx::TextureCache::Stats textureCacheStats = m_renderer->GetResourceFactory().GetTextureCache().GetStats();
+			ImGui::Text("Texture cache: %llu hits, %llu misses, %.2f MB saved",
+				textureCacheStats.Hits,
+				textureCacheStats.Misses,
+				static_cast<f64>(textureCacheStats.BytesSaved) / (1024.0 * 1024.0));
+
+			Gfx::TextureStreamer& textureStreamer = m_renderer->GetResourceFactory().GetTextureStreamer();
+			Gfx::ResidencyPlanner::Settings streamingSettings = textureStreamer.GetSettings();
+			i32 budgetMB = static_cast<i32>(streamingSettings.BudgetBytes >> 20);
+			if (ImGui::DragInt("Texture Budget (MB)", &budgetMB, 1.0f, 1, 4096))
+			{
+				streamingSettings.BudgetBytes = static_cast<u64>(budgetMB) << 20;
+				textureStreamer.SetSettings(streamingSettings);
+			}
+
+			const Gfx::TextureStreamer::Stats& streamingStats = textureStreamer.GetStats();
+			ImGui::Text("Streamed textures: %u, %.2f / %.2f MB resident%s",
+				streamingStats.TextureCount,
+				static_cast<f64>(streamingStats.ResidentBytes) / (1024.0 * 1024.0),
+				static_cast<f64>(streamingStats.FullBytes) / (1024.0 * 1024.0),
+				streamingStats.IsOverBudget ? " (over budget)" : "");
+
+			f32 lodPixelError = m_model->GetLodPixelError();
+			if (ImGui::DragFloat("LOD Pixel Error", &lodPixelError, 0.1f, 0.0f, 64.0f))
+			{
+				m_model->SetLodPixelError(lodPixelError);
+			}
+
+			ImGui::Text("Triangles: %llu / %llu", m_cullStats.TrianglesSubmitted, m_cullStats.TrianglesTotal);
+
+			if (m_cullStats.MeshletsTotal > 0)
+			{
+				ImGui::Text("Meshlets: %u / %u", m_cullStats.MeshletsVisible, m_cullStats.MeshletsTotal);
+			}
 		}
 		ImGui::End();
 	}
@@ -118,15 +156,22 @@ namespace Prism
 			}
 		});
 
-		const auto& resourceFactory = m_renderer->GetResourceFactory();
+		auto& resourceFactory = m_renderer->GetResourceFactory();
 
 		Prism::Gfx::MeshImporter::ImportSettings settings{};
 		settings.FlipUVs = false;
+		settings.VertexFormat = Gfx::VertexFormat::Compact;
+		settings.BuildMeshlets = true;
+		settings.GenerateLods = true;
+		settings.UseMeshCache = true;
+		settings.TextureCache = &resourceFactory.GetTextureCache();
+		settings.Streamer = &resourceFactory.GetTextureStreamer();
 
 		if (auto modelResult = Gfx::Model::LoadFromFile(resourceFactory, AssetPath, settings); modelResult)
 		{
 			m_model = modelResult.value();
 			success = true;
+			Log::Info("Import report: {}", m_model->GetImportReport().ToJson());
 		}
 		else
 		{
@@ -141,7 +186,11 @@ namespace Prism
 
 		const auto& resourceFactory = m_renderer->GetResourceFactory();
 
-		if (auto shaderResult = resourceFactory.CreateShader<Gfx::Shader::Type::Vertex>("Shaders/SimpleModel_VS.cso"); !shaderResult)
+		// Quantized models decode their vertices in a dedicated vertex shader, the pixel shader is shared
+		const Gfx::VertexFormat vertexFormat = m_model ? m_model->GetVertexFormat() : Gfx::VertexFormat::Standard;
+		const char* vsPath = vertexFormat == Gfx::VertexFormat::Compact ? "Shaders/SimpleModelCompact_VS.cso" : "Shaders/SimpleModel_VS.cso";
+
+		if (auto shaderResult = resourceFactory.CreateShader<Gfx::Shader::Type::Vertex>(vsPath, Gfx::GetInputLayout(vertexFormat)); !shaderResult)
 		{
 			Elos::ASSERT(SUCCEEDED(shaderResult.error().ErrorCode)).Msg("Failed to create vertex shader! (Error Code: {:#x})", shaderResult.error().ErrorCode).Throw();
 		}
@@ -2,6 +2,7 @@
 #include "Application/Scene.h"
 #include "Graphics/Resources/Buffers/ConstantBuffer.h"
 #include "Graphics/Resources/Shaders/Shader.h"
+#include "Graphics/Meshlet.h"
 
 namespace Prism
 {
@@ -29,5 +30,6 @@ namespace Prism
 		std::shared_ptr<Gfx::Shader>              m_shaderVS;
 		std::shared_ptr<Gfx::Shader>              m_shaderPS;
 		ComPtr<DX11::ISamplerState>               m_linearSampler;
+		Gfx::MeshletCullStats                     m_cullStats;
 	};
 }
\ No newline at end of file
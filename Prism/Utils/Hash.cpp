@@ -0,0 +1,108 @@
+#include "Hash.h"
+#include <bit>
+#include <cstring>
+
+namespace Prism::Hash
+{
+	namespace
+	{
+		constexpr u64 Prime1 = 11400714785074694791ull;
+		constexpr u64 Prime2 = 14029467366897019727ull;
+		constexpr u64 Prime3 = 1609587929392839161ull;
+		constexpr u64 Prime4 = 9650029242287828579ull;
+		constexpr u64 Prime5 = 2870177450012600261ull;
+
+		inline u64 Read64(const byte* p) noexcept
+		{
+			u64 value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		inline u32 Read32(const byte* p) noexcept
+		{
+			u32 value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		inline u64 Round(u64 acc, const u64 input) noexcept
+		{
+			acc += input * Prime2;
+			acc  = std::rotl(acc, 31);
+			return acc * Prime1;
+		}
+
+		inline u64 MergeRound(u64 acc, const u64 value) noexcept
+		{
+			acc ^= Round(0, value);
+			return acc * Prime1 + Prime4;
+		}
+	}
+
+	u64 XXH64(const void* data, size_t size, u64 seed) noexcept
+	{
+		const byte* p   = static_cast<const byte*>(data);
+		const byte* end = p + size;
+		u64 hash;
+
+		if (size >= 32)
+		{
+			const byte* const limit = end - 32;
+			u64 v1 = seed + Prime1 + Prime2;
+			u64 v2 = seed + Prime2;
+			u64 v3 = seed;
+			u64 v4 = seed - Prime1;
+
+			do
+			{
+				v1 = Round(v1, Read64(p));      p += 8;
+				v2 = Round(v2, Read64(p));      p += 8;
+				v3 = Round(v3, Read64(p));      p += 8;
+				v4 = Round(v4, Read64(p));      p += 8;
+			} while (p <= limit);
+
+			hash = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+			hash = MergeRound(hash, v1);
+			hash = MergeRound(hash, v2);
+			hash = MergeRound(hash, v3);
+			hash = MergeRound(hash, v4);
+		}
+		else
+		{
+			hash = seed + Prime5;
+		}
+
+		hash += static_cast<u64>(size);
+
+		while (p + 8 <= end)
+		{
+			hash ^= Round(0, Read64(p));
+			hash  = std::rotl(hash, 27) * Prime1 + Prime4;
+			p += 8;
+		}
+
+		if (p + 4 <= end)
+		{
+			hash ^= static_cast<u64>(Read32(p)) * Prime1;
+			hash  = std::rotl(hash, 23) * Prime2 + Prime3;
+			p += 4;
+		}
+
+		while (p < end)
+		{
+			hash ^= static_cast<u64>(*p) * Prime5;
+			hash  = std::rotl(hash, 11) * Prime1;
+			p++;
+		}
+
+		// Final avalanche
+		hash ^= hash >> 33;
+		hash *= Prime2;
+		hash ^= hash >> 29;
+		hash *= Prime3;
+		hash ^= hash >> 32;
+
+		return hash;
+	}
+}
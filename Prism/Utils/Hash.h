@@ -0,0 +1,20 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <span>
+
+namespace Prism::Hash
+{
+	// 64-bit xxHash (XXH64) of a block of memory
+	NODISCARD u64 XXH64(const void* data, size_t size, u64 seed = 0) noexcept;
+
+	NODISCARD inline u64 XXH64(std::span<const byte> data, u64 seed = 0) noexcept
+	{
+		return XXH64(data.data(), data.size(), seed);
+	}
+
+	NODISCARD constexpr u64 Combine(u64 seed, u64 value) noexcept
+	{
+		return seed ^ (value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2));
+	}
+}
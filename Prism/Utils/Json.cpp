@@ -0,0 +1,411 @@
+#include "Json.h"
+#include <charconv>
+#include <cmath>
+#include <format>
+
+namespace Prism::Json
+{
+	class Parser
+	{
+	public:
+		static constexpr u32 MaxDepth = 256;
+
+	public:
+		explicit Parser(const std::string_view text) noexcept
+			: m_text(text)
+		{
+		}
+
+		std::expected<Value, ParseError> ParseDocument()
+		{
+			Value root;
+			if (!ParseValue(root, 0))
+			{
+				return std::unexpected(std::move(m_error));
+			}
+
+			SkipWhitespace();
+			if (m_position != m_text.size())
+			{
+				Fail(ParseError::Type::InvalidSyntax, "trailing characters after the document");
+				return std::unexpected(std::move(m_error));
+			}
+
+			return root;
+		}
+
+	private:
+		bool Fail(const ParseError::Type type, const std::string_view what)
+		{
+			m_error = ParseError
+			{
+				.Type    = type,
+				.Offset  = m_position,
+				.Message = std::format("JSON error at offset {}: {}", m_position, what)
+			};
+			return false;
+		}
+
+		void SkipWhitespace() noexcept
+		{
+			while (m_position < m_text.size())
+			{
+				const char c = m_text[m_position];
+				if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+				{
+					break;
+				}
+				m_position++;
+			}
+		}
+
+		bool Consume(const std::string_view literal) noexcept
+		{
+			if (m_text.substr(m_position, literal.size()) != literal)
+			{
+				return false;
+			}
+			m_position += literal.size();
+			return true;
+		}
+
+		bool ParseValue(Value& out, const u32 depth)
+		{
+			if (depth > MaxDepth)
+			{
+				return Fail(ParseError::Type::TooDeep, "nesting too deep");
+			}
+
+			SkipWhitespace();
+			if (m_position >= m_text.size())
+			{
+				return Fail(ParseError::Type::UnexpectedEnd, "expected a value");
+			}
+
+			switch (m_text[m_position])
+			{
+			case '{': return ParseObject(out, depth);
+			case '[': return ParseArray(out, depth);
+			case '"':
+				out.m_type = Value::Type::String;
+				return ParseString(out.m_string);
+			case 't':
+			case 'f':
+				out.m_type = Value::Type::Bool;
+				out.m_bool = m_text[m_position] == 't';
+				return Consume(out.m_bool ? "true" : "false") || Fail(ParseError::Type::InvalidSyntax, "invalid literal");
+			case 'n':
+				out.m_type = Value::Type::Null;
+				return Consume("null") || Fail(ParseError::Type::InvalidSyntax, "invalid literal");
+			default:
+				return ParseNumber(out);
+			}
+		}
+
+		bool ParseObject(Value& out, const u32 depth)
+		{
+			out.m_type = Value::Type::Object;
+			m_position++;  // '{'
+
+			SkipWhitespace();
+			if (Consume("}"))
+			{
+				return true;
+			}
+
+			while (true)
+			{
+				SkipWhitespace();
+				if (m_position >= m_text.size() || m_text[m_position] != '"')
+				{
+					return Fail(ParseError::Type::InvalidSyntax, "expected a member name");
+				}
+
+				Member& member = out.m_members.emplace_back();
+				if (!ParseString(member.Key))
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+				if (!Consume(":"))
+				{
+					return Fail(ParseError::Type::InvalidSyntax, "expected ':'");
+				}
+
+				if (!ParseValue(member.Value, depth + 1))
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+				if (Consume("}"))
+				{
+					return true;
+				}
+				if (!Consume(","))
+				{
+					return Fail(ParseError::Type::InvalidSyntax, "expected ',' or '}'");
+				}
+			}
+		}
+
+		bool ParseArray(Value& out, const u32 depth)
+		{
+			out.m_type = Value::Type::Array;
+			m_position++;  // '['
+
+			SkipWhitespace();
+			if (Consume("]"))
+			{
+				return true;
+			}
+
+			while (true)
+			{
+				if (!ParseValue(out.m_array.emplace_back(), depth + 1))
+				{
+					return false;
+				}
+
+				SkipWhitespace();
+				if (Consume("]"))
+				{
+					return true;
+				}
+				if (!Consume(","))
+				{
+					return Fail(ParseError::Type::InvalidSyntax, "expected ',' or ']'");
+				}
+			}
+		}
+
+		bool ParseHex4(u32& out) noexcept
+		{
+			if (m_position + 4 > m_text.size())
+			{
+				return false;
+			}
+
+			const char* first = m_text.data() + m_position;
+			const auto [end, ec] = std::from_chars(first, first + 4, out, 16);
+			if (ec != std::errc{} || end != first + 4)
+			{
+				return false;
+			}
+
+			m_position += 4;
+			return true;
+		}
+
+		static void AppendUtf8(Elos::String& out, const u32 codePoint)
+		{
+			if (codePoint < 0x80)
+			{
+				out.push_back(static_cast<char>(codePoint));
+			}
+			else if (codePoint < 0x800)
+			{
+				out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+				out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+			}
+			else if (codePoint < 0x10000)
+			{
+				out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+				out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+			}
+			else
+			{
+				out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+				out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+			}
+		}
+
+		bool ParseString(Elos::String& out)
+		{
+			m_position++;  // '"'
+
+			while (m_position < m_text.size())
+			{
+				// Copy unescaped runs in one go
+				const size_t runStart = m_position;
+				while (m_position < m_text.size() && m_text[m_position] != '"' && m_text[m_position] != '\\')
+				{
+					if (static_cast<unsigned char>(m_text[m_position]) < 0x20)
+					{
+						return Fail(ParseError::Type::InvalidSyntax, "control character in string");
+					}
+					m_position++;
+				}
+				out.append(m_text.substr(runStart, m_position - runStart));
+
+				if (m_position >= m_text.size())
+				{
+					break;
+				}
+
+				if (m_text[m_position++] == '"')
+				{
+					return true;
+				}
+
+				if (m_position >= m_text.size())
+				{
+					break;
+				}
+
+				const char escape = m_text[m_position++];
+				switch (escape)
+				{
+				case '"':  out.push_back('"');  break;
+				case '\\': out.push_back('\\'); break;
+				case '/':  out.push_back('/');  break;
+				case 'b':  out.push_back('\b'); break;
+				case 'f':  out.push_back('\f'); break;
+				case 'n':  out.push_back('\n'); break;
+				case 'r':  out.push_back('\r'); break;
+				case 't':  out.push_back('\t'); break;
+				case 'u':
+				{
+					u32 codePoint = 0;
+					if (!ParseHex4(codePoint))
+					{
+						return Fail(ParseError::Type::InvalidSyntax, "invalid \\u escape");
+					}
+
+					// Surrogate pairs encode code points above the BMP
+					if (codePoint >= 0xD800 && codePoint < 0xDC00)
+					{
+						u32 low = 0;
+						if (!Consume("\\u") || !ParseHex4(low) || low < 0xDC00 || low > 0xDFFF)
+						{
+							return Fail(ParseError::Type::InvalidSyntax, "unpaired surrogate");
+						}
+						codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+					}
+
+					AppendUtf8(out, codePoint);
+					break;
+				}
+				default:
+					return Fail(ParseError::Type::InvalidSyntax, "invalid escape");
+				}
+			}
+
+			return Fail(ParseError::Type::UnexpectedEnd, "unterminated string");
+		}
+
+		bool ParseNumber(Value& out)
+		{
+			const char* first = m_text.data() + m_position;
+			const char* last  = m_text.data() + m_text.size();
+
+			// from_chars rejects the leading '+' JSON also rejects, but accepts "inf"/"nan" which JSON does not
+			if (*first != '-' && (*first < '0' || *first > '9'))
+			{
+				return Fail(ParseError::Type::InvalidSyntax, "unexpected character");
+			}
+
+			const auto [end, ec] = std::from_chars(first, last, out.m_number);
+			if (ec != std::errc{} || !std::isfinite(out.m_number))
+			{
+				return Fail(ParseError::Type::InvalidSyntax, "invalid number");
+			}
+
+			out.m_type = Value::Type::Number;
+			m_position += static_cast<size_t>(end - first);
+			return true;
+		}
+
+	private:
+		std::string_view m_text;
+		size_t m_position = 0;
+		ParseError m_error{};
+	};
+
+	bool Value::AsBool(const bool fallback) const noexcept
+	{
+		return m_type == Type::Bool ? m_bool : fallback;
+	}
+
+	f64 Value::AsNumber(const f64 fallback) const noexcept
+	{
+		return m_type == Type::Number ? m_number : fallback;
+	}
+
+	u32 Value::AsU32(const u32 fallback) const noexcept
+	{
+		if (m_type != Type::Number || m_number < 0.0 || m_number > 4294967295.0 || std::floor(m_number) != m_number)
+		{
+			return fallback;
+		}
+		return static_cast<u32>(m_number);
+	}
+
+	std::string_view Value::AsString(const std::string_view fallback) const noexcept
+	{
+		return m_type == Type::String ? std::string_view(m_string) : fallback;
+	}
+
+	std::span<const Value> Value::AsArray() const noexcept
+	{
+		return m_array;
+	}
+
+	std::span<const Member> Value::AsObject() const noexcept
+	{
+		return m_members;
+	}
+
+	const Value* Value::Find(const std::string_view key) const noexcept
+	{
+		for (const Member& member : m_members)
+		{
+			if (member.Key == key)
+			{
+				return &member.Value;
+			}
+		}
+		return nullptr;
+	}
+
+	std::expected<Value, ParseError> Parse(const std::string_view text)
+	{
+		return Parser(text).ParseDocument();
+	}
+
+	Elos::String Quote(const std::string_view text)
+	{
+		Elos::String out;
+		out.reserve(text.size() + 2);
+		out.push_back('"');
+
+		for (const char c : text)
+		{
+			switch (c)
+			{
+			case '"':  out += "\\\""; break;
+			case '\\': out += "\\\\"; break;
+			case '\n': out += "\\n"; break;
+			case '\r': out += "\\r"; break;
+			case '\t': out += "\\t"; break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20)
+				{
+					out += std::format("\\u{:04x}", static_cast<u32>(c));
+				}
+				else
+				{
+					out.push_back(c);  // UTF-8 passes through unchanged
+				}
+				break;
+			}
+		}
+
+		out.push_back('"');
+		return out;
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/String.h>
+#include <expected>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Prism::Json
+{
+	struct Member;
+
+	// Immutable JSON document node. Objects keep their members in file order and are searched linearly,
+	// which is fine for the small objects found in asset manifests
+	class Value
+	{
+	public:
+		enum class Type : u8
+		{
+			Null,
+			Bool,
+			Number,
+			String,
+			Array,
+			Object
+		};
+
+	public:
+		NODISCARD inline Type GetType() const noexcept { return m_type; }
+		NODISCARD inline bool IsNull() const noexcept { return m_type == Type::Null; }
+		NODISCARD inline bool IsNumber() const noexcept { return m_type == Type::Number; }
+		NODISCARD inline bool IsString() const noexcept { return m_type == Type::String; }
+		NODISCARD inline bool IsArray() const noexcept { return m_type == Type::Array; }
+		NODISCARD inline bool IsObject() const noexcept { return m_type == Type::Object; }
+
+		// Typed accessors return the fallback when the value has another type
+		NODISCARD bool AsBool(const bool fallback = false) const noexcept;
+		NODISCARD f64 AsNumber(const f64 fallback = 0.0) const noexcept;
+		NODISCARD u32 AsU32(const u32 fallback = 0) const noexcept;  // Also falls back for negative or fractional numbers
+		NODISCARD std::string_view AsString(const std::string_view fallback = {}) const noexcept;
+		NODISCARD std::span<const Value> AsArray() const noexcept;
+		NODISCARD std::span<const Member> AsObject() const noexcept;
+
+		// Object member lookup, null when missing or when this is not an object
+		NODISCARD const Value* Find(const std::string_view key) const noexcept;
+
+	private:
+		friend class Parser;
+
+		Type m_type = Type::Null;
+		bool m_bool = false;
+		f64 m_number = 0.0;
+		Elos::String m_string;
+		std::vector<Value> m_array;
+		std::vector<Member> m_members;
+	};
+
+	struct Member
+	{
+		Elos::String Key;
+		Json::Value Value;
+	};
+
+	struct ParseError
+	{
+		enum class Type
+		{
+			UnexpectedEnd,
+			InvalidSyntax,
+			TooDeep
+		};
+
+		Type Type;
+		size_t Offset;
+		Elos::String Message;
+	};
+
+	NODISCARD std::expected<Value, ParseError> Parse(const std::string_view text);
+
+	// Serializes text as a quoted JSON string, escaping quotes, backslashes and control characters
+	NODISCARD Elos::String Quote(const std::string_view text);
+}
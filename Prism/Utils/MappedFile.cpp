@@ -0,0 +1,135 @@
+#include "MappedFile.h"
+#include <algorithm>
+#include <utility>
+
+namespace Prism
+{
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+		: m_file(std::exchange(other.m_file, INVALID_HANDLE_VALUE))
+		, m_mapping(std::exchange(other.m_mapping, nullptr))
+		, m_data(std::exchange(other.m_data, nullptr))
+		, m_size(std::exchange(other.m_size, 0))
+	{
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+			m_file    = std::exchange(other.m_file, INVALID_HANDLE_VALUE);
+			m_mapping = std::exchange(other.m_mapping, nullptr);
+			m_data    = std::exchange(other.m_data, nullptr);
+			m_size    = std::exchange(other.m_size, 0);
+		}
+		return *this;
+	}
+
+	MappedFile::~MappedFile() noexcept
+	{
+		Close();
+	}
+
+	std::expected<MappedFile, MappedFile::MappedFileError> MappedFile::Open(const fs::path& path)
+	{
+		MappedFile file;
+
+		file.m_file = ::CreateFileW(
+			path.c_str(),
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL,
+			nullptr);
+
+		if (file.m_file == INVALID_HANDLE_VALUE)
+		{
+			return std::unexpected(MappedFileError
+			{
+				.Type      = MappedFileError::Type::OpenFailed,
+				.ErrorCode = HRESULT_FROM_WIN32(::GetLastError()),
+				.Message   = "Failed to open file: " + path.string()
+			});
+		}
+
+		LARGE_INTEGER fileSize{};
+		if (!::GetFileSizeEx(file.m_file, &fileSize))
+		{
+			return std::unexpected(MappedFileError
+			{
+				.Type      = MappedFileError::Type::OpenFailed,
+				.ErrorCode = HRESULT_FROM_WIN32(::GetLastError()),
+				.Message   = "Failed to query file size: " + path.string()
+			});
+		}
+
+		file.m_size = static_cast<size_t>(fileSize.QuadPart);
+		if (file.m_size == 0)
+		{
+			return file;  // Empty files cannot be mapped, expose an empty view instead
+		}
+
+		file.m_mapping = ::CreateFileMappingW(file.m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!file.m_mapping)
+		{
+			return std::unexpected(MappedFileError
+			{
+				.Type      = MappedFileError::Type::MapFailed,
+				.ErrorCode = HRESULT_FROM_WIN32(::GetLastError()),
+				.Message   = "Failed to create file mapping: " + path.string()
+			});
+		}
+
+		file.m_data = static_cast<const byte*>(::MapViewOfFile(file.m_mapping, FILE_MAP_READ, 0, 0, 0));
+		if (!file.m_data)
+		{
+			return std::unexpected(MappedFileError
+			{
+				.Type      = MappedFileError::Type::MapFailed,
+				.ErrorCode = HRESULT_FROM_WIN32(::GetLastError()),
+				.Message   = "Failed to map view of file: " + path.string()
+			});
+		}
+
+		return file;
+	}
+
+	void MappedFile::Prefetch(const size_t offset, const size_t size) const noexcept
+	{
+		if (!m_data || offset >= m_size)
+		{
+			return;
+		}
+
+		WIN32_MEMORY_RANGE_ENTRY range
+		{
+			.VirtualAddress = const_cast<byte*>(m_data + offset),
+			.NumberOfBytes  = std::min(size, m_size - offset)
+		};
+		::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+	}
+
+	void MappedFile::Close() noexcept
+	{
+		if (m_data)
+		{
+			::UnmapViewOfFile(m_data);
+			m_data = nullptr;
+		}
+
+		if (m_mapping)
+		{
+			::CloseHandle(m_mapping);
+			m_mapping = nullptr;
+		}
+
+		if (m_file != INVALID_HANDLE_VALUE)
+		{
+			::CloseHandle(m_file);
+			m_file = INVALID_HANDLE_VALUE;
+		}
+
+		m_size = 0;
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "StandardTypes.h"
+#include <Elos/Common/FunctionMacros.h>
+#include <Elos/Common/String.h>
+#include <Windows.h>
+#include <expected>
+#include <filesystem>
+#include <span>
+
+namespace Prism
+{
+	namespace fs = std::filesystem;
+
+	// Read only memory mapping of an entire file
+	class MappedFile
+	{
+	public:
+		struct MappedFileError
+		{
+			enum class Type
+			{
+				OpenFailed,
+				MapFailed
+			};
+
+			Type Type;
+			HRESULT ErrorCode;
+			Elos::String Message;
+		};
+
+	public:
+		MappedFile() noexcept = default;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		~MappedFile() noexcept;
+
+		static NODISCARD std::expected<MappedFile, MappedFileError> Open(const fs::path& path);
+
+		inline NODISCARD std::span<const byte> GetData() const noexcept { return { m_data, m_size }; }
+		inline NODISCARD size_t GetSize() const noexcept { return m_size; }
+		inline NODISCARD bool IsOpen() const noexcept { return m_file != INVALID_HANDLE_VALUE; }
+
+		// Asks the OS to read [offset, offset + size) into memory ahead of use, with large asynchronous reads
+		// instead of one page fault at a time. Only a hint, ranges past the end are clamped
+		void Prefetch(const size_t offset, const size_t size) const noexcept;
+
+	private:
+		void Close() noexcept;
+
+	private:
+		HANDLE      m_file    = INVALID_HANDLE_VALUE;
+		HANDLE      m_mapping = nullptr;
+		const byte* m_data    = nullptr;
+		size_t      m_size    = 0;
+	};
+}
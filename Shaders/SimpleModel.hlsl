@@ -55,6 +55,16 @@ PSInput VSMain(VSInput input)
 
 #if defined(BUILD_AS_PS)
 
+cbuffer MaterialConstantBuffer : register(b2)
+{
+    float4 BaseColor;
+    float4 Emissive;
+    float  Metallic;
+    float  Roughness;
+    uint   HasBaseColorTexture;
+    float  Padding;
+};
+
 Texture2D MeshTexture: register(t0);
 SamplerState LinearSampler : register(s0);
 
@@ -72,14 +82,17 @@ float4 PSMain(PSInput input) : SV_Target
     float3 ambient = float3(0.3f, 0.3f, 0.3f);
     float3 lighting = ambient + diffuse;
 
-    // Get base color from vertex color
-    float4 baseColor = input.Color;
+    // Get base color from the material, modulated by its texture when it has one
+    float4 baseColor = BaseColor;
+    if (HasBaseColorTexture != 0)
+    {
+        baseColor *= MeshTexture.Sample(LinearSampler, input.TexCoord);
+    }
 
     // Apply lighting to base color
-    float4 finalColor = float4(baseColor.rgb * lighting, baseColor.a);
-    float4 finalTextureColor = MeshTexture.Sample(LinearSampler, input.TexCoord);
+    float4 finalColor = float4(baseColor.rgb * lighting + Emissive.rgb, baseColor.a);
 
-	return finalTextureColor;
+    return finalColor;
 }
 
 #endif // BUILD_AS_PS
@@ -0,0 +1,69 @@
+/*
+* Vertex shader for models imported with VertexFormat::Compact
+* Decodes quantized positions and octahedral normals, then feeds the SimpleModel pixel shader
+*/
+
+
+cbuffer ModelViewProjectionConstantBuffer : register(b0)
+{
+    matrix ModelMat;
+    matrix ViewMat;
+    matrix ProjectionMat;
+};
+
+cbuffer MeshConstantBuffer : register(b1)
+{
+    float4 PositionScale;   // Object space position = PositionOffset + quantized * PositionScale
+    float4 PositionOffset;
+};
+
+struct VSInput
+{
+    float4 Position : POSITION;   // R16G16B16A16_UNORM
+    float2 Normal   : NORMAL;     // R16G16_SNORM, octahedral
+    float2 Tangent  : TANGENT;    // R16G16_SNORM, octahedral
+    float2 TexCoord : TEXCOORD0;  // R16G16_FLOAT
+};
+
+struct PSInput
+{
+    float4 Position : SV_POSITION;
+    float3 Normal   : NORMAL;
+    float4 Color    : COLOR;
+    float2 TexCoord : TEXCOORD0;
+};
+
+float3 OctahedralDecode(float2 e)
+{
+    float3 n = float3(e.x, e.y, 1.0f - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.xy += (n.xy >= 0.0f) ? -t : t;
+    return normalize(n);
+}
+
+#if defined(BUILD_AS_VS)
+
+PSInput VSMain(VSInput input)
+{
+    PSInput output;
+
+    float3 position = PositionOffset.xyz + input.Position.xyz * PositionScale.xyz;
+
+    // Transform the vertex position from model space to projection space
+    float4 pos = float4(position, 1.0f);
+    pos = mul(pos, ModelMat);
+    pos = mul(pos, ViewMat);
+    pos = mul(pos, ProjectionMat);
+
+    output.Position = pos;
+
+    float3 normal = OctahedralDecode(input.Normal);
+    output.Normal = normalize(mul(normal, (float3x3)ModelMat));
+
+    output.Color = float4(normal, 1.0f);
+    output.TexCoord = input.TexCoord;
+
+    return output;
+}
+
+#endif // BUILD_AS_VS
@@ -0,0 +1,42 @@
+#include "Test.h"
+#include "Utils/Log.h"
+#include <exception>
+
+namespace Prism::Tests
+{
+	std::vector<TestCase>& GetTestCases()
+	{
+		static std::vector<TestCase> testCases;
+		return testCases;
+	}
+}
+
+// Headless unit tests, no device is created. Returns the number of failed test cases
+int main()
+{
+	using namespace Prism;
+
+	Log::Init();
+
+	int failed = 0;
+	for (const Tests::TestCase& testCase : Tests::GetTestCases())
+	{
+		try
+		{
+			testCase.Run();
+			continue;
+		}
+		catch (const Tests::TestFailure& failure)
+		{
+			Log::Error("{} failed: {} ({}:{})", testCase.Name, failure.Expression, failure.Location.file_name(), failure.Location.line());
+		}
+		catch (const std::exception& e)
+		{
+			Log::Error("{} failed: exception thrown: {}", testCase.Name, e.what());
+		}
+		failed++;
+	}
+
+	Log::Info("{} of {} tests passed", Tests::GetTestCases().size() - failed, Tests::GetTestCases().size());
+	return failed;
+}
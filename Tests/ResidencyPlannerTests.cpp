@@ -0,0 +1,170 @@
+#include "Test.h"
+#include "Graphics/Utils/ResidencyPlanner.h"
+#include <cmath>
+#include <limits>
+
+namespace Prism::Tests
+{
+	namespace
+	{
+		using Gfx::ResidencyPlanner;
+		using Gfx::TextureResidency;
+
+		// 1024x1024 RGBA8 with a full chain of 11 levels, the default 64 texel tail starts at level 4
+		constexpr u32 MipLevels = 11;
+		constexpr u32 TailMip   = 4;
+		constexpr u64 TailBytes = 16384 + 4096 + 1024 + 256 + 64 + 16 + 4;
+
+		constexpr u64 GetLevelBytes(const u32 level) noexcept
+		{
+			return (4ull << 20) >> (2 * level);
+		}
+
+		TextureResidency MakeTexture(const u32 residentMip, const u32 requestedMip)
+		{
+			return TextureResidency
+			{
+				.Width        = 1024,
+				.Height       = 1024,
+				.MipLevels    = MipLevels,
+				.Format       = DXGI_FORMAT_R8G8B8A8_UNORM,
+				.ResidentMip  = residentMip,
+				.RequestedMip = requestedMip
+			};
+		}
+
+		ResidencyPlanner MakePlanner(const u64 budgetBytes, const u64 maxUploadBytes = std::numeric_limits<u64>::max())
+		{
+			return ResidencyPlanner(ResidencyPlanner::Settings{ .BudgetBytes = budgetBytes, .MaxUploadBytes = maxUploadBytes });
+		}
+	}
+
+	PRISM_TEST(ResidencyMipSelection)
+	{
+		const ResidencyPlanner planner;
+		const TextureResidency texture = MakeTexture(MipLevels, 0);
+
+		PRISM_CHECK(planner.GetTailMip(texture) == TailMip);
+		PRISM_CHECK(ResidencyPlanner::GetResidentBytes(texture, TailMip) == TailBytes);
+		PRISM_CHECK(ResidencyPlanner::GetResidentBytes(texture, 0) == TailBytes + GetLevelBytes(0) + GetLevelBytes(1) + GetLevelBytes(2) + GetLevelBytes(3));
+		PRISM_CHECK(ResidencyPlanner::GetResidentBytes(texture, MipLevels) == 0);
+
+		PRISM_CHECK(planner.GetMipForScreenSize(texture, 1024.0f) == 0);
+		PRISM_CHECK(planner.GetMipForScreenSize(texture, 256.0f) == 2);
+		PRISM_CHECK(planner.GetMipForScreenSize(texture, 300.0f) == 1);
+		PRISM_CHECK(planner.GetMipForScreenSize(texture, 4096.0f) == 0);
+		PRISM_CHECK(planner.GetMipForScreenSize(texture, std::numeric_limits<f32>::infinity()) == 0);
+
+		// Requests never go above the tail, and surfaces that were not drawn only need the tail
+		PRISM_CHECK(planner.GetMipForScreenSize(texture, 10.0f) == TailMip);
+		PRISM_CHECK(planner.GetMipForScreenSize(texture, 0.0f) == TailMip);
+		PRISM_CHECK(planner.GetMipForScreenSize(texture, std::nanf("")) == TailMip);
+
+		const ResidencyPlanner biased(ResidencyPlanner::Settings{ .MipBias = 1.0f });
+		PRISM_CHECK(biased.GetMipForScreenSize(texture, 1024.0f) == 1);
+
+		// A texture smaller than the tail is all tail
+		TextureResidency small = MakeTexture(0, 0);
+		small.Width     = 32;
+		small.Height    = 16;
+		small.MipLevels = 6;
+		PRISM_CHECK(planner.GetTailMip(small) == 0);
+	}
+
+	PRISM_TEST(ResidencyTailsStayOverBudget)
+	{
+		const std::vector<TextureResidency> textures{ MakeTexture(MipLevels, 0), MakeTexture(MipLevels, 2) };
+
+		const ResidencyPlanner::Plan plan = MakePlanner(TailBytes).PlanResidency(textures);
+		PRISM_CHECK(plan.IsOverBudget);
+		PRISM_CHECK(plan.TargetMips[0] == TailMip && plan.TargetMips[1] == TailMip);
+		PRISM_CHECK(plan.ResidentBytes == 2 * TailBytes);
+		PRISM_CHECK(plan.UploadBytes == 2 * TailBytes);
+		PRISM_CHECK(plan.EvictedBytes == 0);
+		PRISM_CHECK(plan.DeferredCount == 2);
+
+		// Resident detail above the tails is evicted, the tails themselves never are
+		const std::vector<TextureResidency> resident{ MakeTexture(0, 0) };
+		const ResidencyPlanner::Plan evicted = MakePlanner(TailBytes / 2).PlanResidency(resident);
+		PRISM_CHECK(evicted.IsOverBudget);
+		PRISM_CHECK(evicted.TargetMips[0] == TailMip);
+		PRISM_CHECK(evicted.EvictedBytes == ResidencyPlanner::GetResidentBytes(resident[0], 0) - TailBytes);
+
+		const ResidencyPlanner::Plan fits = MakePlanner(2 * TailBytes).PlanResidency(textures);
+		PRISM_CHECK(!fits.IsOverBudget);
+	}
+
+	PRISM_TEST(ResidencyUploadLimit)
+	{
+		const u64 budget = 64ull << 20;
+
+		// Level 3 fits the limit, level 2 would go over it and waits for the next plan
+		const std::vector<TextureResidency> one{ MakeTexture(TailMip, 0) };
+		const ResidencyPlanner::Plan limited = MakePlanner(budget, GetLevelBytes(3) + GetLevelBytes(2) - 1).PlanResidency(one);
+		PRISM_CHECK(limited.TargetMips[0] == 3);
+		PRISM_CHECK(limited.UploadBytes == GetLevelBytes(3));
+		PRISM_CHECK(limited.DeferredCount == 1);
+
+		// The first upload of a plan always passes, even when the level alone is larger than the limit
+		const std::vector<TextureResidency> large{ MakeTexture(1, 0), MakeTexture(1, 0) };
+		const ResidencyPlanner::Plan first = MakePlanner(budget, 1024).PlanResidency(large);
+		PRISM_CHECK(first.TargetMips[0] == 0);
+		PRISM_CHECK(first.TargetMips[1] == 1);
+		PRISM_CHECK(first.UploadBytes == GetLevelBytes(0));
+		PRISM_CHECK(first.DeferredCount == 1);
+
+		// Levels that are already resident cost no upload
+		const std::vector<TextureResidency> resident{ MakeTexture(0, 0) };
+		const ResidencyPlanner::Plan kept = MakePlanner(budget, 0).PlanResidency(resident);
+		PRISM_CHECK(kept.TargetMips[0] == 0);
+		PRISM_CHECK(kept.UploadBytes == 0 && kept.EvictedBytes == 0 && kept.DeferredCount == 0);
+	}
+
+	PRISM_TEST(ResidencyGapFirstFairness)
+	{
+		// Budget for both tails, levels 3 and 2 of both textures and one byte short of a level 1 on top
+		// Serving one texture at a time would bring the first to level 1 and leave the second at level 3
+		const u64 budget = 2 * TailBytes + 2 * (GetLevelBytes(3) + GetLevelBytes(2)) + GetLevelBytes(1) - 1;
+		const std::vector<TextureResidency> textures{ MakeTexture(TailMip, 0), MakeTexture(TailMip, 0) };
+
+		const ResidencyPlanner::Plan plan = MakePlanner(budget).PlanResidency(textures);
+		PRISM_CHECK(plan.TargetMips[0] == 2 && plan.TargetMips[1] == 2);
+		PRISM_CHECK(plan.DeferredCount == 2);
+		PRISM_CHECK(plan.UploadBytes == 2 * (GetLevelBytes(3) + GetLevelBytes(2)));
+
+		// The texture furthest from its request goes first. Once both are two levels away the cheaper level 3 of the
+		// second texture goes before level 1 of the first, which then no longer fits
+		const std::vector<TextureResidency> uneven{ MakeTexture(TailMip, 0), MakeTexture(TailMip, 2) };
+		const u64 unevenBudget = 2 * TailBytes + GetLevelBytes(3) + GetLevelBytes(2) + GetLevelBytes(1);
+		const ResidencyPlanner::Plan unevenPlan = MakePlanner(unevenBudget).PlanResidency(uneven);
+		PRISM_CHECK(unevenPlan.TargetMips[0] == 2 && unevenPlan.TargetMips[1] == 2);
+		PRISM_CHECK(unevenPlan.DeferredCount == 1);
+	}
+
+	PRISM_TEST(ResidencyKeepsDetailWithinBudget)
+	{
+		// Nothing draws the texture any more, its resident levels stay while the budget has room for them
+		const std::vector<TextureResidency> unused{ MakeTexture(0, MipLevels) };
+		const ResidencyPlanner::Plan kept = MakePlanner(64ull << 20).PlanResidency(unused);
+		PRISM_CHECK(kept.TargetMips[0] == 0);
+		PRISM_CHECK(kept.EvictedBytes == 0 && kept.UploadBytes == 0 && kept.DeferredCount == 0);
+
+		const u64 budget = ResidencyPlanner::GetResidentBytes(unused[0], 1);
+		const ResidencyPlanner::Plan trimmed = MakePlanner(budget).PlanResidency(unused);
+		PRISM_CHECK(trimmed.TargetMips[0] == 1);
+		PRISM_CHECK(trimmed.EvictedBytes == GetLevelBytes(0));
+		PRISM_CHECK(trimmed.ResidentBytes == budget);
+
+		// Requests are served before leftover detail is kept, then the texture asking for more detail keeps its
+		// levels first. The second texture keeps level 1 but not level 0, the unused first one only keeps level 3
+		const std::vector<TextureResidency> textures{ MakeTexture(0, MipLevels), MakeTexture(0, 2) };
+		const u64 sharedBudget = 2 * TailBytes + GetLevelBytes(3) + GetLevelBytes(2) + GetLevelBytes(1) + GetLevelBytes(3);
+		const ResidencyPlanner::Plan shared = MakePlanner(sharedBudget).PlanResidency(textures);
+		PRISM_CHECK(shared.TargetMips[1] == 1);
+		PRISM_CHECK(shared.TargetMips[0] == 3);
+		PRISM_CHECK(shared.UploadBytes == 0);
+		PRISM_CHECK(shared.EvictedBytes == GetLevelBytes(0) * 2 + GetLevelBytes(1) + GetLevelBytes(2));
+		PRISM_CHECK(shared.ResidentBytes == sharedBudget);
+		PRISM_CHECK(shared.DeferredCount == 0);
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <source_location>
+#include <string_view>
+#include <vector>
+
+namespace Prism::Tests
+{
+	// Minimal self registering test cases for code that runs without a device. A failed check throws, ending
+	// its test case, and the runner reports it and moves on to the next one
+	struct TestCase
+	{
+		std::string_view Name;
+		void (*Run)();
+	};
+
+	struct TestFailure
+	{
+		std::string_view Expression;
+		std::source_location Location;
+	};
+
+	std::vector<TestCase>& GetTestCases();
+
+	struct TestRegistrar
+	{
+		TestRegistrar(const std::string_view name, void (*run)())
+		{
+			GetTestCases().push_back(TestCase{ name, run });
+		}
+	};
+
+	inline void Check(const bool condition, const std::string_view expression, const std::source_location location = std::source_location::current())
+	{
+		if (!condition)
+		{
+			throw TestFailure{ expression, location };
+		}
+	}
+}
+
+#define PRISM_TEST(name)                                                               \
+	static void name();                                                                \
+	static const ::Prism::Tests::TestRegistrar name##Registrar(#name, &name);         \
+	static void name()
+
+#define PRISM_CHECK(condition) ::Prism::Tests::Check(static_cast<bool>(condition), #condition)
@@ -0,0 +1,446 @@
+#include "Test.h"
+#include "Graphics/Utils/TextureContainer.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace Prism::Tests
+{
+	namespace
+	{
+		using Gfx::TextureContainer;
+		using ErrorType = enum TextureContainer::ContainerError::Type;  // Elaborated, the member of the same name hides the type
+
+		constexpr u32 MakeFourCC(const char a, const char b, const char c, const char d) noexcept
+		{
+			return static_cast<u32>(static_cast<u8>(a))
+				| (static_cast<u32>(static_cast<u8>(b)) << 8)
+				| (static_cast<u32>(static_cast<u8>(c)) << 16)
+				| (static_cast<u32>(static_cast<u8>(d)) << 24);
+		}
+
+		constexpr u32 DdsFlagDepth          = 0x00800000;
+		constexpr u32 DdsPixelFormatFourCC  = 0x00000004;
+		constexpr u32 DdsPixelFormatRgb     = 0x00000040;
+		constexpr u32 DdsCaps2CubeMap       = 0x00000200;
+		constexpr u32 DdsCaps2AllFaces      = 0x0000FC00;
+		constexpr u32 DdsCaps2Volume        = 0x00200000;
+		constexpr u32 DdsMiscTextureCube    = 0x00000004;
+		constexpr u64 DdsHeaderSize         = 4 + 124;
+		constexpr u64 DdsHeaderDx10Size     = 20;
+		constexpr u64 Ktx2HeaderSize        = 80;
+		constexpr u64 Ktx2LevelIndexSize    = 24;
+
+		void Write(std::vector<byte>& data, const u64 offset, const void* value, const size_t size)
+		{
+			if (data.size() < offset + size)
+			{
+				data.resize(offset + size);
+			}
+			std::memcpy(data.data() + offset, value, size);
+		}
+
+		template <typename T>
+		void Write(std::vector<byte>& data, const u64 offset, const T value)
+		{
+			Write(data, offset, &value, sizeof(T));
+		}
+
+		// Payload bytes count up from 1, so a subresource view can be traced back to its offset
+		void AppendPayload(std::vector<byte>& data, const u64 size)
+		{
+			const size_t start = data.size();
+			data.resize(start + size);
+			for (size_t i = start; i < data.size(); i++)
+			{
+				data[i] = static_cast<byte>(static_cast<u8>(i * 7 + 1));
+			}
+		}
+
+		struct DdsDesc
+		{
+			u32 Width       = 16;
+			u32 Height      = 16;
+			u32 MipLevels   = 1;
+			u32 Depth       = 0;
+			u32 Flags       = 0;
+			u32 PixelFlags  = DdsPixelFormatFourCC;
+			u32 FourCC      = MakeFourCC('D', 'X', 'T', '1');
+			u32 BitCount    = 0;
+			std::array<u32, 4> Masks{};
+			u32 Caps2       = 0;
+			u32 HeaderSize  = 124;
+
+			// DX10 extension, written when FourCC is 'DX10'
+			u32 DxgiFormat  = DXGI_FORMAT_UNKNOWN;
+			u32 Dimension   = 3;
+			u32 MiscFlag    = 0;
+			u32 ArraySize   = 1;
+		};
+
+		std::vector<byte> MakeDds(const DdsDesc& desc, const u64 payloadSize)
+		{
+			std::vector<byte> data;
+			Write(data, 0, MakeFourCC('D', 'D', 'S', ' '));
+			Write(data, 4, desc.HeaderSize);
+			Write(data, 8, desc.Flags);
+			Write(data, 12, desc.Height);
+			Write(data, 16, desc.Width);
+			Write(data, 24, desc.Depth);
+			Write(data, 28, desc.MipLevels);
+			Write(data, 76, u32{ 32 });  // Pixel format size
+			Write(data, 80, desc.PixelFlags);
+			Write(data, 84, desc.FourCC);
+			Write(data, 88, desc.BitCount);
+			Write(data, 92, desc.Masks.data(), sizeof(desc.Masks));
+			Write(data, 112, desc.Caps2);
+			Write(data, 124, u32{ 0 });  // Reserved2, sizes the header to its full length
+
+			if (desc.FourCC == MakeFourCC('D', 'X', '1', '0'))
+			{
+				Write(data, DdsHeaderSize, desc.DxgiFormat);
+				Write(data, DdsHeaderSize + 4, desc.Dimension);
+				Write(data, DdsHeaderSize + 8, desc.MiscFlag);
+				Write(data, DdsHeaderSize + 12, desc.ArraySize);
+				Write(data, DdsHeaderSize + 16, u32{ 0 });
+			}
+
+			AppendPayload(data, payloadSize);
+			return data;
+		}
+
+		struct Ktx2Desc
+		{
+			u32 VkFormat         = 37;  // VK_FORMAT_R8G8B8A8_UNORM
+			DXGI_FORMAT Format   = DXGI_FORMAT_R8G8B8A8_UNORM;  // Sizes the level data
+			u32 Width            = 8;
+			u32 Height           = 8;
+			u32 Depth            = 0;
+			u32 Layers           = 0;
+			u32 Faces            = 1;
+			u32 Levels           = 1;
+			u32 Supercompression = 0;
+		};
+
+		struct Ktx2File
+		{
+			std::vector<byte> Data;
+			std::vector<u64> LevelOffsets;
+		};
+
+		// Levels are stored smallest first like KTX2 writers do, so only the level index tells where each one is
+		Ktx2File MakeKtx2(const Ktx2Desc& desc)
+		{
+			static constexpr std::array<u8, 12> Identifier{ 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+			Ktx2File file;
+			std::vector<byte>& data = file.Data;
+			Write(data, 0, Identifier.data(), Identifier.size());
+			Write(data, 12, desc.VkFormat);
+			Write(data, 16, u32{ 1 });
+			Write(data, 20, desc.Width);
+			Write(data, 24, desc.Height);
+			Write(data, 28, desc.Depth);
+			Write(data, 32, desc.Layers);
+			Write(data, 36, desc.Faces);
+			Write(data, 40, desc.Levels);
+			Write(data, 44, desc.Supercompression);
+			Write(data, 72, u64{ 0 });
+
+			const u32 levels = std::max(1u, desc.Levels);
+			const u32 slices = std::max(1u, desc.Layers) * std::max(1u, desc.Faces);
+			data.resize(Ktx2HeaderSize + levels * Ktx2LevelIndexSize);
+
+			file.LevelOffsets.resize(levels);
+			for (u32 level = levels; level-- > 0;)
+			{
+				const u64 size = Gfx::GetSubresourceLayout(desc.Format, desc.Width, desc.Height, level).Size * slices;
+				file.LevelOffsets[level] = data.size();
+				Write(data, Ktx2HeaderSize + level * Ktx2LevelIndexSize, file.LevelOffsets[level]);
+				Write(data, Ktx2HeaderSize + level * Ktx2LevelIndexSize + 8, size);
+				Write(data, Ktx2HeaderSize + level * Ktx2LevelIndexSize + 16, size);
+				AppendPayload(data, size);
+			}
+			return file;
+		}
+
+		bool FailsWith(std::span<const byte> data, const ErrorType type)
+		{
+			const auto result = TextureContainer::Parse(data);
+			return !result && result.error().Type == type;
+		}
+
+		bool IsView(const TextureContainer::Subresource& subresource, std::span<const byte> data, const u64 offset, const u64 size)
+		{
+			return subresource.Data.data() == data.data() + offset && subresource.Data.size() == size;
+		}
+	}
+
+	PRISM_TEST(DdsLegacyBlockCompressedMipChain)
+	{
+		// 16x16 BC1 levels hold 16, 4, 1, 1 and 1 blocks of 8 bytes
+		const std::vector<byte> data = MakeDds(DdsDesc{ .MipLevels = 5 }, 128 + 32 + 8 + 8 + 8);
+		PRISM_CHECK(TextureContainer::IsDds(data));
+		PRISM_CHECK(!TextureContainer::IsKtx2(data));
+
+		const auto result = TextureContainer::Parse(data);
+		PRISM_CHECK(result);
+
+		const TextureContainer::Image& image = result.value();
+		PRISM_CHECK(image.Format == DXGI_FORMAT_BC1_UNORM);
+		PRISM_CHECK(image.Width == 16 && image.Height == 16);
+		PRISM_CHECK(image.MipLevels == 5 && image.ArraySize == 1 && !image.IsCubeMap);
+		PRISM_CHECK(image.Subresources.size() == 5);
+
+		PRISM_CHECK(IsView(image.Subresources[0], data, DdsHeaderSize, 128));
+		PRISM_CHECK(image.Subresources[0].RowPitch == 32);
+		PRISM_CHECK(IsView(image.Subresources[1], data, DdsHeaderSize + 128, 32));
+		PRISM_CHECK(image.Subresources[1].Width == 8 && image.Subresources[1].RowPitch == 16);
+		PRISM_CHECK(IsView(image.Subresources[3], data, DdsHeaderSize + 168, 8));
+		PRISM_CHECK(image.Subresources[3].Width == 2 && image.Subresources[3].Height == 2 && image.Subresources[3].RowPitch == 8);
+		PRISM_CHECK(IsView(image.Subresources[4], data, DdsHeaderSize + 176, 8));
+	}
+
+	PRISM_TEST(DdsLegacyUncompressedMasks)
+	{
+		const DdsDesc desc
+		{
+			.Width      = 4,
+			.Height     = 2,
+			.MipLevels  = 0,
+			.PixelFlags = DdsPixelFormatRgb,
+			.FourCC     = 0,
+			.BitCount   = 32,
+			.Masks      = { 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000 }
+		};
+		const std::vector<byte> data = MakeDds(desc, 32);
+
+		const auto result = TextureContainer::Parse(data);
+		PRISM_CHECK(result);
+		PRISM_CHECK(result->Format == DXGI_FORMAT_B8G8R8A8_UNORM);
+		PRISM_CHECK(result->MipLevels == 1);  // An unset mip count means a single level
+		PRISM_CHECK(result->Subresources.size() == 1);
+		PRISM_CHECK(IsView(result->Subresources[0], data, DdsHeaderSize, 32));
+		PRISM_CHECK(result->Subresources[0].RowPitch == 16);
+	}
+
+	PRISM_TEST(DdsDx10ArrayIsSliceMajor)
+	{
+		// 8x8 BC7 with two levels of 64 and 16 bytes per slice
+		const DdsDesc desc
+		{
+			.Width      = 8,
+			.Height     = 8,
+			.MipLevels  = 2,
+			.FourCC     = MakeFourCC('D', 'X', '1', '0'),
+			.DxgiFormat = DXGI_FORMAT_BC7_UNORM_SRGB,
+			.ArraySize  = 3
+		};
+		const std::vector<byte> data = MakeDds(desc, 3 * 80);
+
+		const auto result = TextureContainer::Parse(data);
+		PRISM_CHECK(result);
+		PRISM_CHECK(result->Format == DXGI_FORMAT_BC7_UNORM_SRGB);
+		PRISM_CHECK(result->ArraySize == 3 && result->MipLevels == 2 && !result->IsCubeMap);
+		PRISM_CHECK(result->Subresources.size() == 6);
+
+		constexpr u64 Base = DdsHeaderSize + DdsHeaderDx10Size;
+		for (u32 slice = 0; slice < 3; slice++)
+		{
+			PRISM_CHECK(IsView(result->Subresources[slice * 2], data, Base + slice * 80, 64));
+			PRISM_CHECK(IsView(result->Subresources[slice * 2 + 1], data, Base + slice * 80 + 64, 16));
+		}
+	}
+
+	PRISM_TEST(DdsCubeMaps)
+	{
+		const DdsDesc legacy
+		{
+			.Width      = 4,
+			.Height     = 4,
+			.PixelFlags = DdsPixelFormatRgb,
+			.FourCC     = 0,
+			.BitCount   = 32,
+			.Masks      = { 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000 },
+			.Caps2      = DdsCaps2CubeMap | DdsCaps2AllFaces
+		};
+		const std::vector<byte> legacyData = MakeDds(legacy, 6 * 64);
+
+		const auto legacyResult = TextureContainer::Parse(legacyData);
+		PRISM_CHECK(legacyResult);
+		PRISM_CHECK(legacyResult->IsCubeMap && legacyResult->ArraySize == 6);
+		PRISM_CHECK(legacyResult->Format == DXGI_FORMAT_R8G8B8A8_UNORM);
+		PRISM_CHECK(IsView(legacyResult->Subresources[5], legacyData, DdsHeaderSize + 5 * 64, 64));
+
+		// Two cubes in a DX10 file are twelve faces
+		const DdsDesc dx10
+		{
+			.Width      = 4,
+			.Height     = 4,
+			.FourCC     = MakeFourCC('D', 'X', '1', '0'),
+			.DxgiFormat = DXGI_FORMAT_BC1_UNORM,
+			.MiscFlag   = DdsMiscTextureCube,
+			.ArraySize  = 2
+		};
+		const auto dx10Result = TextureContainer::Parse(MakeDds(dx10, 12 * 8));
+		PRISM_CHECK(dx10Result);
+		PRISM_CHECK(dx10Result->IsCubeMap && dx10Result->ArraySize == 12 && dx10Result->Subresources.size() == 12);
+
+		DdsDesc partial = legacy;
+		partial.Caps2 = DdsCaps2CubeMap | 0x00000400;
+		PRISM_CHECK(FailsWith(MakeDds(partial, 6 * 64), ErrorType::Unsupported));
+
+		DdsDesc nonSquare = legacy;
+		nonSquare.Height = 2;
+		PRISM_CHECK(FailsWith(MakeDds(nonSquare, 6 * 32), ErrorType::InvalidHeader));
+	}
+
+	PRISM_TEST(DdsTruncated)
+	{
+		const std::vector<byte> data = MakeDds(DdsDesc{ .MipLevels = 5 }, 184);
+
+		// Every cut short of the full file fails as truncated, never reads past the end
+		for (const u64 size : { u64{ 4 }, u64{ 64 }, DdsHeaderSize - 1, DdsHeaderSize, DdsHeaderSize + 127, u64{ data.size() - 1 } })
+		{
+			const auto result = TextureContainer::Parse(std::span(data).first(size));
+			PRISM_CHECK(!result && result.error().Type == ErrorType::Truncated);
+			PRISM_CHECK(result.error().ErrorCode == E_INVALIDARG);
+		}
+
+		const DdsDesc dx10{ .FourCC = MakeFourCC('D', 'X', '1', '0'), .DxgiFormat = DXGI_FORMAT_BC1_UNORM };
+		const std::vector<byte> dx10Data = MakeDds(dx10, 128);
+		PRISM_CHECK(FailsWith(std::span(dx10Data).first(DdsHeaderSize + 10), ErrorType::Truncated));
+	}
+
+	PRISM_TEST(DdsMalformed)
+	{
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .HeaderSize = 123 }, 128), ErrorType::InvalidHeader));
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .Width = 0 }, 128), ErrorType::InvalidHeader));
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .Width = 32768 }, 128), ErrorType::InvalidHeader));
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .MipLevels = 6 }, 1024), ErrorType::InvalidHeader));
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .FourCC = MakeFourCC('A', 'B', 'C', 'D') }, 128), ErrorType::UnsupportedFormat));
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .Depth = 4, .Flags = DdsFlagDepth }, 512), ErrorType::Unsupported));
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .Caps2 = DdsCaps2Volume }, 128), ErrorType::Unsupported));
+
+		const u32 dx10 = MakeFourCC('D', 'X', '1', '0');
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .FourCC = dx10, .DxgiFormat = DXGI_FORMAT_BC1_UNORM, .Dimension = 4 }, 128), ErrorType::Unsupported));
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .FourCC = dx10, .DxgiFormat = DXGI_FORMAT_BC1_UNORM, .ArraySize = 0 }, 128), ErrorType::InvalidHeader));
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .FourCC = dx10, .DxgiFormat = DXGI_FORMAT_BC1_UNORM, .ArraySize = 4096 }, 128), ErrorType::InvalidHeader));
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .FourCC = dx10, .DxgiFormat = DXGI_FORMAT_NV12 }, 512), ErrorType::UnsupportedFormat));
+
+		// A cube array whose face count overflows the array limit
+		PRISM_CHECK(FailsWith(MakeDds(DdsDesc{ .FourCC = dx10, .DxgiFormat = DXGI_FORMAT_BC1_UNORM, .MiscFlag = DdsMiscTextureCube, .ArraySize = 400 }, 128), ErrorType::InvalidHeader));
+	}
+
+	PRISM_TEST(Ktx2LevelIndex)
+	{
+		const Ktx2File file = MakeKtx2(Ktx2Desc{ .Levels = 4 });
+		PRISM_CHECK(TextureContainer::IsKtx2(file.Data));
+		PRISM_CHECK(!TextureContainer::IsDds(file.Data));
+
+		const auto result = TextureContainer::Parse(file.Data);
+		PRISM_CHECK(result);
+		PRISM_CHECK(result->Format == DXGI_FORMAT_R8G8B8A8_UNORM);
+		PRISM_CHECK(result->Width == 8 && result->Height == 8);
+		PRISM_CHECK(result->MipLevels == 4 && result->ArraySize == 1 && !result->IsCubeMap);
+
+		// Level 0 is stored last, after the 4x4, 2x2 and 1x1 levels
+		constexpr std::array<u64, 4> Sizes{ 256, 64, 16, 4 };
+		PRISM_CHECK(file.LevelOffsets[0] == Ktx2HeaderSize + 4 * Ktx2LevelIndexSize + 84);
+		for (u32 level = 0; level < 4; level++)
+		{
+			PRISM_CHECK(IsView(result->Subresources[level], file.Data, file.LevelOffsets[level], Sizes[level]));
+			PRISM_CHECK(result->Subresources[level].Width == 8u >> level);
+			PRISM_CHECK(result->Subresources[level].RowPitch == (8u >> level) * 4);
+		}
+
+		// A level count of 0 asks for generated mips, only the base level is stored
+		const Ktx2File base = MakeKtx2(Ktx2Desc{ .Levels = 0 });
+		const auto baseResult = TextureContainer::Parse(base.Data);
+		PRISM_CHECK(baseResult && baseResult->MipLevels == 1 && baseResult->Subresources.size() == 1);
+	}
+
+	PRISM_TEST(Ktx2LayersAndFaces)
+	{
+		// Two cubes of 8x8 BC1 with two levels, each level holds its 12 faces of 32 and 8 bytes layer by layer
+		const Ktx2File file = MakeKtx2(Ktx2Desc
+		{
+			.VkFormat = 132,  // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+			.Format   = DXGI_FORMAT_BC1_UNORM_SRGB,
+			.Layers   = 2,
+			.Faces    = 6,
+			.Levels   = 2
+		});
+
+		const auto result = TextureContainer::Parse(file.Data);
+		PRISM_CHECK(result);
+		PRISM_CHECK(result->Format == DXGI_FORMAT_BC1_UNORM_SRGB);
+		PRISM_CHECK(result->IsCubeMap && result->ArraySize == 12 && result->MipLevels == 2);
+		PRISM_CHECK(result->Subresources.size() == 24);
+
+		for (u32 slice = 0; slice < 12; slice++)
+		{
+			PRISM_CHECK(IsView(result->Subresources[slice * 2], file.Data, file.LevelOffsets[0] + slice * 32, 32));
+			PRISM_CHECK(IsView(result->Subresources[slice * 2 + 1], file.Data, file.LevelOffsets[1] + slice * 8, 8));
+		}
+
+		// Layers without faces are a plain array
+		const auto array = TextureContainer::Parse(MakeKtx2(Ktx2Desc{ .Layers = 3 }).Data);
+		PRISM_CHECK(array && array->ArraySize == 3 && !array->IsCubeMap);
+	}
+
+	PRISM_TEST(Ktx2Truncated)
+	{
+		const Ktx2File file = MakeKtx2(Ktx2Desc{ .Levels = 4 });
+
+		const auto Cut = [&file](const u64 size) { return std::span(file.Data).first(size); };
+		PRISM_CHECK(FailsWith(Cut(Ktx2HeaderSize - 1), ErrorType::Truncated));
+		PRISM_CHECK(FailsWith(Cut(Ktx2HeaderSize + 2 * Ktx2LevelIndexSize + 5), ErrorType::Truncated));
+		PRISM_CHECK(FailsWith(Cut(file.Data.size() - 1), ErrorType::Truncated));
+
+		// Level ranges that point outside the file or are too small for their level
+		Ktx2File outside = file;
+		Write(outside.Data, Ktx2HeaderSize + Ktx2LevelIndexSize, u64{ outside.Data.size() + 16 });
+		PRISM_CHECK(FailsWith(outside.Data, ErrorType::Truncated));
+
+		Ktx2File overflow = file;
+		Write(overflow.Data, Ktx2HeaderSize + 8, ~u64{ 0 });
+		PRISM_CHECK(FailsWith(overflow.Data, ErrorType::Truncated));
+
+		Ktx2File tooSmall = file;
+		Write(tooSmall.Data, Ktx2HeaderSize + 8, u64{ 255 });
+		PRISM_CHECK(FailsWith(tooSmall.Data, ErrorType::Truncated));
+	}
+
+	PRISM_TEST(Ktx2Malformed)
+	{
+		const auto Fails = [](const Ktx2Desc& desc, const ErrorType type)
+		{
+			const auto result = TextureContainer::Parse(MakeKtx2(desc).Data);
+			return !result && result.error().Type == type && result.error().ErrorCode == E_FAIL;
+		};
+
+		PRISM_CHECK(Fails(Ktx2Desc{ .Supercompression = 1 }, ErrorType::Unsupported));
+		PRISM_CHECK(Fails(Ktx2Desc{ .Depth = 2 }, ErrorType::Unsupported));
+		PRISM_CHECK(Fails(Ktx2Desc{ .Faces = 3 }, ErrorType::InvalidHeader));
+		PRISM_CHECK(Fails(Ktx2Desc{ .Faces = 0 }, ErrorType::InvalidHeader));
+		PRISM_CHECK(Fails(Ktx2Desc{ .Layers = 4096 }, ErrorType::InvalidHeader));
+		PRISM_CHECK(Fails(Ktx2Desc{ .VkFormat = 0 }, ErrorType::UnsupportedFormat));
+		PRISM_CHECK(Fails(Ktx2Desc{ .Width = 0 }, ErrorType::InvalidHeader));
+		PRISM_CHECK(Fails(Ktx2Desc{ .Levels = 5 }, ErrorType::InvalidHeader));
+		PRISM_CHECK(Fails(Ktx2Desc{ .Height = 4, .Faces = 6 }, ErrorType::InvalidHeader));
+	}
+
+	PRISM_TEST(UnknownContainer)
+	{
+		const std::array<u8, 16> pngHeader{ 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+		const std::span<const byte> png = std::as_bytes(std::span(pngHeader));
+		PRISM_CHECK(!TextureContainer::IsContainer(png));
+		PRISM_CHECK(FailsWith(png, ErrorType::UnknownContainer));
+		PRISM_CHECK(FailsWith({}, ErrorType::UnknownContainer));
+
+		// A KTX2 identifier cut short is not a KTX2 file
+		const Ktx2File file = MakeKtx2(Ktx2Desc{});
+		PRISM_CHECK(FailsWith(std::span(file.Data).first(11), ErrorType::UnknownContainer));
+	}
+}
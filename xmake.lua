@@ -67,3 +67,41 @@ target("Prism")
 		target:add("defines", defineValue)
 	end)
 target_end()
+
+-- Import pipeline benchmarks without a window, links the engine sources without Main.cpp. Only the io suite creates a device
+-- Run with "xmake run benchmarks [conversion|vertices|overdraw|meshlets|io|textures]..."
+target("benchmarks")
+	set_kind("binary")
+	set_default(false)
+
+	add_includedirs("Prism", "Benchmarks")
+	add_files("Benchmarks/**.cpp", "Prism/**.cpp|Main.cpp")
+
+	add_packages("Elos", "directxtk", "assimp", "imgui")
+	add_links("d3d11", "dxgi", "dxguid", "uuid", "d3dcompiler")
+
+	on_config(function(target)
+		local assetsPath = path.join(os.projectdir(), "Assets")
+		assetsPath = assetsPath:gsub("\\", "/")
+		local defineValue = "PRISM_ASSETS_PATH=\"" .. assetsPath .. "\""
+		target:add("defines", defineValue)
+	end)
+target_end()
+
+-- Headless unit tests for code that needs no device, "xmake test" builds and runs them
+target("tests")
+	set_kind("binary")
+	set_default(false)
+
+	add_includedirs("Prism", "Tests")
+	add_files("Tests/**.cpp")
+	add_files(
+		"Prism/Utils/Log.cpp",
+		"Prism/Graphics/Utils/MipGenerator.cpp",
+		"Prism/Graphics/Utils/ResidencyPlanner.cpp",
+		"Prism/Graphics/Utils/TextureContainer.cpp",
+		"Prism/Graphics/Utils/TextureFormat.cpp")
+
+	add_packages("Elos")
+	add_tests("Headless", { group = "Unit" })
+target_end()